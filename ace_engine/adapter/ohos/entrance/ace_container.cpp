@@ -1906,7 +1906,7 @@ void AceContainer::UpdateConfiguration(const ParsedConfig& parsedConfig, const s
         }
     }
     SetResourceConfiguration(resConfig);
-    themeManager->UpdateConfig(resConfig);
+    themeManager->UpdateConfig(resConfig, !parsedConfig.themeTag.empty());
     if (SystemProperties::GetResourceDecoupling()) {
         ResourceManager::GetInstance().UpdateResourceConfig(resConfig, !parsedConfig.themeTag.empty());
     }
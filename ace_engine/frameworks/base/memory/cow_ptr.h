@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_COW_PTR_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_COW_PTR_H
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace OHOS::Ace {
+
+/**
+ * CowPtr owns a block like std::unique_ptr, but copying a CowPtr shares the block instead of copying it, so a
+ * snapshot of an object holding its data in CowPtrs only copies pointers. The block is copied by Detach when it is
+ * shared, which has to be called before the block is modified. Like std::unique_ptr the pointer is shallow const,
+ * a block reached by operator-> must be treated as read only unless Detach was called first.
+ */
+template<typename T>
+class CowPtr final {
+public:
+    CowPtr() = default;
+    CowPtr(std::nullptr_t) {}
+    explicit CowPtr(std::unique_ptr<T>&& ptr) : ptr_(std::move(ptr)) {}
+    ~CowPtr() = default;
+
+    CowPtr(const CowPtr&) = default;
+    CowPtr(CowPtr&&) noexcept = default;
+    CowPtr& operator=(const CowPtr&) = default;
+    CowPtr& operator=(CowPtr&&) noexcept = default;
+
+    CowPtr& operator=(std::unique_ptr<T>&& ptr)
+    {
+        ptr_ = std::move(ptr);
+        return *this;
+    }
+
+    CowPtr& operator=(std::nullptr_t)
+    {
+        ptr_.reset();
+        return *this;
+    }
+
+    template<typename... Args>
+    static CowPtr Make(Args&&... args)
+    {
+        CowPtr result;
+        result.ptr_ = std::make_shared<T>(std::forward<Args>(args)...);
+        return result;
+    }
+
+    // Makes the block owned by this pointer only, return it to be modified.
+    T* Detach()
+    {
+        if (ptr_ && ptr_.use_count() > 1) {
+            ptr_ = std::make_shared<T>(*ptr_);
+        }
+        return ptr_.get();
+    }
+
+    bool IsShared() const
+    {
+        return ptr_ && ptr_.use_count() > 1;
+    }
+
+    T* get() const
+    {
+        return ptr_.get();
+    }
+
+    T* operator->() const
+    {
+        return ptr_.get();
+    }
+
+    T& operator*() const
+    {
+        return *ptr_;
+    }
+
+    explicit operator bool() const
+    {
+        return static_cast<bool>(ptr_);
+    }
+
+    void reset()
+    {
+        ptr_.reset();
+    }
+
+    bool operator==(const CowPtr& other) const
+    {
+        return ptr_ == other.ptr_;
+    }
+
+    bool operator!=(const CowPtr& other) const
+    {
+        return ptr_ != other.ptr_;
+    }
+
+    bool operator==(std::nullptr_t) const
+    {
+        return !ptr_;
+    }
+
+    bool operator!=(std::nullptr_t) const
+    {
+        return static_cast<bool>(ptr_);
+    }
+
+    friend bool operator==(std::nullptr_t, const CowPtr& ptr)
+    {
+        return !ptr.ptr_;
+    }
+
+    friend bool operator!=(std::nullptr_t, const CowPtr& ptr)
+    {
+        return static_cast<bool>(ptr.ptr_);
+    }
+
+private:
+    std::shared_ptr<T> ptr_;
+};
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_COW_PTR_H
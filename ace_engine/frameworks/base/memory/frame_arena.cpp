@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/memory/frame_arena.h"
+
+#include <atomic>
+#include <new>
+
+#include "base/log/log.h"
+#include "base/utils/system_properties.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr size_t BLOCK_SIZE = 64 * 1024;
+// larger objects are allocated from the heap, they would leave most of a block unused.
+constexpr size_t MAX_ARENA_OBJECT_SIZE = BLOCK_SIZE / 16;
+// blocks kept for the next frame, the others are released on reset.
+constexpr size_t MAX_CACHED_BLOCK_COUNT = 4;
+constexpr size_t ALIGNMENT = alignof(std::max_align_t);
+
+// put before every object, the block is nullptr when the object is allocated from the heap.
+struct alignas(std::max_align_t) ObjectHeader {
+    void* block = nullptr;
+};
+
+size_t AlignUp(size_t size)
+{
+    return (size + ALIGNMENT - 1) & ~(ALIGNMENT - 1);
+}
+} // namespace
+
+struct alignas(std::max_align_t) FrameArena::Block {
+    // the objects alive in the block, plus one held by the arena as long as the block belongs to it.
+    std::atomic<int32_t> refCount { 1 };
+    size_t used = 0;
+
+    static Block* Create()
+    {
+        return new (::operator new(sizeof(Block) + BLOCK_SIZE)) Block();
+    }
+
+    char* GetData()
+    {
+        return reinterpret_cast<char*>(this + 1);
+    }
+
+    void Release()
+    {
+        if (refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            this->~Block();
+            ::operator delete(this);
+        }
+    }
+};
+
+thread_local FrameArena* FrameArena::current_ = nullptr;
+
+FrameArena::Scope::Scope(FrameArena& arena) : lastArena_(current_)
+{
+    current_ = &arena;
+}
+
+FrameArena::Scope::~Scope()
+{
+    current_ = lastArena_;
+}
+
+FrameArena::~FrameArena()
+{
+    for (auto* block : blocks_) {
+        block->Release();
+    }
+}
+
+FrameArena* FrameArena::GetCurrent()
+{
+    return current_;
+}
+
+void* FrameArena::Allocate(size_t size)
+{
+    if (current_) {
+        auto* ptr = current_->AllocateFromBlock(size);
+        if (ptr) {
+            return ptr;
+        }
+    }
+    auto* header = new (::operator new(sizeof(ObjectHeader) + size)) ObjectHeader();
+    return header + 1;
+}
+
+void FrameArena::Deallocate(void* ptr)
+{
+    if (!ptr) {
+        return;
+    }
+    auto* header = static_cast<ObjectHeader*>(ptr) - 1;
+    auto* block = static_cast<Block*>(header->block);
+    if (!block) {
+        ::operator delete(header);
+        return;
+    }
+    block->Release();
+}
+
+void* FrameArena::AllocateFromBlock(size_t size)
+{
+    auto allocSize = sizeof(ObjectHeader) + AlignUp(size);
+    if (allocSize > MAX_ARENA_OBJECT_SIZE) {
+        return nullptr;
+    }
+    while (currentIndex_ < blocks_.size() && blocks_[currentIndex_]->used + allocSize > BLOCK_SIZE) {
+        ++currentIndex_;
+    }
+    if (currentIndex_ == blocks_.size()) {
+        blocks_.emplace_back(Block::Create());
+    }
+    auto* block = blocks_[currentIndex_];
+    auto* header = new (block->GetData() + block->used) ObjectHeader();
+    header->block = block;
+    block->used += allocSize;
+    block->refCount.fetch_add(1, std::memory_order_relaxed);
+    return header + 1;
+}
+
+void FrameArena::Reset()
+{
+    size_t cachedCount = 0;
+    size_t escapedCount = 0;
+    for (auto* block : blocks_) {
+        // no object is alive in the block, it is reused from the beginning.
+        if (block->refCount.load(std::memory_order_acquire) == 1 && cachedCount < MAX_CACHED_BLOCK_COUNT) {
+            block->used = 0;
+            blocks_[cachedCount++] = block;
+            continue;
+        }
+        escapedCount += static_cast<size_t>(block->refCount.load(std::memory_order_relaxed) - 1);
+        block->Release();
+    }
+    blocks_.resize(cachedCount);
+    currentIndex_ = 0;
+    if (escapedCount > 0) {
+        escapedCount_ += escapedCount;
+        if (SystemProperties::GetDebugEnabled()) {
+            LOGW("%{public}zu objects escaped the frame arena", escapedCount);
+        }
+    }
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_FRAME_ARENA_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_FRAME_ARENA_H
+
+#include <cstddef>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+/**
+ * FrameArena is a bump allocator for the objects which are created and released in one frame, like the wrappers used
+ * to layout and paint the dirty nodes. Its owner activates it on the thread with a Scope while the frame is flushed and
+ * resets it afterwards, which rewinds its blocks for the next frame.
+ *
+ * An object still alive when the arena is reset has escaped the frame. Its block is left to the object, and released
+ * with the last object allocated in it, while the arena continues with new blocks.
+ */
+class ACE_FORCE_EXPORT FrameArena final {
+public:
+    // Activates the arena on the current thread until the scope is destroyed.
+    class ACE_FORCE_EXPORT Scope final {
+    public:
+        explicit Scope(FrameArena& arena);
+        ~Scope();
+
+    private:
+        FrameArena* lastArena_ = nullptr;
+
+        ACE_DISALLOW_COPY_AND_MOVE(Scope);
+    };
+
+    FrameArena() = default;
+    ~FrameArena();
+
+    // Allocates from the arena active on the current thread, or from the heap if there is none. The memory must be
+    // released by Deallocate, which can be called on any thread.
+    static void* Allocate(size_t size);
+    static void Deallocate(void* ptr);
+
+    static FrameArena* GetCurrent();
+
+    void Reset();
+
+    size_t GetBlockCount() const
+    {
+        return blocks_.size();
+    }
+
+    // the number of objects which escaped the frames so far.
+    size_t GetEscapedCount() const
+    {
+        return escapedCount_;
+    }
+
+private:
+    struct Block;
+
+    void* AllocateFromBlock(size_t size);
+
+    static thread_local FrameArena* current_;
+
+    std::vector<Block*> blocks_;
+    size_t currentIndex_ = 0;
+    size_t escapedCount_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(FrameArena);
+};
+
+// Objects of the classes derived from FrameArenaObject are allocated in the active frame arena, the classes must only
+// be used for objects which are released in the frame they are created in.
+class FrameArenaObject {
+public:
+    static void* operator new(size_t size)
+    {
+        return FrameArena::Allocate(size);
+    }
+
+    static void operator delete(void* ptr)
+    {
+        FrameArena::Deallocate(ptr);
+    }
+};
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_MEMORY_FRAME_ARENA_H
@@ -223,84 +223,27 @@ std::vector<std::string> ConvertDal2Rpn(std::string formula)
     return result;
 }
 
-bool CalculateFourOperationsExp(const std::string& exp, const Dimension& num1, const Dimension& num2,
-    const std::function<double(const Dimension&)>& calcFunc, double& opRes)
-{
-    if (exp == "+") {
-        if ((num1.Unit() == DimensionUnit::NONE && num2.Unit() != DimensionUnit::NONE) ||
-            (num1.Unit() != DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE)) {
-            return false;
-        }
-        opRes = calcFunc(num2) + calcFunc(num1);
-    } else if (exp == "-") {
-        if ((num1.Unit() == DimensionUnit::NONE && num2.Unit() != DimensionUnit::NONE) ||
-            (num1.Unit() != DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE)) {
-            return false;
-        }
-        opRes = calcFunc(num2) - calcFunc(num1);
-    } else if (exp == "*") {
-        if (num1.Unit() != DimensionUnit::NONE && num2.Unit() != DimensionUnit::NONE) {
-            return false;
-        }
-        opRes = calcFunc(num2) * calcFunc(num1);
-    } else if (exp == "/") {
-        if (NearZero(calcFunc(num1))) {
-            return false;
-        }
-        if ((num1.Unit() != DimensionUnit::NONE)) {
-            return false;
-        }
-        opRes = calcFunc(num2) / calcFunc(num1);
-    }
-    return true;
-}
-
-bool CalculateExpImpl(const std::vector<std::string>& rpnexp, const std::function<double(const Dimension&)>& calcFunc,
-    std::vector<Dimension>& result, double& opRes)
+std::vector<CalcToken> CompileExp(const std::string& expression)
 {
+    std::vector<CalcToken> rpnExp;
     std::string ops = "+-*/()";
-    for (auto& i : rpnexp) {
-        if (ops.find(i) == ops.npos) {
-            std::string value = i;
-            Dimension dim = StringUtils::StringToDimensionWithUnit(value, DimensionUnit::PX, 0.0f, true);
-            if (dim.Unit() == DimensionUnit::INVALID) {
-                return false;
+    for (auto& item : ConvertDal2Rpn(expression)) {
+        CalcToken token;
+        if (ops.find(item) == ops.npos) {
+            token.value = StringUtils::StringToDimensionWithUnit(item, DimensionUnit::PX, 0.0f, true);
+            if (token.value.Unit() == DimensionUnit::INVALID) {
+                return {};
             }
-            result.emplace_back(dim);
         } else {
-            if (result.size() <= 1) {
-                return false;
-            }
-            Dimension num1 = result.back();
-            result.pop_back();
-            Dimension num2 = result.back();
-            result.pop_back();
-            auto ret = CalculateFourOperationsExp(i, num1, num2, calcFunc, opRes);
-            if (!ret) {
-                return ret;
-            }
-            if (num1.Unit() == DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE) {
-                result.emplace_back(Dimension(opRes, DimensionUnit::NONE));
-                continue;
-            }
-            result.emplace_back(Dimension(opRes, DimensionUnit::PX));
+            token.op = item[0];
         }
+        rpnExp.emplace_back(token);
     }
-    return true;
+    return rpnExp;
 }
 
 double CalculateExp(const std::string& expression, const std::function<double(const Dimension&)>& calcFunc)
 {
-    std::vector<std::string> rpnexp = ConvertDal2Rpn(expression);
-    std::vector<Dimension> result;
-    double opRes = 0.0;
-    auto ret = CalculateExpImpl(rpnexp, calcFunc, result, opRes);
-    if (!ret) {
-        return 0.0;
-    }
-    if (result.size() == 1 && result.back().Unit() != DimensionUnit::NONE) {
-        return calcFunc(result.back());
-    }
-    return 0.0;
+    return CalculateExp(CompileExp(expression), calcFunc);
 }
 } // namespace OHOS::Ace::StringExpression
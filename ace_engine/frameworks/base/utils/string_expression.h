@@ -22,6 +22,7 @@
 #include <vector>
 
 #include "base/geometry/dimension.h"
+#include "base/utils/utils.h"
 
 namespace OHOS::Ace::StringExpression {
 
@@ -35,6 +36,77 @@ std::vector<std::string> ConvertDal2Rpn(std::string formula);
 
 double CalculateExp(const std::string& expression, const std::function<double(const Dimension&)>& calcFunc);
 
+// an item of a formula converted to reverse polish notation, with the operand already parsed.
+struct CalcToken {
+    // one of "+-*/()" for an operator, 0 for an operand.
+    char op = 0;
+    Dimension value;
+};
+
+// parse the formula once, return an empty list if it is invalid.
+std::vector<CalcToken> CompileExp(const std::string& expression);
+
+template<typename CalcFunc>
+bool CalculateFourOperationsExp(
+    char op, const Dimension& num1, const Dimension& num2, const CalcFunc& calcFunc, double& opRes)
+{
+    if (op == '+' || op == '-') {
+        if ((num1.Unit() == DimensionUnit::NONE && num2.Unit() != DimensionUnit::NONE) ||
+            (num1.Unit() != DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE)) {
+            return false;
+        }
+        opRes = op == '+' ? calcFunc(num2) + calcFunc(num1) : calcFunc(num2) - calcFunc(num1);
+    } else if (op == '*') {
+        if (num1.Unit() != DimensionUnit::NONE && num2.Unit() != DimensionUnit::NONE) {
+            return false;
+        }
+        opRes = calcFunc(num2) * calcFunc(num1);
+    } else if (op == '/') {
+        if (NearZero(calcFunc(num1))) {
+            return false;
+        }
+        if ((num1.Unit() != DimensionUnit::NONE)) {
+            return false;
+        }
+        opRes = calcFunc(num2) / calcFunc(num1);
+    }
+    return true;
+}
+
+// evaluate a formula compiled by CompileExp, same as CalculateExp with the formula string.
+template<typename CalcFunc>
+double CalculateExp(const std::vector<CalcToken>& rpnExp, const CalcFunc& calcFunc)
+{
+    std::vector<Dimension> result;
+    result.reserve(rpnExp.size());
+    double opRes = 0.0;
+    for (const auto& token : rpnExp) {
+        if (token.op == 0) {
+            result.emplace_back(token.value);
+            continue;
+        }
+        if (result.size() <= 1) {
+            return 0.0;
+        }
+        Dimension num1 = result.back();
+        result.pop_back();
+        Dimension num2 = result.back();
+        result.pop_back();
+        if (!CalculateFourOperationsExp(token.op, num1, num2, calcFunc, opRes)) {
+            return 0.0;
+        }
+        if (num1.Unit() == DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE) {
+            result.emplace_back(Dimension(opRes, DimensionUnit::NONE));
+            continue;
+        }
+        result.emplace_back(Dimension(opRes, DimensionUnit::PX));
+    }
+    if (result.size() == 1 && result.back().Unit() != DimensionUnit::NONE) {
+        return calcFunc(result.back());
+    }
+    return 0.0;
+}
+
 } // namespace OHOS::Ace::StringExpression
 
 #endif // FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_STRING_EXPRESSION_H
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/utils/tag_registry.h"
+
+#include <mutex>
+#include <tuple>
+
+namespace OHOS::Ace {
+namespace {
+constexpr char UNDEFINED_TAG[] = "undefined TAG";
+} // namespace
+
+TagRegistry& TagRegistry::GetInstance()
+{
+    static TagRegistry instance;
+    return instance;
+}
+
+TagRegistry::TagRegistry()
+{
+    tags_.emplace_back(UNDEFINED_TAG);
+    tagIds_.emplace(tags_.back(), UNDEFINED_TAG_ID);
+}
+
+uint32_t TagRegistry::Intern(const std::string& tag)
+{
+    return InternTag(tag).first;
+}
+
+std::pair<uint32_t, const std::string*> TagRegistry::InternTag(const std::string& tag)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto iter = tagIds_.find(tag);
+        if (iter != tagIds_.end()) {
+            return { iter->second, &tags_[iter->second] };
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto iter = tagIds_.find(tag);
+    if (iter != tagIds_.end()) {
+        return { iter->second, &tags_[iter->second] };
+    }
+    auto tagId = static_cast<uint32_t>(tags_.size());
+    tags_.emplace_back(tag);
+    tagIds_.emplace(tags_.back(), tagId);
+    return { tagId, &tags_.back() };
+}
+
+const std::string& TagRegistry::GetTag(uint32_t tagId) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return tagId < tags_.size() ? tags_[tagId] : tags_.front();
+}
+
+size_t TagRegistry::GetTagCount() const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return tags_.size();
+}
+
+InternedTag::InternedTag() : name_(&TagRegistry::GetInstance().GetTag(TagRegistry::UNDEFINED_TAG_ID)) {}
+
+InternedTag::InternedTag(const std::string& tag)
+{
+    std::tie(id_, name_) = TagRegistry::GetInstance().InternTag(tag);
+}
+
+InternedTag& InternedTag::operator=(const std::string& tag)
+{
+    *this = InternedTag(tag);
+    return *this;
+}
+} // namespace OHOS::Ace
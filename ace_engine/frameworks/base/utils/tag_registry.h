@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_TAG_REGISTRY_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_TAG_REGISTRY_H
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+/**
+ * TagRegistry interns the tags of the nodes into compact ids shared by all instances, so a tag is compared by its id
+ * and tables keyed by tag can be indexed by it. The names are never released, a reference to a name stays valid.
+ */
+class ACE_FORCE_EXPORT TagRegistry final {
+public:
+    static constexpr uint32_t UNDEFINED_TAG_ID = 0;
+
+    static TagRegistry& GetInstance();
+
+    // return the id of [tag], equal tags get the same id on all threads.
+    uint32_t Intern(const std::string& tag);
+
+    // return the name of [tagId], the name of UNDEFINED_TAG_ID if the id is unknown.
+    const std::string& GetTag(uint32_t tagId) const;
+
+    size_t GetTagCount() const;
+
+private:
+    TagRegistry();
+    ~TagRegistry() = default;
+
+    std::pair<uint32_t, const std::string*> InternTag(const std::string& tag);
+
+    mutable std::shared_mutex mutex_;
+    // deque keeps the names in place when it grows, the keys of tagIds_ point to them.
+    std::deque<std::string> tags_;
+    std::unordered_map<std::string_view, uint32_t> tagIds_;
+
+    friend class InternedTag;
+
+    ACE_DISALLOW_COPY_AND_MOVE(TagRegistry);
+};
+
+// The tag of a node, it keeps the interned id and a reference to the name instead of a copy of the string.
+class ACE_FORCE_EXPORT InternedTag final {
+public:
+    InternedTag();
+    explicit InternedTag(const std::string& tag);
+    ~InternedTag() = default;
+
+    InternedTag(const InternedTag&) = default;
+    InternedTag& operator=(const InternedTag&) = default;
+    InternedTag& operator=(const std::string& tag);
+
+    uint32_t GetId() const
+    {
+        return id_;
+    }
+
+    const std::string& GetName() const
+    {
+        return *name_;
+    }
+
+    bool operator==(const InternedTag& other) const
+    {
+        return id_ == other.id_;
+    }
+
+    bool operator!=(const InternedTag& other) const
+    {
+        return id_ != other.id_;
+    }
+
+    bool operator==(const std::string& tag) const
+    {
+        return *name_ == tag;
+    }
+
+    bool operator!=(const std::string& tag) const
+    {
+        return *name_ != tag;
+    }
+
+    bool operator==(const char* tag) const
+    {
+        return *name_ == tag;
+    }
+
+    bool operator!=(const char* tag) const
+    {
+        return *name_ != tag;
+    }
+
+private:
+    uint32_t id_ = TagRegistry::UNDEFINED_TAG_ID;
+    const std::string* name_ = nullptr;
+};
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_UTILS_TAG_REGISTRY_H
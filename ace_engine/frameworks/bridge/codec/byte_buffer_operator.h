@@ -20,6 +20,7 @@
 #include <map>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/log/log.h"
@@ -29,7 +30,9 @@ namespace OHOS::Ace::Framework {
 
 class ByteBufferReader final {
 public:
-    explicit ByteBufferReader(const std::vector<uint8_t>& buffer) : buffer_(buffer) {}
+    explicit ByteBufferReader(const std::vector<uint8_t>& buffer) : data_(buffer.data()), size_(buffer.size()) {}
+    // The reader does not own data, which must outlive the reader and any view read from it.
+    ByteBufferReader(const uint8_t* data, size_t size) : data_(data), size_(data ? size : 0) {}
     ~ByteBufferReader() = default;
 
     bool ReadData(uint8_t& value) const
@@ -69,15 +72,43 @@ public:
     bool ReadData(std::map<std::string, std::string>& dst) const;
     bool ReadData(std::set<std::string>& dst) const;
 
+    /*
+     * Read a string or an array without copying it, the result points into the buffer of the reader.
+     */
+    bool ReadData(std::string_view& value) const
+    {
+        const char* data = nullptr;
+        size_t length = 0;
+        if (!ReadArrayView(data, length)) {
+            return false;
+        }
+        value = std::string_view(data, length);
+        return true;
+    }
+
+    template<class T>
+    bool ReadArrayView(const T*& data, size_t& length) const
+    {
+        int32_t count = -1;
+        if (!ReadData(count) || count < 0 || static_cast<size_t>(count) > (size_ - readPos_) / sizeof(T)) {
+            LOGW("Could not read array length or array length is invalid");
+            return false;
+        }
+        data = reinterpret_cast<const T*>(data_ + readPos_);
+        length = static_cast<size_t>(count);
+        readPos_ += sizeof(T) * length;
+        return true;
+    }
+
 private:
     template<class T>
     bool ReadValue(T& value) const
     {
-        if (readPos_ + sizeof(T) > buffer_.size()) {
-            LOGW("Exceed buffer size, readPos = %{public}u, buffer size = %{public}zu", readPos_, buffer_.size());
+        if (sizeof(T) > size_ - readPos_) {
+            LOGW("Exceed buffer size, readPos = %{public}zu, buffer size = %{public}zu", readPos_, size_);
             return false;
         }
-        value = *reinterpret_cast<const T*>(buffer_.data() + readPos_);
+        value = *reinterpret_cast<const T*>(data_ + readPos_);
         readPos_ += sizeof(T);
         return true;
     }
@@ -85,20 +116,18 @@ private:
     template<class T>
     bool ReadArray(T& dst) const
     {
-        int32_t length = -1;
-        if (!ReadData(length) || length < 0 ||
-            readPos_ + static_cast<uint32_t>(sizeof(typename T::value_type) * length) > buffer_.size()) {
-            LOGW("Could not read array length or array length is invalid");
+        const typename T::value_type* data = nullptr;
+        size_t length = 0;
+        if (!ReadArrayView(data, length)) {
             return false;
         }
-        auto data = reinterpret_cast<const typename T::value_type*>(buffer_.data() + readPos_);
         dst.assign(data, data + length);
-        readPos_ += static_cast<uint32_t>(sizeof(typename T::value_type) * length);
         return true;
     }
 
-    const std::vector<uint8_t>& buffer_;
-    mutable uint32_t readPos_ = 0;
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    mutable size_t readPos_ = 0;
 
     ACE_DISALLOW_COPY_AND_MOVE(ByteBufferReader);
 };
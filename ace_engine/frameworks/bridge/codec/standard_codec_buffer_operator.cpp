@@ -93,7 +93,26 @@ bool StandardCodecBufferReader::ReadData(CodecData& resultData)
         LOGW("Read type failed");
         return false;
     }
+    return ReadValue(type, resultData);
+}
+
+bool StandardCodecBufferReader::ReadStringView(std::string_view& value)
+{
+    BufferDataType type = BufferDataType::TYPE_NULL;
+    if (!ReadType(type)) {
+        LOGW("Read type failed");
+        return false;
+    }
+    if (type == BufferDataType::TYPE_STRING || type == BufferDataType::TYPE_OBJECT) {
+        return byteBufferReader_.ReadData(value);
+    }
+    value = std::string_view();
+    CodecData skippedData;
+    return ReadValue(type, skippedData);
+}
 
+bool StandardCodecBufferReader::ReadValue(BufferDataType type, CodecData& resultData)
+{
     switch (type) {
         case BufferDataType::TYPE_NULL:
             resultData = CodecData();
@@ -145,6 +164,43 @@ void StandardCodecBufferWriter::WriteDataList(const std::vector<CodecData>& data
     }
 }
 
+size_t StandardCodecBufferWriter::GetEncodedSize(const CodecData& data)
+{
+    size_t size = sizeof(uint8_t);
+    switch (data.GetType()) {
+        case BufferDataType::TYPE_INT:
+        case BufferDataType::TYPE_FUNCTION:
+            return size + sizeof(int32_t);
+        case BufferDataType::TYPE_LONG:
+            return size + sizeof(int64_t);
+        case BufferDataType::TYPE_DOUBLE:
+            return size + sizeof(double);
+        case BufferDataType::TYPE_STRING:
+        case BufferDataType::TYPE_OBJECT:
+            return size + sizeof(int32_t) + data.GetStringValue().size();
+        case BufferDataType::TYPE_INT8_ARRAY:
+            return size + sizeof(int32_t) + data.GetInt8ArrayValue().size() * sizeof(int8_t);
+        case BufferDataType::TYPE_INT16_ARRAY:
+            return size + sizeof(int32_t) + data.GetInt16ArrayValue().size() * sizeof(int16_t);
+        case BufferDataType::TYPE_INT32_ARRAY:
+            return size + sizeof(int32_t) + data.GetInt32ArrayValue().size() * sizeof(int32_t);
+        case BufferDataType::TYPE_MAP:
+            size += sizeof(int32_t);
+            for (const auto& [key, value] : data.GetMapValue()) {
+                size += sizeof(int32_t) * 2 + key.size() + value.size();
+            }
+            return size;
+        case BufferDataType::TYPE_SET:
+            size += sizeof(int32_t);
+            for (const auto& value : data.GetSetValue()) {
+                size += sizeof(int32_t) + value.size();
+            }
+            return size;
+        default:
+            return size;
+    }
+}
+
 void StandardCodecBufferWriter::WriteData(const CodecData& data)
 {
     WriteType(data.GetType());
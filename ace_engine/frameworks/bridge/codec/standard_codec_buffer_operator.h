@@ -17,6 +17,7 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_CODEC_BUFFER_OPERATOR_H
 
 #include <cstdint>
+#include <string_view>
 #include <vector>
 
 #include "base/utils/macros.h"
@@ -29,14 +30,21 @@ namespace OHOS::Ace::Framework {
 class ACE_EXPORT StandardCodecBufferReader final {
 public:
     explicit StandardCodecBufferReader(const std::vector<uint8_t>& buffer) : byteBufferReader_(buffer) {}
+    StandardCodecBufferReader(const uint8_t* data, size_t size) : byteBufferReader_(data, size) {}
     ~StandardCodecBufferReader() = default;
 
     bool ReadData(CodecData& resultData);
     bool ReadDataList(std::vector<CodecData>& resultDataList);
     bool ReadMapSize(int32_t& size);
 
+    /*
+     * Read a string or object value as a view into the buffer, other values are skipped and read as empty.
+     */
+    bool ReadStringView(std::string_view& value);
+
 private:
     bool ReadType(BufferDataType& type);
+    bool ReadValue(BufferDataType type, CodecData& resultData);
 
     ByteBufferReader byteBufferReader_;
 
@@ -51,6 +59,8 @@ public:
     void WriteData(const CodecData& data);
     void WriteDataList(const std::vector<CodecData>& dataList);
 
+    static size_t GetEncodedSize(const CodecData& data);
+
 private:
     void WriteType(BufferDataType type);
 
@@ -26,8 +26,15 @@ bool StandardFunctionCodec::EncodeFunctionCall(const FunctionCall& functionCall,
         return false;
     }
 
+    CodecData funcName(functionCall.GetFuncName());
+    size_t encodedSize = StandardCodecBufferWriter::GetEncodedSize(funcName) + sizeof(uint8_t);
+    for (const auto& arg : functionCall.GetArgs()) {
+        encodedSize += StandardCodecBufferWriter::GetEncodedSize(arg);
+    }
+    resultBuffer.reserve(resultBuffer.size() + encodedSize);
+
     StandardCodecBufferWriter bufferWriter(resultBuffer);
-    bufferWriter.WriteData(CodecData(functionCall.GetFuncName()));
+    bufferWriter.WriteData(funcName);
     bufferWriter.WriteDataList(functionCall.GetArgs());
     return true;
 }
@@ -62,4 +69,14 @@ bool StandardFunctionCodec::DecodePlatformMessage(const std::vector<uint8_t>& bu
     return true;
 }
 
+bool StandardFunctionCodec::DecodePlatformMessage(const uint8_t* data, size_t size, std::string_view& platformMessage)
+{
+    StandardCodecBufferReader bufferReader(data, size);
+    if (!bufferReader.ReadStringView(platformMessage)) {
+        LOGW("Decode platform message failed");
+        return false;
+    }
+    return true;
+}
+
 } // namespace OHOS::Ace::Framework
\ No newline at end of file
@@ -17,6 +17,7 @@
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_FUNCTION_CODEC_H
 
 #include <cstdint>
+#include <string_view>
 #include <vector>
 
 #include "base/utils/macros.h"
@@ -36,6 +37,11 @@ public:
     bool DecodeFunctionCall(const std::vector<uint8_t>& buffer, FunctionCall& functionCall) override;
     bool DecodePlatformMessage(const std::vector<uint8_t>& buffer, CodecData& platformMessage) override;
 
+    /*
+     * Decode a string message without copying it, the view is valid as long as data is.
+     */
+    bool DecodePlatformMessage(const uint8_t* data, size_t size, std::string_view& platformMessage);
+
 private:
     ACE_DISALLOW_COPY_AND_MOVE(StandardFunctionCodec);
 };
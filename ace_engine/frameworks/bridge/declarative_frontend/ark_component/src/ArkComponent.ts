@@ -136,6 +136,65 @@ class Modifier<T extends number | string | boolean | Equable | Resource | object
   applyPeer(node: KNode, reset: boolean): void { }
 }
 
+// keep in sync with AttributeBatchId in arkts_native_common_bridge.h
+const enum AttributeBatchId {
+  WIDTH = 0,
+  HEIGHT = 1,
+  BACKGROUND_COLOR = 2,
+  OPACITY = 3,
+  Z_INDEX = 4,
+  VISIBILITY = 5,
+}
+
+const ATTRIBUTE_BATCH_OP_RESET = 0;
+const ATTRIBUTE_BATCH_OP_SET = 1;
+const ATTRIBUTE_BATCH_CAPACITY = 64;
+
+// Collects [id, op, payload] commands of one node and applies them in a single native call.
+class AttributeBatch {
+  private static instance_?: AttributeBatch;
+  private buffer_: ArrayBuffer;
+  private data_: Float64Array;
+  private length_: number = 0;
+  private node_?: KNode;
+
+  private constructor() {
+    this.buffer_ = new ArrayBuffer(ATTRIBUTE_BATCH_CAPACITY * Float64Array.BYTES_PER_ELEMENT);
+    this.data_ = new Float64Array(this.buffer_);
+  }
+
+  static getInstance(): AttributeBatch {
+    if (AttributeBatch.instance_ === undefined) {
+      AttributeBatch.instance_ = new AttributeBatch();
+    }
+    return AttributeBatch.instance_;
+  }
+
+  begin(node: KNode): void {
+    this.flush();
+    this.node_ = node;
+  }
+
+  push(id: AttributeBatchId, reset: boolean, value?: number): void {
+    const size = reset ? 2 : 3;
+    if (this.length_ + size > ATTRIBUTE_BATCH_CAPACITY) {
+      this.flush();
+    }
+    this.data_[this.length_++] = id;
+    this.data_[this.length_++] = reset ? ATTRIBUTE_BATCH_OP_RESET : ATTRIBUTE_BATCH_OP_SET;
+    if (!reset) {
+      this.data_[this.length_++] = value;
+    }
+  }
+
+  flush(): void {
+    if (this.length_ > 0 && this.node_ !== undefined) {
+      getUINativeModule().common.applyAttributeBatch(this.node_, this.buffer_, this.length_);
+    }
+    this.length_ = 0;
+  }
+}
+
 class ModifierWithKey<T extends number | string | boolean | object> {
   stageValue?: T;
   value?: T;
@@ -143,10 +202,10 @@ class ModifierWithKey<T extends number | string | boolean | object> {
     this.stageValue = value;
   }
 
-  applyStage(node: KNode): boolean {
+  applyStage(node: KNode, batch?: AttributeBatch): boolean {
     if (this.stageValue === undefined || this.stageValue === null) {
       this.value = this.stageValue;
-      this.applyPeer(node, true);
+      this.applyPeerBatched(node, true, batch);
       return true;
     }
     const stageTypeInfo: string = typeof this.stageValue;
@@ -161,14 +220,33 @@ class ModifierWithKey<T extends number | string | boolean | object> {
     }
     if (different) {
       this.value = this.stageValue;
-      this.applyPeer(node, false);
+      this.applyPeerBatched(node, false, batch);
     }
     this.stageValue = undefined;
     return false;
   }
 
+  applyPeerBatched(node: KNode, reset: boolean, batch?: AttributeBatch): void {
+    if (batch === undefined) {
+      this.applyPeer(node, reset);
+      return;
+    }
+    if (this.encodeBatch(batch, reset)) {
+      return;
+    }
+    // commands already queued must reach the node before this one to keep the apply order.
+    batch.flush();
+    this.applyPeer(node, reset);
+    // applyPeer may apply the patch of another node through the same batch.
+    batch.begin(node);
+  }
+
   applyPeer(node: KNode, reset: boolean): void { }
 
+  encodeBatch(batch: AttributeBatch, reset: boolean): boolean {
+    return false;
+  }
+
   checkObjectDiff(): boolean {
     return true;
   }
@@ -179,6 +257,17 @@ class BackgroundColorModifier extends ModifierWithKey<ResourceColor> {
     super(value);
   }
   static identity: Symbol = Symbol('backgroundColor');
+  encodeBatch(batch: AttributeBatch, reset: boolean): boolean {
+    if (reset) {
+      batch.push(AttributeBatchId.BACKGROUND_COLOR, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(AttributeBatchId.BACKGROUND_COLOR, false, (this.value as number) >>> 0);
+    return true;
+  }
   applyPeer(node: KNode, reset: boolean): void {
     if (reset) {
       getUINativeModule().common.resetBackgroundColor(node);
@@ -197,6 +286,17 @@ class WidthModifier extends ModifierWithKey<Length> {
     super(value);
   }
   static identity: Symbol = Symbol('width');
+  encodeBatch(batch: AttributeBatch, reset: boolean): boolean {
+    if (reset) {
+      batch.push(AttributeBatchId.WIDTH, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(AttributeBatchId.WIDTH, false, this.value as number);
+    return true;
+  }
   applyPeer(node: KNode, reset: boolean): void {
     if (reset) {
       getUINativeModule().common.resetWidth(node);
@@ -250,6 +350,17 @@ class HeightModifier extends ModifierWithKey<Length> {
     super(value);
   }
   static identity: Symbol = Symbol('height');
+  encodeBatch(batch: AttributeBatch, reset: boolean): boolean {
+    if (reset) {
+      batch.push(AttributeBatchId.HEIGHT, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(AttributeBatchId.HEIGHT, false, this.value as number);
+    return true;
+  }
   applyPeer(node: KNode, reset: boolean): void {
     if (reset) {
       getUINativeModule().common.resetHeight(node);
@@ -465,6 +576,17 @@ class ZIndexModifier extends ModifierWithKey<number> {
     super(value);
   }
   static identity: Symbol = Symbol('zIndex');
+  encodeBatch(batch: AttributeBatch, reset: boolean): boolean {
+    if (reset) {
+      batch.push(AttributeBatchId.Z_INDEX, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(AttributeBatchId.Z_INDEX, false, this.value | 0);
+    return true;
+  }
   applyPeer(node: KNode, reset: boolean): void {
     if (reset) {
       getUINativeModule().common.resetZIndex(node);
@@ -479,6 +601,17 @@ class OpacityModifier extends ModifierWithKey<number | Resource> {
     super(value);
   }
   static identity: Symbol = Symbol('opacity');
+  encodeBatch(batch: AttributeBatch, reset: boolean): boolean {
+    if (reset) {
+      batch.push(AttributeBatchId.OPACITY, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(AttributeBatchId.OPACITY, false, this.value as number);
+    return true;
+  }
   applyPeer(node: KNode, reset: boolean): void {
     if (reset) {
       getUINativeModule().common.resetOpacity(node);
@@ -1410,6 +1543,17 @@ class VisibilityModifier extends ModifierWithKey<number> {
     super(value);
   }
   static identity: Symbol = Symbol('visibility');
+  encodeBatch(batch: AttributeBatch, reset: boolean): boolean {
+    if (reset) {
+      batch.push(AttributeBatchId.VISIBILITY, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(AttributeBatchId.VISIBILITY, false, this.value | 0);
+    return true;
+  }
   applyPeer(node: KNode, reset: boolean): void {
     if (reset) {
       getUINativeModule().common.resetVisibility(node);
@@ -2087,11 +2231,14 @@ class ArkComponent implements CommonMethod<CommonAttribute> {
         expiringItems.push(key);
       }
     });
+    const batch = AttributeBatch.getInstance();
+    batch.begin(this.nativePtr);
     this._modifiersWithKeys.forEach((value, key) => {
-      if (value.applyStage(this.nativePtr)) {
+      if (value.applyStage(this.nativePtr, batch)) {
         expiringItemsWithKeys.push(key);
       }
     });
+    batch.flush();
     expiringItems.forEach(key => {
       this._modifiers.delete(key);
     });
@@ -116,14 +116,51 @@ class Modifier {
   }
   applyPeer(node, reset) { }
 }
+const ATTRIBUTE_BATCH_OP_RESET = 0;
+const ATTRIBUTE_BATCH_OP_SET = 1;
+const ATTRIBUTE_BATCH_CAPACITY = 64;
+class AttributeBatch {
+  constructor() {
+    this.length_ = 0;
+    this.buffer_ = new ArrayBuffer(ATTRIBUTE_BATCH_CAPACITY * Float64Array.BYTES_PER_ELEMENT);
+    this.data_ = new Float64Array(this.buffer_);
+  }
+  static getInstance() {
+    if (AttributeBatch.instance_ === undefined) {
+      AttributeBatch.instance_ = new AttributeBatch();
+    }
+    return AttributeBatch.instance_;
+  }
+  begin(node) {
+    this.flush();
+    this.node_ = node;
+  }
+  push(id, reset, value) {
+    const size = reset ? 2 : 3;
+    if (this.length_ + size > ATTRIBUTE_BATCH_CAPACITY) {
+      this.flush();
+    }
+    this.data_[this.length_++] = id;
+    this.data_[this.length_++] = reset ? ATTRIBUTE_BATCH_OP_RESET : ATTRIBUTE_BATCH_OP_SET;
+    if (!reset) {
+      this.data_[this.length_++] = value;
+    }
+  }
+  flush() {
+    if (this.length_ > 0 && this.node_ !== undefined) {
+      getUINativeModule().common.applyAttributeBatch(this.node_, this.buffer_, this.length_);
+    }
+    this.length_ = 0;
+  }
+}
 class ModifierWithKey {
   constructor(value) {
     this.stageValue = value;
   }
-  applyStage(node) {
+  applyStage(node, batch) {
     if (this.stageValue === undefined || this.stageValue === null) {
       this.value = this.stageValue;
-      this.applyPeer(node, true);
+      this.applyPeerBatched(node, true, batch);
       return true;
     }
     const stageTypeInfo = typeof this.stageValue;
@@ -140,12 +177,29 @@ class ModifierWithKey {
     }
     if (different) {
       this.value = this.stageValue;
-      this.applyPeer(node, false);
+      this.applyPeerBatched(node, false, batch);
     }
     this.stageValue = undefined;
     return false;
   }
+  applyPeerBatched(node, reset, batch) {
+    if (batch === undefined) {
+      this.applyPeer(node, reset);
+      return;
+    }
+    if (this.encodeBatch(batch, reset)) {
+      return;
+    }
+    // commands already queued must reach the node before this one to keep the apply order.
+    batch.flush();
+    this.applyPeer(node, reset);
+    // applyPeer may apply the patch of another node through the same batch.
+    batch.begin(node);
+  }
   applyPeer(node, reset) { }
+  encodeBatch(batch, reset) {
+    return false;
+  }
   checkObjectDiff() {
     return true;
   }
@@ -154,6 +208,17 @@ class BackgroundColorModifier extends ModifierWithKey {
   constructor(value) {
     super(value);
   }
+  encodeBatch(batch, reset) {
+    if (reset) {
+      batch.push(2 /* AttributeBatchId.BACKGROUND_COLOR */, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(2 /* AttributeBatchId.BACKGROUND_COLOR */, false, this.value >>> 0);
+    return true;
+  }
   applyPeer(node, reset) {
     if (reset) {
       getUINativeModule().common.resetBackgroundColor(node);
@@ -171,6 +236,17 @@ class WidthModifier extends ModifierWithKey {
   constructor(value) {
     super(value);
   }
+  encodeBatch(batch, reset) {
+    if (reset) {
+      batch.push(0 /* AttributeBatchId.WIDTH */, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(0 /* AttributeBatchId.WIDTH */, false, this.value);
+    return true;
+  }
   applyPeer(node, reset) {
     if (reset) {
       getUINativeModule().common.resetWidth(node);
@@ -221,6 +297,17 @@ class HeightModifier extends ModifierWithKey {
   constructor(value) {
     super(value);
   }
+  encodeBatch(batch, reset) {
+    if (reset) {
+      batch.push(1 /* AttributeBatchId.HEIGHT */, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(1 /* AttributeBatchId.HEIGHT */, false, this.value);
+    return true;
+  }
   applyPeer(node, reset) {
     if (reset) {
       getUINativeModule().common.resetHeight(node);
@@ -427,6 +514,17 @@ class ZIndexModifier extends ModifierWithKey {
   constructor(value) {
     super(value);
   }
+  encodeBatch(batch, reset) {
+    if (reset) {
+      batch.push(4 /* AttributeBatchId.Z_INDEX */, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(4 /* AttributeBatchId.Z_INDEX */, false, this.value | 0);
+    return true;
+  }
   applyPeer(node, reset) {
     if (reset) {
       getUINativeModule().common.resetZIndex(node);
@@ -441,6 +539,17 @@ class OpacityModifier extends ModifierWithKey {
   constructor(value) {
     super(value);
   }
+  encodeBatch(batch, reset) {
+    if (reset) {
+      batch.push(3 /* AttributeBatchId.OPACITY */, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(3 /* AttributeBatchId.OPACITY */, false, this.value);
+    return true;
+  }
   applyPeer(node, reset) {
     if (reset) {
       getUINativeModule().common.resetOpacity(node);
@@ -1348,6 +1457,17 @@ class VisibilityModifier extends ModifierWithKey {
   constructor(value) {
     super(value);
   }
+  encodeBatch(batch, reset) {
+    if (reset) {
+      batch.push(5 /* AttributeBatchId.VISIBILITY */, true);
+      return true;
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    batch.push(5 /* AttributeBatchId.VISIBILITY */, false, this.value | 0);
+    return true;
+  }
   applyPeer(node, reset) {
     if (reset) {
       getUINativeModule().common.resetVisibility(node);
@@ -2042,11 +2162,14 @@ class ArkComponent {
         expiringItems.push(key);
       }
     });
+    const batch = AttributeBatch.getInstance();
+    batch.begin(this.nativePtr);
     this._modifiersWithKeys.forEach((value, key) => {
-      if (value.applyStage(this.nativePtr)) {
+      if (value.applyStage(this.nativePtr, batch)) {
         expiringItemsWithKeys.push(key);
       }
     });
+    batch.flush();
     expiringItems.forEach(key => {
       this._modifiers.delete(key);
     });
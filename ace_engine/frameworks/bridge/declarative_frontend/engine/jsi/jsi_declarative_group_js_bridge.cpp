@@ -125,7 +125,7 @@ shared_ptr<JsValue> JsiDeclarativeGroupJsBridge::ProcessJsRequest(const shared_p
         return res;
     }
 
-    FunctionCall functionCall(strFunctionName, arguments);
+    FunctionCall functionCall(std::move(strFunctionName), std::move(arguments));
     StandardFunctionCodec codec;
     std::vector<uint8_t> encodeBuf;
     if (!codec.EncodeFunctionCall(functionCall, encodeBuf)) {
@@ -180,7 +180,7 @@ shared_ptr<JsValue> JsiDeclarativeGroupJsBridge::ProcessJsRequestSync(const shar
         return res;
     }
 
-    FunctionCall functionCall(strFunctionName, arguments);
+    FunctionCall functionCall(std::move(strFunctionName), std::move(arguments));
     StandardFunctionCodec codec;
     std::vector<uint8_t> encodeBuf;
     if (!codec.EncodeFunctionCall(functionCall, encodeBuf)) {
@@ -197,12 +197,10 @@ shared_ptr<JsValue> JsiDeclarativeGroupJsBridge::ProcessJsRequestSync(const shar
     } else {
         return res;
     }
-    std::vector<uint8_t> messageData = std::vector<uint8_t>(resData, resData + position);
-
     shared_ptr<JsValue> callBackResult;
-    CodecData codecResult;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    std::string_view resultView;
+    if (codec.DecodePlatformMessage(resData, position > 0 ? static_cast<size_t>(position) : 0, resultView)) {
+        std::string resultString(resultView);
         if (resultString.empty()) {
             callBackResult = runtime->NewNull();
         } else {
@@ -334,7 +332,7 @@ ParseJsDataResult JsiDeclarativeGroupJsBridge::ParseJsPara(const shared_ptr<JsRu
         shared_ptr<JsValue> val = argv[i];
         if (val->IsString(runtime)) {
             CodecData arg(val->ToString(runtime));
-            arguments.push_back(arg);
+            arguments.push_back(std::move(arg));
         } else if (val->IsNumber(runtime)) {
             if (val->WithinInt32(runtime)) {
                 int32_t valInt = val->ToInt32(runtime);
@@ -359,8 +357,8 @@ ParseJsDataResult JsiDeclarativeGroupJsBridge::ParseJsPara(const shared_ptr<JsRu
             SetEventGroupCallBackFuncs(runtime, val, functionId, requestId);
         } else if (val->IsArray(runtime) || val->IsObject(runtime)) {
             std::string objStr = SerializationObjectToString(runtime, val);
-            CodecData arg(objStr);
-            arguments.push_back(arg);
+            CodecData arg(std::move(objStr));
+            arguments.push_back(std::move(arg));
         } else if (val->IsUndefined(runtime)) {
         } else {
             return ParseJsDataResult::PARSE_JS_ERR_UNSUPPORTED_TYPE;
@@ -373,14 +371,13 @@ void JsiDeclarativeGroupJsBridge::TriggerModuleJsCallback(
     int32_t callbackId, int32_t code, std::vector<uint8_t>&& messageData)
 {
     shared_ptr<JsValue> callBackResult;
-    CodecData codecResult;
+    std::string_view resultString;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    if (codec.DecodePlatformMessage(messageData.data(), messageData.size(), resultString)) {
         if (resultString.empty()) {
             callBackResult = runtime_->NewNull();
         } else {
-            callBackResult = runtime_->NewString(resultString);
+            callBackResult = runtime_->NewString(std::string(resultString));
         }
     } else {
         callBackResult = runtime_->NewString("invalid response data");
@@ -445,14 +442,13 @@ void JsiDeclarativeGroupJsBridge::CallEventJsCallback(int32_t callbackId, std::v
     shared_ptr<JsValue> global = runtime_->GetGlobal();
 
     shared_ptr<JsValue> callBackEvent;
-    CodecData codecEvent;
+    std::string_view eventString;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(eventData, codecEvent)) {
-        std::string eventString = codecEvent.GetStringValue();
+    if (codec.DecodePlatformMessage(eventData.data(), eventData.size(), eventString)) {
         if (eventString.empty()) {
             callBackEvent = runtime_->NewNull();
         } else {
-            callBackEvent = runtime_->NewString(eventString);
+            callBackEvent = runtime_->NewString(std::string(eventString));
         }
     } else {
         return;
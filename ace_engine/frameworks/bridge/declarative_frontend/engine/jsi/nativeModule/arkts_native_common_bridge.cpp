@@ -4433,4 +4433,69 @@ ArkUINativeModuleValue CommonBridge::ResetKeyBoardShortCut(ArkUIRuntimeCallInfo*
     GetArkUIInternalNodeAPI()->GetCommonModifier().ResetKeyBoardShortCut(nativeNode);
     return panda::JSValueRef::Undefined(vm);
 }
+
+ArkUINativeModuleValue CommonBridge::ApplyAttributeBatch(ArkUIRuntimeCallInfo* runtimeCallInfo)
+{
+    EcmaVM* vm = runtimeCallInfo->GetVM();
+    CHECK_NULL_RETURN(vm, panda::NativePointerRef::New(vm, nullptr));
+    Local<JSValueRef> firstArg = runtimeCallInfo->GetCallArgRef(NUM_0);
+    Local<JSValueRef> secondArg = runtimeCallInfo->GetCallArgRef(NUM_1);
+    Local<JSValueRef> thirdArg = runtimeCallInfo->GetCallArgRef(NUM_2);
+    void* nativeNode = firstArg->ToNativePointer(vm)->Value();
+    if (!secondArg->IsArrayBuffer() || !thirdArg->IsNumber()) {
+        return panda::JSValueRef::Undefined(vm);
+    }
+    Local<panda::ArrayBufferRef> buffer(secondArg);
+    const auto* data = static_cast<const double*>(buffer->GetBuffer());
+    CHECK_NULL_RETURN(data, panda::JSValueRef::Undefined(vm));
+    auto capacity = static_cast<size_t>(buffer->ByteLength(vm)) / sizeof(double);
+    auto length = std::min(static_cast<size_t>(thirdArg->Uint32Value(vm)), capacity);
+    auto modifier = GetArkUIInternalNodeAPI()->GetCommonModifier();
+    std::string calcStr;
+    size_t index = 0;
+    while (index + NUM_1 < length) {
+        auto id = static_cast<AttributeBatchId>(static_cast<int32_t>(data[index]));
+        bool reset = NearZero(data[index + NUM_1]);
+        index += NUM_2;
+        if (!reset && index >= length) {
+            break;
+        }
+        double value = reset ? 0.0 : data[index++];
+        switch (id) {
+            case AttributeBatchId::WIDTH:
+                reset ? modifier.ResetWidth(nativeNode)
+                      : modifier.SetWidth(nativeNode, std::max(value, 0.0), static_cast<int>(DimensionUnit::VP),
+                            calcStr.c_str());
+                break;
+            case AttributeBatchId::HEIGHT:
+                reset ? modifier.ResetHeight(nativeNode)
+                      : modifier.SetHeight(nativeNode, std::max(value, 0.0), static_cast<int>(DimensionUnit::VP),
+                            calcStr.c_str());
+                break;
+            case AttributeBatchId::BACKGROUND_COLOR:
+                reset ? modifier.ResetBackgroundColor(nativeNode)
+                      : modifier.SetBackgroundColor(
+                            nativeNode, ArkTSUtils::ColorAlphaAdapt(static_cast<uint32_t>(value)));
+                break;
+            case AttributeBatchId::OPACITY:
+                reset ? modifier.ResetOpacity(nativeNode) : modifier.SetOpacity(nativeNode, value);
+                break;
+            case AttributeBatchId::Z_INDEX:
+                reset ? modifier.ResetZIndex(nativeNode) : modifier.SetZIndex(nativeNode, static_cast<int32_t>(value));
+                break;
+            case AttributeBatchId::VISIBILITY: {
+                auto visibility = static_cast<int32_t>(value);
+                if (visibility < NUM_0 || visibility > NUM_2) {
+                    visibility = NUM_0;
+                }
+                reset ? modifier.ResetVisibility(nativeNode) : modifier.SetVisibility(nativeNode, visibility);
+                break;
+            }
+            default:
+                // the payload size of an unknown id is unknown, the rest of the buffer can't be decoded.
+                return panda::JSValueRef::Undefined(vm);
+        }
+    }
+    return panda::JSValueRef::Undefined(vm);
+}
 } // namespace OHOS::Ace::NG
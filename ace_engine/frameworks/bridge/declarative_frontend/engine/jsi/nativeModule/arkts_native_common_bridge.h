@@ -19,8 +19,25 @@
 #include "bridge/declarative_frontend/engine/jsi/nativeModule/arkts_native_api_bridge.h"
 
 namespace OHOS::Ace::NG {
+// Attribute ids of the command buffer decoded by CommonBridge::ApplyAttributeBatch,
+// keep in sync with AttributeBatchId in ArkComponent.ts.
+enum class AttributeBatchId : int32_t {
+    WIDTH = 0,
+    HEIGHT,
+    BACKGROUND_COLOR,
+    OPACITY,
+    Z_INDEX,
+    VISIBILITY,
+};
+
 class CommonBridge {
 public:
+    /**
+     * Applies several attributes to one node in a single call. Args are (node, ArrayBuffer, length), the
+     * buffer holds [length] doubles of commands [id, op, payload], op 0 resets the attribute and has no
+     * payload, op 1 sets it with one number as payload.
+     */
+    static ArkUINativeModuleValue ApplyAttributeBatch(ArkUIRuntimeCallInfo* runtimeCallInfo);
     static ArkUINativeModuleValue SetBackgroundColor(ArkUIRuntimeCallInfo* runtimeCallInfo);
     static ArkUINativeModuleValue ResetBackgroundColor(ArkUIRuntimeCallInfo* runtimeCallInfo);
     static ArkUINativeModuleValue SetWidth(ArkUIRuntimeCallInfo* runtimeCallInfo);
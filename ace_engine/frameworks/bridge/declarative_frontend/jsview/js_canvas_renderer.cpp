@@ -892,18 +892,31 @@ void JSCanvasRenderer::JsPutImageData(const JSCallbackInfo& info)
     ParseJsInt(heightValue, height);
 
     ImageData imageData;
-    std::vector<uint8_t> array;
-    ParseImageData(info, imageData, array);
-
-    for (int32_t i = std::max(imageData.dirtyY, 0); i < imageData.dirtyY + imageData.dirtyHeight; ++i) {
-        for (int32_t j = std::max(imageData.dirtyX, 0); j < imageData.dirtyX + imageData.dirtyWidth; ++j) {
-            uint32_t idx = 4 * (j + width * i);
-            if (array.size() > idx + 3) {
-                imageData.data.emplace_back(
-                    Color::FromARGB(array[idx + 3], array[idx], array[idx + 1], array[idx + 2]));
+    const uint8_t* buffer = nullptr;
+    size_t bufferSize = 0;
+    ParseImageData(info, imageData, buffer, bufferSize);
+
+    // convert the dirty rect once, the pixels are then shared with the paint task.
+    auto pixels = std::make_shared<std::vector<uint32_t>>();
+    int32_t colBegin = std::max(imageData.dirtyX, 0);
+    int32_t colEnd = imageData.dirtyX + imageData.dirtyWidth;
+    int64_t pixelCount = static_cast<int64_t>(bufferSize / sizeof(uint32_t));
+    if (buffer && colEnd > colBegin) {
+        for (int32_t i = std::max(imageData.dirtyY, 0); i < imageData.dirtyY + imageData.dirtyHeight; ++i) {
+            int64_t rowStart = static_cast<int64_t>(width) * i + colBegin;
+            int64_t count = std::min(static_cast<int64_t>(colEnd - colBegin), pixelCount - rowStart);
+            if (count <= 0) {
+                break;
             }
+            auto offset = pixels->size();
+            pixels->resize(offset + static_cast<size_t>(count));
+            ConvertRgbaToBgra(
+                buffer + rowStart * sizeof(uint32_t), pixels->data() + offset, static_cast<size_t>(count));
         }
     }
+    if (!pixels->empty()) {
+        imageData.pixels = std::move(pixels);
+    }
 
     BaseInfo baseInfo;
     baseInfo.canvasPattern = canvasPattern_;
@@ -913,7 +926,8 @@ void JSCanvasRenderer::JsPutImageData(const JSCallbackInfo& info)
     CanvasRendererModel::GetInstance()->PutImageData(baseInfo, imageData);
 }
 
-void JSCanvasRenderer::ParseImageData(const JSCallbackInfo& info, ImageData& imageData, std::vector<uint8_t>& array)
+void JSCanvasRenderer::ParseImageData(
+    const JSCallbackInfo& info, ImageData& imageData, const uint8_t*& buffer, size_t& bufferSize)
 {
     int32_t width = 0;
     int32_t height = 0;
@@ -928,10 +942,8 @@ void JSCanvasRenderer::ParseImageData(const JSCallbackInfo& info, ImageData& ima
         if (dataValue->IsUint8ClampedArray()) {
             JSRef<JSUint8ClampedArray> colorArray = JSRef<JSUint8ClampedArray>::Cast(dataValue);
             auto arrayBuffer = colorArray->GetArrayBuffer();
-            auto* buffer = static_cast<uint8_t*>(arrayBuffer->GetBuffer());
-            for (auto idx = 0; idx < arrayBuffer->ByteLength(); ++idx) {
-                array.emplace_back(buffer[idx]);
-            }
+            buffer = static_cast<const uint8_t*>(arrayBuffer->GetBuffer());
+            bufferSize = static_cast<size_t>(std::max(arrayBuffer->ByteLength(), 0));
         }
     }
 
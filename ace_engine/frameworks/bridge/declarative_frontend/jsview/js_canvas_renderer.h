@@ -49,7 +49,8 @@ public:
     static RefPtr<CanvasPath2D> JsMakePath2D(const JSCallbackInfo& info);
     void SetAntiAlias();
 
-    void ParseImageData(const JSCallbackInfo& info, ImageData& imageData, std::vector<uint8_t>& array);
+    void ParseImageData(
+        const JSCallbackInfo& info, ImageData& imageData, const uint8_t*& buffer, size_t& bufferSize);
     void ParseImageDataAsStr(const JSCallbackInfo& info, ImageData& imageData);
     void JsCloseImageBitmap(const std::string& src);
 
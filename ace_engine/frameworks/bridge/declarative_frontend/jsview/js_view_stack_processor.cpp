@@ -153,14 +153,16 @@ void JSViewStackProcessor::JsMoveDeletedElmtIds(const JSCallbackInfo& info)
     }
     JSRef<JSArray> jsArr = JSRef<JSArray>::Cast(info[0]);
 
+    auto elementRegister = ElementRegister::GetInstance();
     RemovedElementsType removedElements;
-    ElementRegister::GetInstance()->MoveRemovedItems(removedElements);
+    elementRegister->MoveRemovedItems(removedElements);
     size_t index = jsArr->Length();
     for (const auto& rmElmtId : removedElements) {
         // TS Object of type RemovedElementInfo:
         JSRef<JSObject> jsObject = JSRef<JSObject>::New();
-        jsObject->SetPropertyObject("elmtId", JSRef<JSVal>::Make(ToJSValue(rmElmtId.first)));
-        jsObject->SetPropertyObject("tag", JSRef<JSVal>::Make(ToJSValue(rmElmtId.second)));
+        jsObject->SetPropertyObject("elmtId", JSRef<JSVal>::Make(ToJSValue(rmElmtId.elmtId)));
+        jsObject->SetPropertyObject(
+            "tag", JSRef<JSVal>::Make(ToJSValue(elementRegister->GetRemovedTag(rmElmtId.tagId))));
         jsArr->SetValueAt(index++, jsObject);
     }
 }
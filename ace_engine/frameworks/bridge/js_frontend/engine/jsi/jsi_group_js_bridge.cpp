@@ -229,7 +229,7 @@ shared_ptr<JsValue> JsiGroupJsBridge::ProcessJsRequest(const shared_ptr<JsRuntim
         return res;
     }
 
-    FunctionCall functionCall(strFunctionName, arguments);
+    FunctionCall functionCall(std::move(strFunctionName), std::move(arguments));
     StandardFunctionCodec codec;
     std::vector<uint8_t> encodeBuf;
     if (!codec.EncodeFunctionCall(functionCall, encodeBuf)) {
@@ -299,7 +299,7 @@ shared_ptr<JsValue> JsiGroupJsBridge::ProcessJsRequestSync(const shared_ptr<JsRu
         return res;
     }
 
-    FunctionCall functionCall(strFunctionName, arguments);
+    FunctionCall functionCall(std::move(strFunctionName), std::move(arguments));
     StandardFunctionCodec codec;
     std::vector<uint8_t> encodeBuf;
     if (!codec.EncodeFunctionCall(functionCall, encodeBuf)) {
@@ -318,12 +318,10 @@ shared_ptr<JsValue> JsiGroupJsBridge::ProcessJsRequestSync(const shared_ptr<JsRu
         LOGW("Dispatcher Upgrade fail when dispatch request message to platform");
         return res;
     }
-    std::vector<uint8_t> messageData = std::vector<uint8_t>(resData, resData + position);
-
     shared_ptr<JsValue> callBackResult;
-    CodecData codecResult;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    std::string_view resultView;
+    if (codec.DecodePlatformMessage(resData, position > 0 ? static_cast<size_t>(position) : 0, resultView)) {
+        std::string resultString(resultView);
         LOGI("sync resultString = %{private}s", resultString.c_str());
         if (resultString.empty()) {
             callBackResult = runtime->NewNull();
@@ -470,7 +468,7 @@ ParseJsDataResult JsiGroupJsBridge::ParseJsPara(const shared_ptr<JsRuntime>& run
         shared_ptr<JsValue> val = argv[i];
         if (val->IsString(runtime)) {
             CodecData arg(val->ToString(runtime));
-            arguments.push_back(arg);
+            arguments.push_back(std::move(arg));
         } else if (val->IsNumber(runtime)) {
             if (val->WithinInt32(runtime)) {
                 int32_t valInt = val->ToInt32(runtime);
@@ -495,8 +493,8 @@ ParseJsDataResult JsiGroupJsBridge::ParseJsPara(const shared_ptr<JsRuntime>& run
             SetEventGroupCallBackFuncs(runtime, val, functionId, requestId);
         } else if (val->IsArray(runtime) || val->IsObject(runtime)) {
             std::string objStr = SerializationObjectToString(runtime, val);
-            CodecData arg(objStr);
-            arguments.push_back(arg);
+            CodecData arg(std::move(objStr));
+            arguments.push_back(std::move(arg));
         } else if (val->IsUndefined(runtime)) {
         } else {
             LOGE("Process callNative para type: unsupported type");
@@ -509,14 +507,13 @@ ParseJsDataResult JsiGroupJsBridge::ParseJsPara(const shared_ptr<JsRuntime>& run
 void JsiGroupJsBridge::TriggerModuleJsCallback(int32_t callbackId, int32_t code, std::vector<uint8_t>&& messageData)
 {
     shared_ptr<JsValue> callBackResult;
-    CodecData codecResult;
+    std::string_view resultString;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    if (codec.DecodePlatformMessage(messageData.data(), messageData.size(), resultString)) {
         if (resultString.empty()) {
             callBackResult = runtime_->NewNull();
         } else {
-            callBackResult = runtime_->NewString(resultString);
+            callBackResult = runtime_->NewString(std::string(resultString));
         }
     } else {
         LOGE("trigger JS resolve callback function error, decode message fail, callbackId:%{private}d", callbackId);
@@ -593,14 +590,13 @@ void JsiGroupJsBridge::CallEventJsCallback(int32_t callbackId, std::vector<uint8
     shared_ptr<JsValue> global = runtime_->GetGlobal();
 
     shared_ptr<JsValue> callBackEvent;
-    CodecData codecEvent;
+    std::string_view eventString;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(eventData, codecEvent)) {
-        std::string eventString = codecEvent.GetStringValue();
+    if (codec.DecodePlatformMessage(eventData.data(), eventData.size(), eventString)) {
         if (eventString.empty()) {
             callBackEvent = runtime_->NewNull();
         } else {
-            callBackEvent = runtime_->NewString(eventString);
+            callBackEvent = runtime_->NewString(std::string(eventString));
         }
     } else {
         LOGE("trigger Js callback function error, decode message fail, callbackId:%{private}d", callbackId);
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "frameworks/bridge/codec/byte_buffer_operator.h"
+#include "frameworks/bridge/codec/function_call.h"
+#include "frameworks/bridge/codec/standard_codec_buffer_operator.h"
+#include "frameworks/bridge/codec/standard_function_codec.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+const std::string MESSAGE = "{\"code\":0,\"data\":\"test\"}";
+const std::string FUNCTION_NAME = "testFunction";
+constexpr int32_t INT_VALUE = 10;
+
+std::vector<uint8_t> EncodeMessage(const CodecData& message)
+{
+    std::vector<uint8_t> buffer;
+    StandardCodecBufferWriter writer(buffer);
+    writer.WriteData(message);
+    return buffer;
+}
+} // namespace
+
+class StandardFunctionCodecTest : public testing::Test {
+public:
+    static void SetUpTestCase() {}
+    static void TearDownTestCase() {}
+    void SetUp() override {}
+    void TearDown() override {}
+};
+
+/**
+ * @tc.name: StandardFunctionCodecTest001
+ * @tc.desc: Decode a string message as a view into the buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(StandardFunctionCodecTest, StandardFunctionCodecTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Encode a string message and decode it as a view.
+     * @tc.expected: step1. The view equals the message and points into the buffer.
+     */
+    auto buffer = EncodeMessage(CodecData(MESSAGE));
+    StandardFunctionCodec codec;
+    std::string_view message;
+    EXPECT_TRUE(codec.DecodePlatformMessage(buffer.data(), buffer.size(), message));
+    EXPECT_EQ(message, MESSAGE);
+    EXPECT_GE(message.data(), reinterpret_cast<const char*>(buffer.data()));
+    EXPECT_LE(message.data() + message.size(), reinterpret_cast<const char*>(buffer.data() + buffer.size()));
+
+    /**
+     * @tc.steps: step2. Decode the same buffer as CodecData.
+     * @tc.expected: step2. Both decoding paths give the same string.
+     */
+    CodecData codecData;
+    EXPECT_TRUE(codec.DecodePlatformMessage(buffer, codecData));
+    EXPECT_EQ(codecData.GetStringValue(), std::string(message));
+
+    /**
+     * @tc.steps: step3. Encode an object message and decode it as a view.
+     * @tc.expected: step3. The object is read as a string as well.
+     */
+    buffer = EncodeMessage(CodecData(MESSAGE, BufferDataType::TYPE_OBJECT));
+    EXPECT_TRUE(codec.DecodePlatformMessage(buffer.data(), buffer.size(), message));
+    EXPECT_EQ(message, MESSAGE);
+}
+
+/**
+ * @tc.name: StandardFunctionCodecTest002
+ * @tc.desc: Decode messages which are not strings or are broken as a view
+ * @tc.type: FUNC
+ */
+HWTEST_F(StandardFunctionCodecTest, StandardFunctionCodecTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Decode an int message as a view.
+     * @tc.expected: step1. The message is skipped and the view is empty.
+     */
+    auto buffer = EncodeMessage(CodecData(INT_VALUE));
+    StandardFunctionCodec codec;
+    std::string_view message = MESSAGE;
+    EXPECT_TRUE(codec.DecodePlatformMessage(buffer.data(), buffer.size(), message));
+    EXPECT_TRUE(message.empty());
+
+    /**
+     * @tc.steps: step2. Decode a string message whose buffer is cut.
+     * @tc.expected: step2. Decoding fails instead of reading out of the buffer.
+     */
+    buffer = EncodeMessage(CodecData(MESSAGE));
+    EXPECT_FALSE(codec.DecodePlatformMessage(buffer.data(), buffer.size() - 1, message));
+
+    /**
+     * @tc.steps: step3. Decode an empty buffer and a null buffer.
+     * @tc.expected: step3. Decoding fails.
+     */
+    EXPECT_FALSE(codec.DecodePlatformMessage(buffer.data(), 0, message));
+    EXPECT_FALSE(codec.DecodePlatformMessage(nullptr, buffer.size(), message));
+}
+
+/**
+ * @tc.name: StandardFunctionCodecTest003
+ * @tc.desc: Read an array whose length exceeds the buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(StandardFunctionCodecTest, StandardFunctionCodecTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Write an array length larger than the data behind it.
+     * @tc.expected: step1. Reading fails and the view is left unset.
+     */
+    std::vector<uint8_t> buffer;
+    ByteBufferWriter writer(buffer);
+    writer.WriteData(INT32_MAX);
+    writer.WriteData(static_cast<uint8_t>(0));
+    ByteBufferReader reader(buffer);
+    const int32_t* data = nullptr;
+    size_t length = 0;
+    EXPECT_FALSE(reader.ReadArrayView(data, length));
+    EXPECT_EQ(data, nullptr);
+    EXPECT_EQ(length, 0u);
+}
+
+/**
+ * @tc.name: StandardFunctionCodecTest004
+ * @tc.desc: Encode a function call and decode it back
+ * @tc.type: FUNC
+ */
+HWTEST_F(StandardFunctionCodecTest, StandardFunctionCodecTest004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Encode a function call with a string and an int argument.
+     * @tc.expected: step1. The encoded size equals the reserved size.
+     */
+    std::vector<CodecData> args;
+    args.emplace_back(MESSAGE);
+    args.emplace_back(INT_VALUE);
+    FunctionCall functionCall(FUNCTION_NAME, args);
+    StandardFunctionCodec codec;
+    std::vector<uint8_t> buffer;
+    EXPECT_TRUE(codec.EncodeFunctionCall(functionCall, buffer));
+    size_t encodedSize = StandardCodecBufferWriter::GetEncodedSize(CodecData(FUNCTION_NAME)) + sizeof(uint8_t);
+    for (const auto& arg : args) {
+        encodedSize += StandardCodecBufferWriter::GetEncodedSize(arg);
+    }
+    EXPECT_EQ(buffer.size(), encodedSize);
+
+    /**
+     * @tc.steps: step2. Decode the buffer.
+     * @tc.expected: step2. The function name and arguments are the same as encoded.
+     */
+    FunctionCall result;
+    EXPECT_TRUE(codec.DecodeFunctionCall(buffer, result));
+    EXPECT_EQ(result.GetFuncName(), FUNCTION_NAME);
+    ASSERT_EQ(result.GetArgs().size(), args.size());
+    EXPECT_EQ(result.GetArgs()[0].GetStringValue(), MESSAGE);
+    EXPECT_EQ(result.GetArgs()[1].GetIntValue(), INT_VALUE);
+}
+} // namespace OHOS::Ace::Framework
@@ -98,6 +98,8 @@ void Animator::AttachScheduler(const WeakPtr<PipelineBase>& context)
         controller->OnFrame(duration);
     };
     scheduler_ = SchedulerBuilder::Build(callback, context);
+    // the animators of a pipeline share one schedule task instead of adding their own every frame.
+    scheduler_->SetBatched(true);
 }
 
 bool Animator::AttachSchedulerOnContainer()
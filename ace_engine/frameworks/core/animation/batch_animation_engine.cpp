@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/animation/batch_animation_engine.h"
+
+#include <algorithm>
+
+#include "base/utils/utils.h"
+#include "core/animation/scheduler.h"
+#include "core/pipeline/pipeline_base.h"
+
+namespace OHOS::Ace {
+
+void BatchAnimationEngine::AddScheduler(const WeakPtr<Scheduler>& scheduler, uint64_t startupTimestamp)
+{
+    schedulers_.emplace_back(scheduler);
+    startupTimestamps_.emplace_back(startupTimestamp);
+    elapsedTimes_.emplace_back(0);
+    if (scheduleId_ == 0 && !isTicking_) {
+        ScheduleNextFrame();
+    }
+}
+
+void BatchAnimationEngine::RemoveScheduler(const Scheduler* scheduler)
+{
+    auto iter = std::find(schedulers_.begin(), schedulers_.end(), scheduler);
+    if (iter == schedulers_.end()) {
+        return;
+    }
+    if (isTicking_) {
+        iter->Reset();
+        return;
+    }
+    RemoveAt(static_cast<size_t>(iter - schedulers_.begin()));
+    if (schedulers_.empty() && scheduleId_ != 0) {
+        auto context = context_.Upgrade();
+        CHECK_NULL_VOID(context);
+        context->RemoveScheduleTask(scheduleId_);
+        scheduleId_ = 0;
+    }
+}
+
+void BatchAnimationEngine::OnFrame(uint64_t nanoTimestamp)
+{
+    // Consume previous schedule as default.
+    scheduleId_ = 0;
+    auto count = schedulers_.size();
+    for (size_t i = 0; i < count; ++i) {
+        elapsedTimes_[i] = Scheduler::ConsumeElapsedTime(startupTimestamps_[i], nanoTimestamp);
+    }
+    // schedulers started by the callbacks are appended, they are ticked from the next frame.
+    isTicking_ = true;
+    for (size_t i = 0; i < count; ++i) {
+        auto scheduler = schedulers_[i].Upgrade();
+        if (scheduler) {
+            scheduler->Tick(elapsedTimes_[i]);
+        }
+    }
+    isTicking_ = false;
+    RemoveExpired();
+    if (!schedulers_.empty()) {
+        ScheduleNextFrame();
+    }
+}
+
+void BatchAnimationEngine::RemoveAt(size_t index)
+{
+    auto last = schedulers_.size() - 1;
+    if (index != last) {
+        schedulers_[index] = std::move(schedulers_[last]);
+        startupTimestamps_[index] = startupTimestamps_[last];
+        elapsedTimes_[index] = elapsedTimes_[last];
+    }
+    schedulers_.pop_back();
+    startupTimestamps_.pop_back();
+    elapsedTimes_.pop_back();
+}
+
+void BatchAnimationEngine::RemoveExpired()
+{
+    // the schedulers removed while ticking or released without being stopped.
+    for (auto index = schedulers_.size(); index > 0; --index) {
+        if (schedulers_[index - 1].Invalid()) {
+            RemoveAt(index - 1);
+        }
+    }
+}
+
+void BatchAnimationEngine::ScheduleNextFrame()
+{
+    auto context = context_.Upgrade();
+    CHECK_NULL_VOID(context);
+    scheduleId_ = context->AddScheduleTask(AceType::Claim(this));
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_BATCH_ANIMATION_ENGINE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_BATCH_ANIMATION_ENGINE_H
+
+#include <cstdint>
+#include <vector>
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+#include "base/utils/macros.h"
+#include "core/animation/schedule_task.h"
+
+namespace OHOS::Ace {
+
+class PipelineBase;
+class Scheduler;
+
+// Ticks the batched schedulers of a pipeline, those of the animators, from one schedule task. The schedulers and
+// their startup timestamps are kept in parallel arrays, the elapsed times of all of them are taken in one pass per
+// frame before their callbacks are run.
+class ACE_FORCE_EXPORT BatchAnimationEngine : public ScheduleTask {
+    DECLARE_ACE_TYPE(BatchAnimationEngine, ScheduleTask);
+
+public:
+    explicit BatchAnimationEngine(const WeakPtr<PipelineBase>& context) : context_(context) {}
+    ~BatchAnimationEngine() override = default;
+
+    void AddScheduler(const WeakPtr<Scheduler>& scheduler, uint64_t startupTimestamp);
+
+    // A scheduler removed while ticking is dropped after the pass.
+    void RemoveScheduler(const Scheduler* scheduler);
+
+    size_t GetActiveCount() const
+    {
+        return schedulers_.size();
+    }
+
+    void OnFrame(uint64_t nanoTimestamp) override;
+
+private:
+    void RemoveAt(size_t index);
+    void RemoveExpired();
+    void ScheduleNextFrame();
+
+    // parallel arrays, all of the same size.
+    std::vector<WeakPtr<Scheduler>> schedulers_;
+    std::vector<uint64_t> startupTimestamps_;
+    std::vector<uint64_t> elapsedTimes_;
+
+    bool isTicking_ = false;
+    uint32_t scheduleId_ = 0;
+    WeakPtr<PipelineBase> context_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(BatchAnimationEngine);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_BATCH_ANIMATION_ENGINE_H
@@ -33,7 +33,11 @@ void Scheduler::Start()
     }
     isRunning_ = true;
     startupTimestamp_ = context->GetTimeFromExternalTimer();
-    scheduleId_ = static_cast<int32_t>(context->AddScheduleTask(AceType::Claim(this)));
+    if (isBatched_) {
+        context->GetBatchAnimationEngine()->AddScheduler(WeakClaim(this), startupTimestamp_);
+    } else {
+        scheduleId_ = static_cast<int32_t>(context->AddScheduleTask(AceType::Claim(this)));
+    }
 
     displaySync_ = AceType::MakeRefPtr<UIDisplaySync>();
     displaySync_->RegisterOnFrameWithTimestamp([weak = WeakClaim(this)] (uint64_t nanoTimestamp) {
@@ -54,6 +58,10 @@ void Scheduler::Stop()
         return;
     }
     isRunning_ = false;
+    if (isBatched_) {
+        context->GetBatchAnimationEngine()->RemoveScheduler(this);
+        return;
+    }
     context->RemoveScheduleTask(scheduleId_);
     scheduleId_ = 0;
 }
@@ -65,12 +73,7 @@ void Scheduler::OnFrame(uint64_t nanoTimestamp)
     }
 
     // Refresh the startup time every frame.
-    uint64_t elapsedTimeMs = 0;
-    if (nanoTimestamp > startupTimestamp_) {
-        static const uint64_t milliToNano = 1000000;
-        elapsedTimeMs = (nanoTimestamp - startupTimestamp_) / milliToNano;
-        startupTimestamp_ += elapsedTimeMs * milliToNano;
-    }
+    uint64_t elapsedTimeMs = ConsumeElapsedTime(startupTimestamp_, nanoTimestamp);
 
     // Consume previous schedule as default.
     scheduleId_ = 0;
@@ -90,6 +93,16 @@ void Scheduler::OnFrame(uint64_t nanoTimestamp)
     }
 }
 
+void Scheduler::Tick(uint64_t elapsedTimeMs)
+{
+    if (!isRunning_) {
+        return;
+    }
+    if (callback_) {
+        callback_(elapsedTimeMs);
+    }
+}
+
 bool Scheduler::Animate(const AnimationOption& option, const RefPtr<Curve>& curve,
     const std::function<void()> propertyCallback, const std::function<void()>& finishCallBack)
 {
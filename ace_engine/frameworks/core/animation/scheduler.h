@@ -47,6 +47,28 @@ public:
 
     void OnFrame(uint64_t nanoTimestamp) override;
 
+    // Runs the frame callback with the time elapsed since the last frame, called by BatchAnimationEngine.
+    void Tick(uint64_t elapsedTimeMs);
+
+    // Moves [startupTimestamp] to the frame at [nanoTimestamp] and returns the elapsed milliseconds.
+    static uint64_t ConsumeElapsedTime(uint64_t& startupTimestamp, uint64_t nanoTimestamp)
+    {
+        uint64_t elapsedTimeMs = 0;
+        if (nanoTimestamp > startupTimestamp) {
+            static const uint64_t milliToNano = 1000000;
+            elapsedTimeMs = (nanoTimestamp - startupTimestamp) / milliToNano;
+            startupTimestamp += elapsedTimeMs * milliToNano;
+        }
+        return elapsedTimeMs;
+    }
+
+    // A batched scheduler is ticked by the BatchAnimationEngine of the pipeline instead of adding its own schedule
+    // task every frame. Set it before Start.
+    void SetBatched(bool isBatched)
+    {
+        isBatched_ = isBatched;
+    }
+
     void Start();
 
     void Stop();
@@ -77,6 +99,7 @@ public:
 private:
     int32_t scheduleId_ = 0;
     bool isRunning_ = false;
+    bool isBatched_ = false;
     uint64_t startupTimestamp_ = 0;
     OnFrameCallback callback_ = nullptr;
     WeakPtr<PipelineBase> context_;
@@ -16,6 +16,7 @@
 
 #include "base/json/json_util.h"
 #include "base/log/log_wrapper.h"
+#include "base/thread/background_task_executor.h"
 #include "base/utils/string_utils.h"
 #include "base/utils/time_util.h"
 #include "core/common/container.h"
@@ -226,9 +227,45 @@ const std::string& EventRecorder::GetNavDstName() const
     return navDstName_;
 }
 
+int32_t EventRecorder::GetPageUrlId()
+{
+    if (pageUrlId_ < 0) {
+        pageUrlId_ = InternString(GetPageUrl());
+    }
+    return pageUrlId_;
+}
+
+int32_t EventRecorder::GetNavDstNameId()
+{
+    if (navDstNameId_ < 0) {
+        navDstNameId_ = InternString(navDstName_);
+    }
+    return navDstNameId_;
+}
+
+int32_t EventRecorder::InternString(const std::string& value)
+{
+    std::lock_guard<std::mutex> lock(recordLock_);
+    auto result = stringIds_.emplace(value, static_cast<int32_t>(strings_.size()));
+    if (result.second) {
+        strings_.emplace_back(value);
+    }
+    return result.first->second;
+}
+
+const std::string& EventRecorder::GetInternedString(int32_t id) const
+{
+    static const std::string emptyString;
+    if (id < 0 || id >= static_cast<int32_t>(strings_.size())) {
+        return emptyString;
+    }
+    return strings_[id];
+}
+
 void EventRecorder::OnPageShow(const std::string& pageUrl, const std::string& param)
 {
     pageUrl_ = pageUrl;
+    pageUrlId_ = -1;
     NodeDataCache::Get().OnPageShow(pageUrl);
     Recorder::EventParamsBuilder builder;
     builder.SetType(std::to_string(PageEventType::ROUTER_PAGE))
@@ -289,6 +326,7 @@ void EventRecorder::OnEvent(EventParamsBuilder&& builder)
 void EventRecorder::OnNavDstShow(EventParamsBuilder&& builder)
 {
     navDstName_ = builder.GetText();
+    navDstNameId_ = -1;
     navShowTime_ = GetCurrentTimestamp();
     builder.SetPageUrl(GetPageUrl());
     builder.SetType(std::to_string(PageEventType::NAV_PAGE));
@@ -301,6 +339,7 @@ void EventRecorder::OnNavDstHide(EventParamsBuilder&& builder)
 {
     if (builder.GetText() == navDstName_) {
         navDstName_ = "";
+        navDstNameId_ = -1;
         if (navShowTime_ > 0) {
             int64_t duration = GetCurrentTimestamp() - navShowTime_;
             builder.SetExtra(KEY_DURATION, std::to_string(duration));
@@ -314,10 +353,38 @@ void EventRecorder::OnNavDstHide(EventParamsBuilder&& builder)
         EventCategory::CATEGORY_PAGE, static_cast<int32_t>(EventType::PAGE_HIDE), std::move(params));
 }
 
-void EventRecorder::OnExposure(EventParamsBuilder&& builder)
+void EventRecorder::OnExposure(const ExposureRecord& record)
 {
-    auto params = builder.build();
-    EventController::Get().NotifyEvent(
-        EventCategory::CATEGORY_EXPOSURE, static_cast<int32_t>(EventType::EXPOSURE), std::move(params));
+    std::lock_guard<std::mutex> lock(recordLock_);
+    exposureRecords_.emplace_back(record);
+    if (isFlushPosted_) {
+        return;
+    }
+    // records added before the task runs are delivered in the same batch.
+    isFlushPosted_ =
+        BackgroundTaskExecutor::GetInstance().PostTask([]() { EventRecorder::Get().FlushExposureRecords(); });
+}
+
+void EventRecorder::FlushExposureRecords()
+{
+    std::vector<std::shared_ptr<std::unordered_map<std::string, std::string>>> paramsList;
+    {
+        std::lock_guard<std::mutex> lock(recordLock_);
+        isFlushPosted_ = false;
+        paramsList.reserve(exposureRecords_.size());
+        for (const auto& record : exposureRecords_) {
+            EventParamsBuilder builder;
+            builder.SetId(GetInternedString(record.id))
+                .SetPageUrl(GetInternedString(record.pageUrl))
+                .SetNavDst(GetInternedString(record.navDstName))
+                .SetExtra(KEY_DURATION, std::to_string(record.duration));
+            paramsList.emplace_back(builder.build());
+        }
+        exposureRecords_.clear();
+    }
+    for (const auto& params : paramsList) {
+        EventController::Get().NotifyEventSync(
+            EventCategory::CATEGORY_EXPOSURE, static_cast<int32_t>(EventType::EXPOSURE), params);
+    }
 }
 } // namespace OHOS::Ace::Recorder
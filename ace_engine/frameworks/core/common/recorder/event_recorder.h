@@ -16,8 +16,10 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_RECORDER_EVENT_RECORDER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_RECORDER_EVENT_RECORDER_H
 
+#include <mutex>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "base/thread/task_executor.h"
 #include "base/utils/noncopyable.h"
@@ -123,6 +125,15 @@ private:
 
 std::string MapToString(const std::shared_ptr<std::unordered_map<std::string, std::string>>& input);
 
+// fixed size record of an exposure event, its strings are ids interned by EventRecorder. Recording it on the UI thread
+// builds no params, they are built on a background thread when a batch of records is delivered.
+struct ExposureRecord {
+    int32_t id = -1;
+    int32_t pageUrl = -1;
+    int32_t navDstName = -1;
+    int64_t duration = 0;
+};
+
 class EventRecorder final {
 public:
     ~EventRecorder() = default;
@@ -138,6 +149,9 @@ public:
     int32_t GetContainerId();
     const std::string& GetPageUrl();
     const std::string& GetNavDstName() const;
+    int32_t GetPageUrlId();
+    int32_t GetNavDstNameId();
+    int32_t InternString(const std::string& value);
 
     void OnPageShow(const std::string& pageUrl, const std::string& param);
     void OnPageHide(const std::string& pageUrl, const int64_t duration);
@@ -146,12 +160,15 @@ public:
     void OnEvent(EventParamsBuilder&& builder);
     void OnNavDstShow(EventParamsBuilder&& builder);
     void OnNavDstHide(EventParamsBuilder&& builder);
-    void OnExposure(EventParamsBuilder&& builder);
+    void OnExposure(const ExposureRecord& record);
 
 private:
     EventRecorder();
     friend class EventConfig;
 
+    const std::string& GetInternedString(int32_t id) const;
+    void FlushExposureRecords();
+
     EventSwitch eventSwitch_;
 
     bool pageEnable_ = true;
@@ -165,6 +182,16 @@ private:
     std::string pageUrl_;
     std::string navDstName_;
     int64_t navShowTime_ = -1;
+    int32_t pageUrlId_ = -1;
+    int32_t navDstNameId_ = -1;
+
+    // guards the interned strings and the records waiting to be delivered.
+    std::mutex recordLock_;
+    // page urls, navigation destinations and configured inspector ids, they are few and never released.
+    std::unordered_map<std::string, int32_t> stringIds_;
+    std::vector<std::string> strings_;
+    std::vector<ExposureRecord> exposureRecords_;
+    bool isFlushPosted_ = false;
 
     RefPtr<TaskExecutor> taskExecutor_;
 
@@ -42,17 +42,20 @@ void ExposureProcessor::OnVisibleChange(bool isVisible)
     auto current = GetCurrentTimestamp();
     if (isVisible) {
         startTime_ = current;
-        pageUrl_ = EventRecorder::Get().GetPageUrl();
-        navDstName_ = EventRecorder::Get().GetNavDstName();
+        pageUrlId_ = EventRecorder::Get().GetPageUrlId();
+        navDstNameId_ = EventRecorder::Get().GetNavDstNameId();
     } else if (startTime_ > 0) {
         auto duration = current - startTime_;
         if (duration >= cfg_.duration) {
-            EventParamsBuilder builder;
-            builder.SetId(cfg_.id)
-                .SetPageUrl(pageUrl_)
-                .SetNavDst(navDstName_)
-                .SetExtra(KEY_DURATION, std::to_string(duration));
-            EventRecorder::Get().OnExposure(std::move(builder));
+            if (idIndex_ < 0) {
+                idIndex_ = EventRecorder::Get().InternString(cfg_.id);
+            }
+            ExposureRecord record;
+            record.id = idIndex_;
+            record.pageUrl = pageUrlId_;
+            record.navDstName = navDstNameId_;
+            record.duration = duration;
+            EventRecorder::Get().OnExposure(record);
         }
     }
 }
@@ -39,8 +39,9 @@ private:
     ExposureCfg cfg_ = { "", 0.0, 0 };
     int64_t startTime_ = -1;
 
-    std::string pageUrl_;
-    std::string navDstName_;
+    int32_t idIndex_ = -1;
+    int32_t pageUrlId_ = -1;
+    int32_t navDstNameId_ = -1;
 
     ACE_DISALLOW_COPY_AND_MOVE(ExposureProcessor);
 };
@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_BASE_PROPERTIES_PAINT_STATE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_BASE_PROPERTIES_PAINT_STATE_H
 
+#include <memory>
+
 #include "base/memory/ace_type.h"
 #include "core/components/common/layout/constants.h"
 #include "core/components/common/properties/color.h"
@@ -104,8 +106,43 @@ struct ImageData {
     int32_t dirtyWidth = 0;
     int32_t dirtyHeight = 0;
     std::vector<Color> data;
+    // pixels of the dirty rect packed like Color::GetValue, used instead of data when set. It is shared by the
+    // copies of the image data, so the recorded paint task holds a reference instead of a copy of the pixels.
+    std::shared_ptr<std::vector<uint32_t>> pixels;
 };
 
+// Packs RGBA bytes into Color::GetValue values byte by byte, so the result doesn't depend on the host byte order.
+// The loops are branch free so the compiler vectorizes them.
+inline void ConvertRgbaToBgra(const uint8_t* src, uint32_t* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* rgba = src + i * sizeof(uint32_t);
+        dst[i] = (static_cast<uint32_t>(rgba[3]) << 24) | (static_cast<uint32_t>(rgba[0]) << 16) |
+                 (static_cast<uint32_t>(rgba[1]) << 8) | static_cast<uint32_t>(rgba[2]);
+    }
+}
+
+// Packs the BGRA bytes of a bitmap into Color::GetValue values.
+inline void PackBgraBytes(const uint8_t* src, uint32_t* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        const uint8_t* bgra = src + i * sizeof(uint32_t);
+        dst[i] = (static_cast<uint32_t>(bgra[3]) << 24) | (static_cast<uint32_t>(bgra[2]) << 16) |
+                 (static_cast<uint32_t>(bgra[1]) << 8) | static_cast<uint32_t>(bgra[0]);
+    }
+}
+
+inline void ConvertBgraToRgba(const uint32_t* src, uint8_t* dst, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        uint8_t* rgba = dst + i * sizeof(uint32_t);
+        rgba[0] = static_cast<uint8_t>(src[i] >> 16);
+        rgba[1] = static_cast<uint8_t>(src[i] >> 8);
+        rgba[2] = static_cast<uint8_t>(src[i]);
+        rgba[3] = static_cast<uint8_t>(src[i] >> 24);
+    }
+}
+
 struct TextMetrics {
     double width;
     double height;
@@ -66,6 +66,30 @@ bool IsGlobalResource(uint32_t resId)
 
 } // namespace
 
+template<class Key, class Value, class Resolver>
+Value ThemeConstants::GetResolvedValue(
+    std::unordered_map<Key, Value> ResolvedValues::*member, const Key& key, const Resolver& resolver) const
+{
+    ResolvedValues* values = nullptr;
+    uint32_t epoch = 0;
+    {
+        std::lock_guard<std::mutex> lock(resolvedMutex_);
+        values = &resolvedValues_[resourceOwner_];
+        auto iter = (values->*member).find(key);
+        if (iter != (values->*member).end()) {
+            return iter->second;
+        }
+        epoch = resolvedEpoch_;
+    }
+    auto value = resolver();
+    std::lock_guard<std::mutex> lock(resolvedMutex_);
+    // Drop the value if the configuration changed while resolving it.
+    if (epoch == resolvedEpoch_) {
+        (values->*member).emplace(key, value);
+    }
+    return value;
+}
+
 void ThemeConstants::InitDeviceType()
 {
     g_deviceType = SystemProperties::GetDeviceType();
@@ -96,7 +120,7 @@ Color ThemeConstants::GetColor(uint32_t key) const
         if (!resAdapter_) {
             return ERROR_VALUE_COLOR;
         }
-        return resAdapter_->GetColor(key);
+        return GetResolvedValue(&ResolvedValues::colors, key, [this, key]() { return resAdapter_->GetColor(key); });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::COLOR)) {
@@ -114,7 +138,8 @@ Color ThemeConstants::GetColorByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_COLOR;
     }
-    return resAdapter_->GetColorByName(resName);
+    return GetResolvedValue(
+        &ResolvedValues::colorsByName, resName, [this, &resName]() { return resAdapter_->GetColorByName(resName); });
 }
 
 Dimension ThemeConstants::GetDimension(uint32_t key) const
@@ -123,11 +148,13 @@ Dimension ThemeConstants::GetDimension(uint32_t key) const
         if (!resAdapter_) {
             return ERROR_VALUE_DIMENSION;
         }
-        auto result = resAdapter_->GetDimension(key);
-        if (NearZero(result.Value())) {
-            result = StringUtils::StringToDimension(resAdapter_->GetString(key));
-        }
-        return result;
+        return GetResolvedValue(&ResolvedValues::dimensions, key, [this, key]() {
+            auto result = resAdapter_->GetDimension(key);
+            if (NearZero(result.Value())) {
+                result = StringUtils::StringToDimension(resAdapter_->GetString(key));
+            }
+            return result;
+        });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::DIMENSION)) {
@@ -146,11 +173,13 @@ Dimension ThemeConstants::GetDimensionByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_DIMENSION;
     }
-    auto result = resAdapter_->GetDimensionByName(resName);
-    if (NearZero(result.Value())) {
-        result = StringUtils::StringToDimension(resAdapter_->GetStringByName(resName));
-    }
-    return result;
+    return GetResolvedValue(&ResolvedValues::dimensionsByName, resName, [this, &resName]() {
+        auto result = resAdapter_->GetDimensionByName(resName);
+        if (NearZero(result.Value())) {
+            result = StringUtils::StringToDimension(resAdapter_->GetStringByName(resName));
+        }
+        return result;
+    });
 }
 
 int32_t ThemeConstants::GetInt(uint32_t key) const
@@ -159,7 +188,7 @@ int32_t ThemeConstants::GetInt(uint32_t key) const
         if (!resAdapter_) {
             return ERROR_VALUE_INT;
         }
-        return resAdapter_->GetInt(key);
+        return GetResolvedValue(&ResolvedValues::ints, key, [this, key]() { return resAdapter_->GetInt(key); });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::INT)) {
@@ -177,7 +206,8 @@ int32_t ThemeConstants::GetIntByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_INT;
     }
-    return resAdapter_->GetIntByName(resName);
+    return GetResolvedValue(
+        &ResolvedValues::intsByName, resName, [this, &resName]() { return resAdapter_->GetIntByName(resName); });
 }
 
 double ThemeConstants::GetDouble(uint32_t key) const
@@ -186,7 +216,7 @@ double ThemeConstants::GetDouble(uint32_t key) const
         if (!resAdapter_) {
             return ERROR_VALUE_DOUBLE;
         }
-        return resAdapter_->GetDouble(key);
+        return GetResolvedValue(&ResolvedValues::doubles, key, [this, key]() { return resAdapter_->GetDouble(key); });
     }
     const auto& valueWrapper = GetValue(key);
     if (!ValueTypeMatch(valueWrapper, key, ThemeConstantsType::DOUBLE)) {
@@ -204,7 +234,8 @@ double ThemeConstants::GetDoubleByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_DOUBLE;
     }
-    return resAdapter_->GetDoubleByName(resName);
+    return GetResolvedValue(
+        &ResolvedValues::doublesByName, resName, [this, &resName]() { return resAdapter_->GetDoubleByName(resName); });
 }
 
 std::string ThemeConstants::GetString(uint32_t key) const
@@ -448,6 +479,7 @@ void ThemeConstants::LoadTheme(int32_t themeId)
     if (!resAdapter_) {
         return;
     }
+    InvalidateResolvedValues();
     currentThemeStyle_ = resAdapter_->GetTheme(themeId);
     if (currentThemeStyle_) {
         currentThemeStyle_->SetName(std::to_string(themeId));
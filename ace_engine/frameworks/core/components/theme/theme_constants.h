@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_THEME_CONSTANTS_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_THEME_CONSTANTS_H
 
+#include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include "base/geometry/dimension.h"
@@ -50,6 +52,7 @@ public:
         if (resAdapter_) {
             resAdapter_->Init(resourceInfo);
         }
+        InvalidateResolvedValues();
     }
 
     void UpdateConfig(const ResourceConfiguration& config)
@@ -57,6 +60,7 @@ public:
         if (resAdapter_) {
             resAdapter_->UpdateConfig(config);
         }
+        InvalidateResolvedValues();
     }
 
     void ParseTheme();
@@ -328,6 +332,12 @@ public:
         if (resAdapter_) {
             resAdapter_->UpdateResourceManager(bundleName, moduleName);
         }
+        std::lock_guard<std::mutex> lock(resolvedMutex_);
+        if (bundleName_ != bundleName || moduleName_ != moduleName) {
+            bundleName_ = bundleName;
+            moduleName_ = moduleName;
+            resourceOwner_ = bundleName + "/" + moduleName;
+        }
     }
 
     uint32_t GetResourceLimitKeys() const
@@ -342,6 +352,29 @@ public:
     }
 
 private:
+    // Values resolved from the resource adapter under the current configuration.
+    struct ResolvedValues {
+        std::unordered_map<uint32_t, Color> colors;
+        std::unordered_map<uint32_t, Dimension> dimensions;
+        std::unordered_map<uint32_t, int32_t> ints;
+        std::unordered_map<uint32_t, double> doubles;
+        std::unordered_map<std::string, Color> colorsByName;
+        std::unordered_map<std::string, Dimension> dimensionsByName;
+        std::unordered_map<std::string, int32_t> intsByName;
+        std::unordered_map<std::string, double> doublesByName;
+    };
+
+    void InvalidateResolvedValues()
+    {
+        std::lock_guard<std::mutex> lock(resolvedMutex_);
+        resolvedValues_.clear();
+        ++resolvedEpoch_;
+    }
+
+    template<class Key, class Value, class Resolver>
+    Value GetResolvedValue(
+        std::unordered_map<Key, Value> ResolvedValues::*member, const Key& key, const Resolver& resolver) const;
+
     static const ResValueWrapper* GetPlatformConstants(uint32_t key);
     static const ResValueWrapper* styleMapDefault[];
     static uint32_t DefaultMapCount;
@@ -362,6 +395,14 @@ private:
     RefPtr<ThemeStyle> currentThemeStyle_;
     ThemeConstantsMap customStyleMap_;
 
+    // Resolved values of each resource manager, keyed by "bundleName/moduleName".
+    mutable std::unordered_map<std::string, ResolvedValues> resolvedValues_;
+    mutable std::mutex resolvedMutex_;
+    uint32_t resolvedEpoch_ = 0;
+    std::string bundleName_;
+    std::string moduleName_;
+    std::string resourceOwner_ = "/";
+
     ACE_DISALLOW_COPY_AND_MOVE(ThemeConstants);
 };
 
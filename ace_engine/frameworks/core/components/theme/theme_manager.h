@@ -31,7 +31,7 @@ public:
 
     virtual void InitResource(const ResourceInfo& resourceInfo) {}
 
-    virtual void UpdateConfig(const ResourceConfiguration& config) {}
+    virtual void UpdateConfig(const ResourceConfiguration& config, bool themeFlag = false) {}
 
     virtual void LoadSystemTheme(int32_t themeId) {}
 
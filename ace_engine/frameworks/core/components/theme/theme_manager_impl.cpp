@@ -14,6 +14,10 @@
  */
 
 #include "core/components/theme/theme_manager_impl.h"
+
+#include <algorithm>
+
+#include "core/common/ace_application_info.h"
 #include "shadow_theme.h"
 
 #include "core/components/badge/badge_theme.h"
@@ -146,6 +150,8 @@ const std::unordered_map<ThemeType, RefPtr<Theme>(*)(const RefPtr<ThemeConstants
     { BlurStyleTheme::TypeId(), &ThemeBuildFunc<BlurStyleTheme::Builder> },
     { ShadowTheme::TypeId(), &ThemeBuildFunc<ShadowTheme::Builder> }
 };
+// Light and dark themes of the same configuration are enough to make color mode switch cheap.
+constexpr size_t MAX_THEME_SNAPSHOTS = 2;
 } // namespace
 
 ThemeManagerImpl::ThemeManagerImpl()
@@ -198,9 +204,38 @@ Color ThemeManagerImpl::GetBackgroundColor() const
     }
 }
 
+std::string ThemeManagerImpl::MakeConfigKey(const ResourceConfiguration& config)
+{
+    return std::to_string(static_cast<int32_t>(config.GetColorMode())) + "|" +
+           std::to_string(static_cast<int32_t>(config.GetOrientation())) + "|" +
+           std::to_string(static_cast<int32_t>(config.GetDeviceType())) + "|" + std::to_string(config.GetDensity()) +
+           "|" + std::to_string(config.GetFontRatio()) + "|" + std::to_string(config.GetDeviceAccess()) + "|" +
+           AceApplicationInfo::GetInstance().GetLocaleTag();
+}
+
 void ThemeManagerImpl::LoadResourceThemes()
 {
-    themes_.clear();
     themeConstants_->LoadTheme(currentThemeId_);
+    auto themesKey = configKey_ + "|" + std::to_string(currentThemeId_);
+    if (themesKey == themesKey_) {
+        // Reloaded by a change the key does not cover, none of the built themes can be reused.
+        themeSnapshots_.clear();
+        themes_.clear();
+        return;
+    }
+    if (!themes_.empty() && !themesKey_.empty()) {
+        if (themeSnapshots_.size() >= MAX_THEME_SNAPSHOTS) {
+            themeSnapshots_.pop_front();
+        }
+        themeSnapshots_.emplace_back(themesKey_, std::move(themes_));
+    }
+    themes_.clear();
+    themesKey_ = themesKey;
+    auto iter = std::find_if(themeSnapshots_.begin(), themeSnapshots_.end(),
+        [&themesKey](const auto& snapshot) { return snapshot.first == themesKey; });
+    if (iter != themeSnapshots_.end()) {
+        themes_.swap(iter->second);
+        themeSnapshots_.erase(iter);
+    }
 }
 } // namespace OHOS::Ace
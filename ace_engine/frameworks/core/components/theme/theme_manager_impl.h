@@ -16,6 +16,9 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_THEME_MANAGER_IMPL_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_THEME_MANAGER_IMPL_H
 
+#include <list>
+#include <string>
+
 #include "core/components/theme/resource_adapter.h"
 #include "core/components/theme/theme_manager.h"
 
@@ -31,11 +34,17 @@ public:
     void InitResource(const ResourceInfo& resourceInfo) override
     {
         themeConstants_->InitResource(resourceInfo);
+        ClearThemeSnapshots();
     }
 
-    void UpdateConfig(const ResourceConfiguration& config) override
+    void UpdateConfig(const ResourceConfiguration& config, bool themeFlag = false) override
     {
         themeConstants_->UpdateConfig(config);
+        configKey_ = MakeConfigKey(config);
+        if (themeFlag) {
+            // The theme tag changes theme resources and the default font, which are not in the key.
+            ClearThemeSnapshots();
+        }
     }
 
     void LoadSystemTheme(int32_t themeId) override
@@ -52,6 +61,7 @@ public:
     void LoadCustomTheme(const RefPtr<AssetManager>& assetManager) override
     {
         themeConstants_->LoadCustomStyle(assetManager);
+        ClearThemeSnapshots();
     }
 
     /*
@@ -60,6 +70,7 @@ public:
     void SetColorScheme(ColorScheme colorScheme) override
     {
         themeConstants_->SetColorScheme(colorScheme);
+        ClearThemeSnapshots();
     }
 
     /*
@@ -101,9 +112,25 @@ public:
     }
 
 private:
-    std::unordered_map<ThemeType, RefPtr<Theme>> themes_;
+    using ThemeMap = std::unordered_map<ThemeType, RefPtr<Theme>>;
+
+    static std::string MakeConfigKey(const ResourceConfiguration& config);
+
+    // Drop the snapshots and keep themes_ out of them, as they were built before a change the key does not cover.
+    void ClearThemeSnapshots()
+    {
+        themeSnapshots_.clear();
+        themesKey_.clear();
+    }
+
+    ThemeMap themes_;
     RefPtr<ThemeConstants> themeConstants_;
     int32_t currentThemeId_ = -1;
+    // Key of the configuration set by UpdateConfig, and of the configuration themes_ were built with.
+    std::string configKey_;
+    std::string themesKey_;
+    // Themes built under previous configurations, restored when switching back, e.g. toggling dark mode.
+    std::list<std::pair<std::string, ThemeMap>> themeSnapshots_;
 
     ACE_DISALLOW_COPY_AND_MOVE(ThemeManagerImpl);
 };
@@ -317,8 +317,10 @@ FrameNode::FrameNode(const std::string& tag, int32_t nodeId, const RefPtr<Patter
 
 FrameNode::~FrameNode()
 {
-    for (const auto& destroyCallback : destroyCallbacks_) {
-        destroyCallback();
+    if (extraData_) {
+        for (const auto& destroyCallback : extraData_->destroyCallbacks) {
+            destroyCallback();
+        }
     }
 
     pattern_->DetachFromFrameNode(this);
@@ -326,8 +328,10 @@ FrameNode::~FrameNode()
         OnDetachFromMainTree(false);
     }
     TriggerVisibleAreaChangeCallback(true);
-    visibleAreaUserCallbacks_.clear();
-    visibleAreaInnerCallbacks_.clear();
+    if (extraData_) {
+        extraData_->visibleAreaUserCallbacks.clear();
+        extraData_->visibleAreaInnerCallbacks.clear();
+    }
     auto pipeline = PipelineContext::GetCurrentContext();
     if (pipeline) {
         pipeline->RemoveOnAreaChangeNode(GetId());
@@ -425,6 +429,7 @@ void FrameNode::InitializePatternAndContext()
         if (frameNode->IsOnMainTree()) {
             auto context = frameNode->GetContext();
             CHECK_NULL_VOID(context);
+            frameNode->MarkVisibleAreaDirty();
             context->RequestFrame();
             return;
         }
@@ -706,6 +711,7 @@ void FrameNode::OnAttachToMainTree(bool recursive)
     }
 
     UINode::OnAttachToMainTree(recursive);
+    MarkVisibleAreaDirty();
 
     if (!hasPendingRequest_) {
         return;
@@ -749,6 +755,7 @@ void FrameNode::OnVisibleChange(bool isVisible)
     pattern_->OnVisibleChange(isVisible);
     UpdateChildrenVisible(isVisible);
     TriggerVisibleAreaChangeCallback(true);
+    MarkVisibleAreaDirty();
 }
 
 void FrameNode::OnDetachFromMainTree(bool recursive)
@@ -758,6 +765,8 @@ void FrameNode::OnDetachFromMainTree(bool recursive)
     }
     eventHub_->FireOnDisappear();
     renderContext_->OnNodeDisappear(recursive);
+    pattern_->OnDetachFromMainTree();
+    MarkVisibleAreaDirty();
 }
 
 void FrameNode::SwapDirtyLayoutWrapperOnMainThread(const RefPtr<LayoutWrapper>& dirty)
@@ -780,6 +789,9 @@ void FrameNode::SwapDirtyLayoutWrapperOnMainThread(const RefPtr<LayoutWrapper>&
     bool contentOffsetChange = geometryNode_->GetContentOffset() != dirty->GetGeometryNode()->GetContentOffset();
 
     SetGeometryNode(dirty->GetGeometryNode());
+    if (frameSizeChange || frameOffsetChange) {
+        MarkVisibleAreaDirty();
+    }
 
     const auto& geometryTransition = layoutProperty_->GetGeometryTransition();
     if (geometryTransition != nullptr && geometryTransition->IsRunning(WeakClaim(this))) {
@@ -835,15 +847,15 @@ void FrameNode::SwapDirtyLayoutWrapperOnMainThread(const RefPtr<LayoutWrapper>&
     }
 
     // update background
-    if (builderFunc_) {
-        auto builderNode = builderFunc_();
+    if (extraData_ && extraData_->builderFunc) {
+        auto builderNode = extraData_->builderFunc();
         auto columnNode = FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
             AceType::MakeRefPtr<LinearLayoutPattern>(true));
         builderNode->MountToParent(columnNode);
         SetBackgroundLayoutConstraint(columnNode);
         renderContext_->CreateBackgroundPixelMap(columnNode);
-        builderFunc_ = nullptr;
-        backgroundNode_ = columnNode;
+        extraData_->builderFunc = nullptr;
+        extraData_->backgroundNode = columnNode;
     }
 
     // update focus state
@@ -914,72 +926,95 @@ void FrameNode::TriggerOnAreaChangeCallback(uint64_t nanoTimestamp)
     pattern_->OnAreaChangedInner();
 }
 
-void FrameNode::TriggerVisibleAreaChangeCallback(bool forceDisappear)
+void FrameNode::TriggerVisibleAreaChangeCallback(bool forceDisappear, VisibleAreaCache* cache)
 {
     auto context = PipelineContext::GetCurrentContext();
     CHECK_NULL_VOID(context);
 
+    VisibleAreaCache localCache;
+    const VisibleAreaNodeInfo* nodeInfo = nullptr;
     bool isFrameDisappear = forceDisappear || !context->GetOnShow() || !IsOnMainTree();
     if (!isFrameDisappear) {
-        bool curFrameIsActive = isActive_;
-        bool curIsVisible = IsVisible();
-        auto parent = GetParent();
-        while (parent) {
-            auto parentFrame = AceType::DynamicCast<FrameNode>(parent);
-            if (!parentFrame) {
-                parent = parent->GetParent();
-                continue;
-            }
-            if (!parentFrame->isActive_) {
-                curFrameIsActive = false;
-                break;
-            }
-            if (!parentFrame->IsVisible()) {
-                curIsVisible = false;
-                break;
-            }
-            parent = parent->GetParent();
-        }
-        isFrameDisappear = !curIsVisible || !curFrameIsActive;
+        nodeInfo = &GetVisibleAreaNodeInfo(cache ? *cache : localCache);
+        isFrameDisappear = !nodeInfo->ancestorsShown || !IsVisible() || !isActive_;
     }
 
     if (isFrameDisappear) {
         if (!NearEqual(lastVisibleRatio_, VISIBLE_RATIO_MIN)) {
-            ProcessAllVisibleCallback(visibleAreaUserCallbacks_, VISIBLE_RATIO_MIN);
-            ProcessAllVisibleCallback(visibleAreaInnerCallbacks_, VISIBLE_RATIO_MIN);
+            if (extraData_) {
+                ProcessAllVisibleCallback(extraData_->visibleAreaUserCallbacks, VISIBLE_RATIO_MIN);
+                ProcessAllVisibleCallback(extraData_->visibleAreaInnerCallbacks, VISIBLE_RATIO_MIN);
+            }
             lastVisibleRatio_ = VISIBLE_RATIO_MIN;
         }
         return;
     }
 
-    auto frameRect = GetTransformRectRelativeToWindow();
+    auto paintRect = renderContext_->GetPaintRectWithTransform();
+    RectF frameRect(paintRect.GetX() * nodeInfo->scaleX + nodeInfo->offset.GetX(),
+        paintRect.GetY() * nodeInfo->scaleY + nodeInfo->offset.GetY(), paintRect.Width() * nodeInfo->scaleX,
+        paintRect.Height() * nodeInfo->scaleY);
     auto visibleRect = frameRect;
-    RectF parentRect;
-    auto parentUi = GetParent();
-    if (!parentUi) {
+    if (!GetParent()) {
         visibleRect.SetWidth(0.0f);
         visibleRect.SetHeight(0.0f);
-    }
-    while (parentUi) {
-        auto parentFrame = AceType::DynamicCast<FrameNode>(parentUi);
-        if (!parentFrame) {
-            parentUi = parentUi->GetParent();
-            continue;
-        }
-        parentRect = parentFrame->GetTransformRectRelativeToWindow();
-        visibleRect = visibleRect.Constrain(parentRect);
-        parentUi = parentUi->GetParent();
+    } else if (nodeInfo->ancestorClip) {
+        visibleRect = visibleRect.Constrain(nodeInfo->ancestorClip.value());
     }
 
     double currentVisibleRatio =
         std::clamp(CalculateCurrentVisibleRatio(visibleRect, frameRect), VISIBLE_RATIO_MIN, VISIBLE_RATIO_MAX);
     if (!NearEqual(currentVisibleRatio, lastVisibleRatio_)) {
-        ProcessAllVisibleCallback(visibleAreaUserCallbacks_, currentVisibleRatio);
-        ProcessAllVisibleCallback(visibleAreaInnerCallbacks_, currentVisibleRatio);
+        if (extraData_) {
+            ProcessAllVisibleCallback(extraData_->visibleAreaUserCallbacks, currentVisibleRatio);
+            ProcessAllVisibleCallback(extraData_->visibleAreaInnerCallbacks, currentVisibleRatio);
+        }
         lastVisibleRatio_ = currentVisibleRatio;
     }
 }
 
+const VisibleAreaNodeInfo& FrameNode::GetVisibleAreaNodeInfo(VisibleAreaCache& cache) const
+{
+    auto iter = cache.find(this);
+    if (iter != cache.end()) {
+        return iter->second;
+    }
+    // collect the nodes not resolved yet from this node up, then resolve them from the top down.
+    std::vector<const FrameNode*> nodes { this };
+    auto parent = GetAncestorNodeOfFrame();
+    while (parent && cache.find(RawPtr(parent)) == cache.end()) {
+        nodes.emplace_back(RawPtr(parent));
+        parent = parent->GetAncestorNodeOfFrame();
+    }
+    for (auto node = nodes.rbegin(); node != nodes.rend(); ++node) {
+        VisibleAreaNodeInfo info;
+        auto ancestor = (*node)->GetAncestorNodeOfFrame();
+        if (ancestor) {
+            const auto& ancestorInfo = cache.at(RawPtr(ancestor));
+            const auto& ancestorContext = ancestor->GetRenderContext();
+            auto ancestorPaintRect = ancestorContext->GetPaintRectWithTransform();
+            RectF ancestorRect(ancestorPaintRect.GetX() * ancestorInfo.scaleX + ancestorInfo.offset.GetX(),
+                ancestorPaintRect.GetY() * ancestorInfo.scaleY + ancestorInfo.offset.GetY(),
+                ancestorPaintRect.Width() * ancestorInfo.scaleX, ancestorPaintRect.Height() * ancestorInfo.scaleY);
+            auto ancestorScale = ancestorContext->GetTransformScale();
+            info.scaleX = ancestorInfo.scaleX * (ancestorScale ? ancestorScale->x : 1.0f);
+            info.scaleY = ancestorInfo.scaleY * (ancestorScale ? ancestorScale->y : 1.0f);
+            info.offset = ancestorRect.GetOffset();
+            info.ancestorClip =
+                ancestorInfo.ancestorClip ? ancestorRect.Constrain(ancestorInfo.ancestorClip.value()) : ancestorRect;
+            info.ancestorsShown = ancestorInfo.ancestorsShown && ancestor->isActive_ && ancestor->IsVisible();
+            info.ancestorsDirty = ancestorInfo.ancestorsDirty || ancestor->isVisibleAreaDirty_;
+        }
+        cache.emplace(*node, info);
+    }
+    return cache.at(this);
+}
+
+bool FrameNode::IsVisibleAreaDirty(VisibleAreaCache& cache) const
+{
+    return isVisibleAreaDirty_ || GetVisibleAreaNodeInfo(cache).ancestorsDirty;
+}
+
 double FrameNode::CalculateCurrentVisibleRatio(const RectF& visibleRect, const RectF& renderRect)
 {
     if (!visibleRect.IsValid() || !renderRect.IsValid()) {
@@ -988,8 +1023,19 @@ double FrameNode::CalculateCurrentVisibleRatio(const RectF& visibleRect, const R
     return visibleRect.Width() * visibleRect.Height() / (renderRect.Width() * renderRect.Height());
 }
 
-void FrameNode::ProcessAllVisibleCallback(
-    std::unordered_map<double, VisibleCallbackInfo>& visibleAreaCallbacks, double currentVisibleRatio)
+void FrameNode::InsertVisibleAreaCallback(
+    VisibleAreaCallbacks& visibleAreaCallbacks, double ratio, const VisibleCallbackInfo& callback)
+{
+    auto iter = std::lower_bound(visibleAreaCallbacks.begin(), visibleAreaCallbacks.end(), ratio,
+        [](const std::pair<double, VisibleCallbackInfo>& item, double value) { return item.first < value; });
+    if (iter != visibleAreaCallbacks.end() && iter->first == ratio) {
+        iter->second = callback;
+        return;
+    }
+    visibleAreaCallbacks.emplace(iter, ratio, callback);
+}
+
+void FrameNode::ProcessAllVisibleCallback(VisibleAreaCallbacks& visibleAreaCallbacks, double currentVisibleRatio)
 {
     bool isHandled = false;
     for (auto& nodeCallbackInfo : visibleAreaCallbacks) {
@@ -1048,6 +1094,7 @@ void FrameNode::SetActive(bool active)
         activeChanged = true;
     }
     if (activeChanged) {
+        MarkVisibleAreaDirty();
         auto parent = GetAncestorNodeOfFrame();
         if (parent) {
             parent->MarkNeedSyncRenderTree();
@@ -1062,6 +1109,17 @@ void FrameNode::SetGeometryNode(const RefPtr<GeometryNode>& node)
     geometryNode_ = node;
 }
 
+void FrameNode::MarkVisibleAreaDirty()
+{
+    if (isVisibleAreaDirty_) {
+        return;
+    }
+    auto context = GetContext();
+    CHECK_NULL_VOID(context);
+    isVisibleAreaDirty_ = true;
+    context->AddDirtyVisibleAreaNode(WeakClaim(this));
+}
+
 void FrameNode::CreateLayoutTask(bool forceUseMainThread)
 {
     if (!isLayoutDirtyMarked_) {
@@ -1101,7 +1159,10 @@ std::optional<UITask> FrameNode::CreateRenderTask(bool forceUseMainThread)
     if (forceUseMainThread || wrapper->CheckShouldRunOnMain()) {
         return UITask(std::move(task), MAIN_TASK);
     }
-    return UITask(std::move(task), wrapper->CanRunOnWhichThread());
+    // only the draw functions are created on the background thread, the render context is flushed on the UI thread.
+    UITask renderTask([wrapper]() { wrapper->CreateDrawFunctions(); }, wrapper->CanRunOnWhichThread());
+    renderTask.SetFinishTask(std::move(task));
+    return renderTask;
 }
 
 LayoutConstraintF FrameNode::GetLayoutConstraint() const
@@ -1255,6 +1316,7 @@ RefPtr<PaintWrapper> FrameNode::CreatePaintWrapper()
     if (paintMethod) {
         auto paintWrapper = MakeRefPtr<PaintWrapper>(renderContext_, geometryNode_->Clone(), paintProperty_->Clone());
         paintWrapper->SetNodePaintMethod(paintMethod);
+        paintWrapper->SetTaskThread(paintMethod->CanRunOnWhichThread());
         return paintWrapper;
     }
     if (renderContext_->GetAccessibilityFocus().value_or(false)) {
@@ -1358,11 +1420,12 @@ RefPtr<FrameNode> FrameNode::GetAncestorNodeOfFrame() const
 
 RefPtr<FrameNode> FrameNode::GetPageNode()
 {
-    if (GetTag() == "page") {
+    static const uint32_t pageTagId = TagRegistry::GetInstance().Intern(V2::PAGE_ETS_TAG);
+    if (GetTagId() == pageTagId) {
         return Claim(this);
     }
     auto parent = GetParent();
-    while (parent && parent->GetTag() != "page") {
+    while (parent && parent->GetTagId() != pageTagId) {
         parent = parent->GetParent();
     }
     return AceType::DynamicCast<FrameNode>(parent);
@@ -2129,14 +2192,15 @@ OffsetF FrameNode::GetPaintRectOffsetToPage() const
     auto context = GetRenderContext();
     CHECK_NULL_RETURN(context, OffsetF());
     OffsetF offset = context->GetPaintRectWithTransform().GetOffset();
+    static const uint32_t pageTagId = TagRegistry::GetInstance().Intern(V2::PAGE_ETS_TAG);
     auto parent = GetAncestorNodeOfFrame();
-    while (parent && parent->GetTag() != V2::PAGE_ETS_TAG) {
+    while (parent && parent->GetTagId() != pageTagId) {
         auto renderContext = parent->GetRenderContext();
         CHECK_NULL_RETURN(renderContext, OffsetF());
         offset += renderContext->GetPaintRectWithTransform().GetOffset();
         parent = parent->GetAncestorNodeOfFrame();
     }
-    return (parent && parent->GetTag() == V2::PAGE_ETS_TAG) ? offset : OffsetF();
+    return (parent && parent->GetTagId() == pageTagId) ? offset : OffsetF();
 }
 
 std::optional<RectF> FrameNode::GetViewPort() const
@@ -2144,8 +2208,9 @@ std::optional<RectF> FrameNode::GetViewPort() const
     if (viewPort_.has_value()) {
         return viewPort_;
     }
+    static const uint32_t pageTagId = TagRegistry::GetInstance().Intern(V2::PAGE_ETS_TAG);
     auto parent = GetAncestorNodeOfFrame();
-    while (parent && parent->GetTag() != V2::PAGE_ETS_TAG) {
+    while (parent && parent->GetTagId() != pageTagId) {
         auto parentViewPort = parent->GetSelfViewPort();
         if (parentViewPort.has_value()) {
             return parentViewPort;
@@ -2282,8 +2347,9 @@ RefPtr<FrameNode> FrameNode::FindChildByPosition(float x, float y)
 
 RefPtr<NodeAnimatablePropertyBase> FrameNode::GetAnimatablePropertyFloat(const std::string& propertyName) const
 {
-    auto iter = nodeAnimatablePropertyMap_.find(propertyName);
-    if (iter == nodeAnimatablePropertyMap_.end()) {
+    CHECK_NULL_RETURN(extraData_, nullptr);
+    auto iter = extraData_->nodeAnimatablePropertyMap.find(propertyName);
+    if (iter == extraData_->nodeAnimatablePropertyMap.end()) {
         return nullptr;
     }
     return iter->second;
@@ -2311,13 +2377,14 @@ void FrameNode::CreateAnimatablePropertyFloat(
 {
     auto context = GetRenderContext();
     CHECK_NULL_VOID(context);
-    auto iter = nodeAnimatablePropertyMap_.find(propertyName);
-    if (iter != nodeAnimatablePropertyMap_.end()) {
+    auto& propertyMap = GetOrCreateExtraData().nodeAnimatablePropertyMap;
+    auto iter = propertyMap.find(propertyName);
+    if (iter != propertyMap.end()) {
         return;
     }
     auto property = AceType::MakeRefPtr<NodeAnimatablePropertyFloat>(value, std::move(onCallbackEvent));
     context->AttachNodeAnimatableProperty(property);
-    nodeAnimatablePropertyMap_.emplace(propertyName, property);
+    propertyMap.emplace(propertyName, property);
 }
 
 void FrameNode::DeleteAnimatablePropertyFloat(const std::string& propertyName)
@@ -2327,14 +2394,15 @@ void FrameNode::DeleteAnimatablePropertyFloat(const std::string& propertyName)
     RefPtr<NodeAnimatablePropertyBase> propertyRef = GetAnimatablePropertyFloat(propertyName);
     if (propertyRef) {
         context->DetachNodeAnimatableProperty(propertyRef);
-        nodeAnimatablePropertyMap_.erase(propertyName);
+        extraData_->nodeAnimatablePropertyMap.erase(propertyName);
     }
 }
 
 void FrameNode::UpdateAnimatablePropertyFloat(const std::string& propertyName, float value)
 {
-    auto iter = nodeAnimatablePropertyMap_.find(propertyName);
-    if (iter == nodeAnimatablePropertyMap_.end()) {
+    CHECK_NULL_VOID(extraData_);
+    auto iter = extraData_->nodeAnimatablePropertyMap.find(propertyName);
+    if (iter == extraData_->nodeAnimatablePropertyMap.end()) {
         return;
     }
     auto property = AceType::DynamicCast<NodeAnimatablePropertyFloat>(iter->second);
@@ -2348,20 +2416,22 @@ void FrameNode::CreateAnimatableArithmeticProperty(const std::string& propertyNa
 {
     auto context = GetRenderContext();
     CHECK_NULL_VOID(context);
-    auto iter = nodeAnimatablePropertyMap_.find(propertyName);
-    if (iter != nodeAnimatablePropertyMap_.end()) {
+    auto& propertyMap = GetOrCreateExtraData().nodeAnimatablePropertyMap;
+    auto iter = propertyMap.find(propertyName);
+    if (iter != propertyMap.end()) {
         return;
     }
     auto property = AceType::MakeRefPtr<NodeAnimatableArithmeticProperty>(value, std::move(onCallbackEvent));
     context->AttachNodeAnimatableProperty(property);
-    nodeAnimatablePropertyMap_.emplace(propertyName, property);
+    propertyMap.emplace(propertyName, property);
 }
 
 void FrameNode::UpdateAnimatableArithmeticProperty(
     const std::string& propertyName, RefPtr<CustomAnimatableArithmetic>& value)
 {
-    auto iter = nodeAnimatablePropertyMap_.find(propertyName);
-    if (iter == nodeAnimatablePropertyMap_.end()) {
+    CHECK_NULL_VOID(extraData_);
+    auto iter = extraData_->nodeAnimatablePropertyMap.find(propertyName);
+    if (iter == extraData_->nodeAnimatablePropertyMap.end()) {
         return;
     }
     auto property = AceType::DynamicCast<NodeAnimatableArithmeticProperty>(iter->second);
@@ -2406,7 +2476,7 @@ double FrameNode::GetPreviewScaleVal() const
     CHECK_NULL_RETURN(geometryNode, scale);
     auto width = geometryNode->GetFrameRect().Width();
     if (GetTag() != V2::WEB_ETS_TAG && width != 0 && width > maxWidth &&
-        previewOption_.mode != DragPreviewMode::DISABLE_SCALE) {
+        GetDragPreviewOption().mode != DragPreviewMode::DISABLE_SCALE) {
         scale = maxWidth / width;
     }
     return scale;
@@ -2417,13 +2487,58 @@ bool FrameNode::IsPreviewNeedScale() const
     return GetPreviewScaleVal() < 1.0f;
 }
 
+const std::set<std::string>& FrameNode::GetAllowDrop() const
+{
+    static const std::set<std::string> emptyAllowDrop;
+    return extraData_ ? extraData_->allowDrop : emptyAllowDrop;
+}
+
+const DragDropInfo& FrameNode::GetDragPreview() const
+{
+    static const DragDropInfo emptyDragPreview;
+    return extraData_ ? extraData_->dragPreviewInfo : emptyDragPreview;
+}
+
+void FrameNode::DumpNodeSize(const RefPtr<UINode>& root)
+{
+    CHECK_NULL_VOID(root);
+    // tag -> count of nodes, count of nodes which have extra data allocated.
+    std::map<std::string, std::pair<size_t, size_t>> nodeCounts;
+    std::list<RefPtr<UINode>> nodes { root };
+    while (!nodes.empty()) {
+        auto node = nodes.front();
+        nodes.pop_front();
+        auto frameNode = AceType::DynamicCast<FrameNode>(node);
+        if (frameNode) {
+            auto& counts = nodeCounts[frameNode->GetTag()];
+            ++counts.first;
+            if (frameNode->extraData_) {
+                ++counts.second;
+            }
+        }
+        const auto& children = node->GetChildren();
+        nodes.insert(nodes.end(), children.begin(), children.end());
+    }
+    DumpLog::GetInstance().Print("FrameNodeSize: " + std::to_string(sizeof(FrameNode)) +
+                                 ", ExtraDataSize: " + std::to_string(sizeof(ExtraData)));
+    size_t totalSize = 0;
+    for (const auto& [tag, counts] : nodeCounts) {
+        auto size = counts.first * sizeof(FrameNode) + counts.second * sizeof(ExtraData);
+        totalSize += size;
+        DumpLog::GetInstance().Print(1, tag + ": count: " + std::to_string(counts.first) + ", withExtraData: " +
+                                            std::to_string(counts.second) + ", size: " + std::to_string(size));
+    }
+    DumpLog::GetInstance().Print("TotalSize: " + std::to_string(totalSize));
+}
+
 int32_t FrameNode::GetNodeExpectedRate()
 {
-    if (sceneRateMap_.empty()) {
+    if (!extraData_ || extraData_->sceneRateMap.empty()) {
         return 0;
     }
+    const auto& sceneRateMap = extraData_->sceneRateMap;
     auto iter = std::max_element(
-        sceneRateMap_.begin(), sceneRateMap_.end(), [](auto a, auto b) { return a.second < b.second; });
+        sceneRateMap.begin(), sceneRateMap.end(), [](auto a, auto b) { return a.second < b.second; });
     return iter->second;
 }
 
@@ -2444,20 +2559,21 @@ void FrameNode::AddFRCSceneInfo(const std::string& scene, float speed, SceneStat
 
     auto expectedRate = renderContext->CalcExpectedFrameRate(scene, std::abs(speed));
     auto nodeId = GetId();
-    auto iter = sceneRateMap_.find(scene);
+    auto& sceneRateMap = GetOrCreateExtraData().sceneRateMap;
+    auto iter = sceneRateMap.find(scene);
     switch (status) {
         case SceneStatus::START: {
-            if (iter == sceneRateMap_.end()) {
-                if (sceneRateMap_.empty()) {
+            if (iter == sceneRateMap.end()) {
+                if (sceneRateMap.empty()) {
                     frameRateManager->AddNodeRate(nodeId);
                 }
-                sceneRateMap_.emplace(scene, expectedRate);
+                sceneRateMap.emplace(scene, expectedRate);
                 frameRateManager->UpdateNodeRate(nodeId, GetNodeExpectedRate());
             }
             return;
         }
         case SceneStatus::RUNNING: {
-            if (iter != sceneRateMap_.end() && iter->second != expectedRate) {
+            if (iter != sceneRateMap.end() && iter->second != expectedRate) {
                 iter->second = expectedRate;
                 auto nodeExpectedRate = GetNodeExpectedRate();
                 frameRateManager->UpdateNodeRate(nodeId, nodeExpectedRate);
@@ -2465,9 +2581,9 @@ void FrameNode::AddFRCSceneInfo(const std::string& scene, float speed, SceneStat
             return;
         }
         case SceneStatus::END: {
-            if (iter != sceneRateMap_.end()) {
-                sceneRateMap_.erase(iter);
-                if (sceneRateMap_.empty()) {
+            if (iter != sceneRateMap.end()) {
+                sceneRateMap.erase(iter);
+                if (sceneRateMap.empty()) {
                     frameRateManager->RemoveNodeRate(nodeId);
                 } else {
                     auto nodeExpectedRate = GetNodeExpectedRate();
@@ -2522,8 +2638,11 @@ bool FrameNode::HaveSecurityComponent()
 
 bool FrameNode::IsSecurityComponent()
 {
-    return GetTag() == V2::LOCATION_BUTTON_ETS_TAG || GetTag() == V2::PASTE_BUTTON_ETS_TAG ||
-           GetTag() == V2::SAVE_BUTTON_ETS_TAG;
+    static const uint32_t locationButtonTagId = TagRegistry::GetInstance().Intern(V2::LOCATION_BUTTON_ETS_TAG);
+    static const uint32_t pasteButtonTagId = TagRegistry::GetInstance().Intern(V2::PASTE_BUTTON_ETS_TAG);
+    static const uint32_t saveButtonTagId = TagRegistry::GetInstance().Intern(V2::SAVE_BUTTON_ETS_TAG);
+    auto tagId = GetTagId();
+    return tagId == locationButtonTagId || tagId == pasteButtonTagId || tagId == saveButtonTagId;
 }
 
 void FrameNode::GetPercentSensitive()
@@ -2611,7 +2730,7 @@ void FrameNode::Measure(const std::optional<LayoutConstraintF>& parentConstraint
 
     isLayoutDirtyMarked_ = false;
 
-    if (isConstraintNotChanged_) {
+    if (isConstraintNotChanged_ && !isRemeasuringForCache_) {
         if (!CheckNeedForceMeasureAndLayout()) {
             ACE_SCOPED_TRACE("SkipMeasure");
             layoutAlgorithm_->SetSkipMeasure();
@@ -2619,6 +2738,16 @@ void FrameNode::Measure(const std::optional<LayoutConstraintF>& parentConstraint
         }
     }
 
+    if (!isRemeasuringForCache_ && MeasureByCache(parentConstraint)) {
+        return;
+    }
+
+    MeasureCache::Entry cacheEntry;
+    cacheEntry.layoutConstraint = layoutProperty_->GetLayoutConstraint();
+    cacheEntry.contentConstraint = layoutProperty_->GetContentLayoutConstraint();
+    // taken before measuring, properties updated by the measure itself make the entry out of date.
+    cacheEntry.version = layoutProperty_->GetMeasureVersion();
+
     auto size = layoutAlgorithm_->MeasureContent(layoutProperty_->CreateContentConstraint(), this);
     if (size.has_value()) {
         geometryNode_->SetContentSize(size.value());
@@ -2639,16 +2768,77 @@ void FrameNode::Measure(const std::optional<LayoutConstraintF>& parentConstraint
         auto height = width / aspectRatio;
         geometryNode_->SetFrameSize(SizeF({ width, height }));
     }
+    AddMeasureCache(std::move(cacheEntry));
 
     layoutProperty_->UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT);
 }
 
+bool FrameNode::MeasureByCache(const std::optional<LayoutConstraintF>& parentConstraint)
+{
+    if (layoutProperty_->GetGeometryTransition() != nullptr) {
+        return false;
+    }
+    // the node is laid out in this frame, the algorithm needs the results of its own measure for that.
+    if (CheckNeedLayout(layoutProperty_->GetPropertyChangeFlag()) && !layoutAlgorithm_->HasMeasured()) {
+        return false;
+    }
+    auto index = measureCache_.Find(layoutProperty_);
+    if (index < 0) {
+        return false;
+    }
+    ACE_SCOPED_TRACE("MeasureByCache");
+    const auto& entry = measureCache_.GetEntry(index);
+    geometryNode_->SetFrameSize(entry.frameSize);
+    if (entry.contentSize) {
+        geometryNode_->SetContentSize(entry.contentSize.value());
+    }
+    if (entry.baselineDistance) {
+        geometryNode_->SetBaselineDistance(entry.baselineDistance.value());
+    }
+    if (!measureCache_.IsSubtreeEntry(index)) {
+        // children keep the geometry of another constraint, they are measured again if the node is laid out.
+        measureCache_.SetPending(parentConstraint);
+        layoutAlgorithm_->SetSkipMeasure();
+        return true;
+    }
+    measureCache_.ResetPending();
+    // the algorithm measured with the same constraint in this frame, its results still have to be taken.
+    if (!layoutAlgorithm_->HasMeasured()) {
+        layoutAlgorithm_->SetSkipMeasure();
+    }
+    return true;
+}
+
+void FrameNode::AddMeasureCache(MeasureCache::Entry&& entry)
+{
+    entry.frameSize = geometryNode_->GetFrameSize();
+    if (geometryNode_->GetContent()) {
+        entry.contentSize = geometryNode_->GetContentSize();
+    }
+    if (geometryNode_->HasBaselineDistance()) {
+        entry.baselineDistance = geometryNode_->GetBaselineDistance();
+    }
+    measureCache_.Add(std::move(entry));
+}
+
+void FrameNode::RemeasureForCache()
+{
+    auto parentConstraint = measureCache_.GetPendingParentConstraint();
+    measureCache_.ResetPending();
+    isRemeasuringForCache_ = true;
+    Measure(parentConstraint);
+    isRemeasuringForCache_ = false;
+}
+
 // Called to perform layout children.
 void FrameNode::Layout()
 {
     ACE_LAYOUT_SCOPED_TRACE("Layout[%s][self:%d][parent:%d]", GetTag().c_str(),
         GetId(), GetParent() ? GetParent()->GetId() : 0);
     int64_t time = GetSysTimestamp();
+    if (measureCache_.IsPending()) {
+        RemeasureForCache();
+    }
     OffsetNodeToSafeArea();
     const auto& geometryTransition = layoutProperty_->GetGeometryTransition();
     if (geometryTransition != nullptr) {
@@ -2717,6 +2907,9 @@ void FrameNode::SyncGeometryNode()
         contentOffsetChange = geometryNode_->GetContentOffset() != oldGeometryNode_->GetContentOffset();
         oldGeometryNode_.Reset();
     }
+    if (frameSizeChange || frameOffsetChange) {
+        MarkVisibleAreaDirty();
+    }
 
     // update border.
     if (layoutProperty_->GetBorderWidthProperty()) {
@@ -2774,15 +2967,15 @@ void FrameNode::SyncGeometryNode()
     }
 
     // update background
-    if (builderFunc_) {
-        auto builderNode = builderFunc_();
+    if (extraData_ && extraData_->builderFunc) {
+        auto builderNode = extraData_->builderFunc();
         auto columnNode = FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
             AceType::MakeRefPtr<LinearLayoutPattern>(true));
         builderNode->MountToParent(columnNode);
         SetBackgroundLayoutConstraint(columnNode);
         renderContext_->CreateBackgroundPixelMap(columnNode);
-        builderFunc_ = nullptr;
-        backgroundNode_ = columnNode;
+        extraData_->builderFunc = nullptr;
+        extraData_->backgroundNode = columnNode;
     }
 
     // update focus state
@@ -2979,21 +3172,23 @@ void FrameNode::OnInspectorIdUpdate(const std::string& id)
 
 void FrameNode::RecordExposureIfNeed(const std::string& inspectorId)
 {
-    if (exposureProcessor_) {
+    if (isExposureChecked_) {
         return;
     }
-    exposureProcessor_ = MakeRefPtr<Recorder::ExposureProcessor>(inspectorId);
-    if (!exposureProcessor_->IsNeedRecord()) {
+    isExposureChecked_ = true;
+    auto exposureProcessor = MakeRefPtr<Recorder::ExposureProcessor>(inspectorId);
+    if (!exposureProcessor->IsNeedRecord()) {
         return;
     }
+    GetOrCreateExtraData().exposureProcessor = exposureProcessor;
     auto pipeline = PipelineContext::GetCurrentContext();
     CHECK_NULL_VOID(pipeline);
-    auto callback = [weak = WeakClaim(RawPtr(exposureProcessor_))](bool visible, double ratio) {
+    auto callback = [weak = WeakClaim(RawPtr(exposureProcessor))](bool visible, double ratio) {
         auto processor = weak.Upgrade();
         CHECK_NULL_VOID(processor);
         processor->OnVisibleChange(visible);
     };
-    pipeline->AddVisibleAreaChangeNode(Claim(this), exposureProcessor_->GetRatio(), callback, false);
+    pipeline->AddVisibleAreaChangeNode(Claim(this), exposureProcessor->GetRatio(), callback, false);
 }
 
 void FrameNode::AddFrameNodeSnapshot(bool isHit, int32_t parentId)
@@ -18,7 +18,11 @@
 
 #include <functional>
 #include <list>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "base/geometry/ng/offset_t.h"
 #include "base/geometry/ng/point_t.h"
@@ -41,6 +45,7 @@
 #include "core/components_ng/event/gesture_event_hub.h"
 #include "core/components_ng/event/input_event_hub.h"
 #include "core/components_ng/layout/layout_property.h"
+#include "core/components_ng/layout/measure_cache.h"
 #include "core/components_ng/property/accessibility_property.h"
 #include "core/components_ng/property/layout_constraint.h"
 #include "core/components_ng/property/property.h"
@@ -61,6 +66,27 @@ class Pattern;
 class StateModifyTask;
 class UITask;
 class FramePorxy;
+class FrameNode;
+
+// visible area callbacks of one node, sorted by ratio.
+using VisibleAreaCallbacks = std::vector<std::pair<double, VisibleCallbackInfo>>;
+
+// Window geometry of a frame node resolved during one visible area pass.
+struct VisibleAreaNodeInfo {
+    // maps the paint rect of the node, which is relative to its parent, to the window.
+    float scaleX = 1.0f;
+    float scaleY = 1.0f;
+    OffsetF offset;
+    // intersection of the window rects of all frame ancestors.
+    std::optional<RectF> ancestorClip;
+    // false if any frame ancestor is inactive or invisible.
+    bool ancestorsShown = true;
+    // true if any frame ancestor is marked visible area dirty.
+    bool ancestorsDirty = false;
+};
+
+// Shared by all nodes checked in one pass, so each ancestor is resolved only once.
+using VisibleAreaCache = std::unordered_map<const FrameNode*, VisibleAreaNodeInfo>;
 
 // FrameNode will display rendering region in the screen.
 class ACE_FORCE_EXPORT FrameNode : public UINode, public LayoutWrapper {
@@ -165,19 +191,29 @@ public:
 
     void AddVisibleAreaUserCallback(double ratio, const VisibleCallbackInfo& callback)
     {
-        visibleAreaUserCallbacks_[ratio] = callback;
+        InsertVisibleAreaCallback(GetOrCreateExtraData().visibleAreaUserCallbacks, ratio, callback);
     }
 
     void ClearVisibleAreaUserCallback()
     {
-        visibleAreaUserCallbacks_.clear();
+        if (extraData_) {
+            extraData_->visibleAreaUserCallbacks.clear();
+        }
     }
     void AddVisibleAreaInnerCallback(double ratio, const VisibleCallbackInfo& callback)
     {
-        visibleAreaInnerCallbacks_[ratio] = callback;
+        InsertVisibleAreaCallback(GetOrCreateExtraData().visibleAreaInnerCallbacks, ratio, callback);
     }
 
-    void TriggerVisibleAreaChangeCallback(bool forceDisappear = false);
+    // [cache] is shared by the nodes checked in the same frame, the geometry of ancestors is resolved once.
+    void TriggerVisibleAreaChangeCallback(bool forceDisappear = false, VisibleAreaCache* cache = nullptr);
+    // marks the node to be checked in the next visible area pass, with all of its descendants.
+    void MarkVisibleAreaDirty();
+    bool IsVisibleAreaDirty(VisibleAreaCache& cache) const;
+    void ResetVisibleAreaDirty()
+    {
+        isVisibleAreaDirty_ = false;
+    }
 
     void SetGeometryNode(const RefPtr<GeometryNode>& node);
 
@@ -354,7 +390,7 @@ public:
 
     void PushDestroyCallback(std::function<void()>&& callback)
     {
-        destroyCallbacks_.emplace_back(callback);
+        GetOrCreateExtraData().destroyCallbacks.emplace_back(callback);
     }
 
     bool MarkRemoving() override;
@@ -412,18 +448,19 @@ public:
 
     void SetDragPreviewOptions(const DragPreviewOption& previewOption)
     {
-        previewOption_ = previewOption;
+        GetOrCreateExtraData().previewOption = previewOption;
     }
 
     DragPreviewOption GetDragPreviewOption() const
     {
-        return previewOption_;
+        return extraData_ ? extraData_->previewOption : DragPreviewOption { DragPreviewMode::AUTO };
     }
 
     void SetBackgroundFunction(std::function<RefPtr<UINode>()>&& buildFunc)
     {
-        builderFunc_ = std::move(buildFunc);
-        backgroundNode_ = nullptr;
+        auto& extraData = GetOrCreateExtraData();
+        extraData.builderFunc = std::move(buildFunc);
+        extraData.backgroundNode = nullptr;
     }
 
     bool IsDraggable() const
@@ -448,23 +485,17 @@ public:
 
     void SetAllowDrop(const std::set<std::string>& allowDrop)
     {
-        allowDrop_ = allowDrop;
+        GetOrCreateExtraData().allowDrop = allowDrop;
     }
 
-    const std::set<std::string>& GetAllowDrop() const
-    {
-        return allowDrop_;
-    }
+    const std::set<std::string>& GetAllowDrop() const;
 
     void SetDragPreview(const NG::DragDropInfo& info)
     {
-        dragPreviewInfo_ = info;
+        GetOrCreateExtraData().dragPreviewInfo = info;
     }
 
-    const DragDropInfo& GetDragPreview() const
-    {
-        return dragPreviewInfo_;
-    }
+    const DragDropInfo& GetDragPreview() const;
 
     void SetOverlayNode(const RefPtr<FrameNode>& overlayNode)
     {
@@ -501,6 +532,10 @@ public:
 
     static std::vector<RefPtr<FrameNode>> GetNodesById(const std::unordered_set<int32_t>& set);
 
+    // print the size of the frame nodes in the tree of [root] grouped by tag, the size of the members allocated by
+    // the patterns is not included.
+    static void DumpNodeSize(const RefPtr<UINode>& root);
+
     double GetPreviewScaleVal() const;
 
     bool IsPreviewNeedScale() const;
@@ -546,6 +581,7 @@ public:
     {
         layoutProperty_ = layoutProperty;
         layoutProperty_->SetHost(WeakClaim(this));
+        measureCache_.Clear();
     }
 
     const RefPtr<LayoutProperty>& GetLayoutProperty() const override
@@ -720,8 +756,10 @@ private:
 
     bool GetTouchable() const;
 
-    void ProcessAllVisibleCallback(
-        std::unordered_map<double, VisibleCallbackInfo>& visibleAreaCallbacks, double currentVisibleRatio);
+    static void InsertVisibleAreaCallback(
+        VisibleAreaCallbacks& visibleAreaCallbacks, double ratio, const VisibleCallbackInfo& callback);
+    const VisibleAreaNodeInfo& GetVisibleAreaNodeInfo(VisibleAreaCache& cache) const;
+    void ProcessAllVisibleCallback(VisibleAreaCallbacks& visibleAreaCallbacks, double currentVisibleRatio);
     void OnVisibleAreaChangeCallback(
         VisibleCallbackInfo& callbackInfo, bool visibleType, double currentVisibleRatio, bool isHandled);
 
@@ -735,6 +773,10 @@ private:
     void GetPercentSensitive();
     void UpdatePercentSensitive();
 
+    bool MeasureByCache(const std::optional<LayoutConstraintF>& parentConstraint);
+    void AddMeasureCache(MeasureCache::Entry&& entry);
+    void RemeasureForCache();
+
     void UpdateParentAbsoluteOffset();
     void AddFrameNodeSnapshot(bool isHit, int32_t parentId);
 
@@ -746,9 +788,30 @@ private:
     std::multiset<WeakPtr<FrameNode>, ZIndexComparator> frameChildren_;
     RefPtr<GeometryNode> geometryNode_ = MakeRefPtr<GeometryNode>();
 
-    std::list<std::function<void()>> destroyCallbacks_;
-    std::unordered_map<double, VisibleCallbackInfo> visibleAreaUserCallbacks_;
-    std::unordered_map<double, VisibleCallbackInfo> visibleAreaInnerCallbacks_;
+    // members set on few nodes, they are allocated on first use so that a plain node does not pay for them.
+    struct ExtraData {
+        std::list<std::function<void()>> destroyCallbacks;
+        VisibleAreaCallbacks visibleAreaUserCallbacks;
+        VisibleAreaCallbacks visibleAreaInnerCallbacks;
+        RefPtr<FrameNode> backgroundNode;
+        std::function<RefPtr<UINode>()> builderFunc;
+        std::set<std::string> allowDrop;
+        NG::DragDropInfo dragPreviewInfo;
+        DragPreviewOption previewOption { DragPreviewMode::AUTO };
+        std::map<std::string, RefPtr<NodeAnimatablePropertyBase>> nodeAnimatablePropertyMap;
+        std::unordered_map<std::string, int32_t> sceneRateMap;
+        RefPtr<Recorder::ExposureProcessor> exposureProcessor;
+    };
+
+    ExtraData& GetOrCreateExtraData()
+    {
+        if (!extraData_) {
+            extraData_ = std::make_unique<ExtraData>();
+        }
+        return *extraData_;
+    }
+
+    std::unique_ptr<ExtraData> extraData_;
 
     RefPtr<AccessibilityProperty> accessibilityProperty_;
     RefPtr<LayoutProperty> layoutProperty_;
@@ -757,16 +820,13 @@ private:
     RefPtr<EventHub> eventHub_;
     RefPtr<Pattern> pattern_;
 
-    RefPtr<FrameNode> backgroundNode_;
-    std::function<RefPtr<UINode>()> builderFunc_;
     std::unique_ptr<RectF> lastFrameRect_;
     std::unique_ptr<OffsetF> lastParentOffsetToWindow_;
-    std::set<std::string> allowDrop_;
     std::optional<RectF> viewPort_;
-    NG::DragDropInfo dragPreviewInfo_;
 
     RefPtr<LayoutAlgorithmWrapper> layoutAlgorithm_;
     RefPtr<GeometryNode> oldGeometryNode_;
+    MeasureCache measureCache_;
     std::optional<bool> skipMeasureContent_;
     std::unique_ptr<FramePorxy> frameProxy_;
 
@@ -776,6 +836,9 @@ private:
     bool isRenderDirtyMarked_ = false;
     bool isMeasureBoundary_ = false;
     bool hasPendingRequest_ = false;
+    bool isVisibleAreaDirty_ = false;
+    // the exposure config is only checked for the first inspector id, like the processor it creates.
+    bool isExposureChecked_ = false;
 
     // for container, this flag controls only the last child in touch area is consuming event.
     bool exclusiveEventForChild_ = false;
@@ -784,6 +847,7 @@ private:
     bool bypass_ = false;
     bool isLayoutComplete_ = false;
     bool isFirstBuilding_ = true;
+    bool isRemeasuringForCache_ = false;
 
     double lastVisibleRatio_ = 0.0;
 
@@ -797,7 +861,6 @@ private:
     bool userSet_ = false;
     bool customerSet_ = false;
 
-    std::map<std::string, RefPtr<NodeAnimatablePropertyBase>> nodeAnimatablePropertyMap_;
     Matrix4 localMat_ = Matrix4::CreateIdentity();
 
     bool isRestoreInfoUsed_ = false;
@@ -805,12 +868,6 @@ private:
 
     RefPtr<FrameNode> overlayNode_;
 
-    std::unordered_map<std::string, int32_t> sceneRateMap_;
-
-    DragPreviewOption previewOption_ { DragPreviewMode::AUTO };
-
-    RefPtr<Recorder::ExposureProcessor> exposureProcessor_;
-
     std::pair<uint64_t, OffsetF> cachedGlobalOffset_ = {0, OffsetF()};
 
     friend class RosenRenderContext;
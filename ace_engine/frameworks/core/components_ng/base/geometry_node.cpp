@@ -38,18 +38,12 @@ RefPtr<GeometryNode> GeometryNode::Clone() const
 {
     auto node = MakeRefPtr<GeometryNode>();
     node->frame_ = frame_;
-    if (margin_) {
-        node->margin_ = std::make_unique<MarginPropertyF>(*margin_);
-    }
-    if (padding_) {
-        node->padding_ = std::make_unique<MarginPropertyF>(*padding_);
-    }
-    if (content_) {
-        node->content_ = std::make_unique<GeometryProperty>(*content_);
-    }
+    node->margin_ = margin_;
+    node->padding_ = padding_;
+    node->content_ = content_;
     node->parentGlobalOffset_ = parentGlobalOffset_;
     node->parentLayoutConstraint_ = parentLayoutConstraint_;
-    node->previousState_ = previousState_ ? std::make_unique<RectF>(*previousState_) : nullptr;
+    node->previousState_ = previousState_;
     node->parentAbsoluteOffset_ = parentAbsoluteOffset_;
     return node;
 }
@@ -79,6 +73,6 @@ void GeometryNode::Save()
 {
     // INVARIANT: previousState_ is null when Save() is called (only allow 1 layer of save/restore)
     CHECK_NULL_VOID(!previousState_);
-    previousState_ = std::make_unique<RectF>(frame_.rect_);
+    previousState_ = CowPtr<RectF>::Make(frame_.rect_);
 }
 } // namespace OHOS::Ace::NG
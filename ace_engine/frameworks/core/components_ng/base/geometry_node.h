@@ -23,6 +23,7 @@
 #include "base/geometry/ng/rect_t.h"
 #include "base/geometry/ng/size_t.h"
 #include "base/memory/ace_type.h"
+#include "base/memory/cow_ptr.h"
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
 #include "base/utils/utils.h"
@@ -142,17 +143,17 @@ public:
     void SetContentSize(const SizeF& size)
     {
         if (!content_) {
-            content_ = std::make_unique<GeometryProperty>();
+            content_ = CowPtr<GeometryProperty>::Make();
         }
-        content_->rect_.SetSize(size);
+        content_.Detach()->rect_.SetSize(size);
     }
 
     void SetContentOffset(const OffsetF& translate)
     {
         if (!content_) {
-            content_ = std::make_unique<GeometryProperty>();
+            content_ = CowPtr<GeometryProperty>::Make();
         }
-        content_->rect_.SetOffset(translate);
+        content_.Detach()->rect_.SetOffset(translate);
     }
 
     RectF GetContentRect() const
@@ -170,17 +171,17 @@ public:
         return content_ ? content_->rect_.GetOffset() : OffsetF();
     }
 
-    const std::unique_ptr<GeometryProperty>& GetContent() const
+    const CowPtr<GeometryProperty>& GetContent() const
     {
         return content_;
     }
 
-    const std::unique_ptr<MarginPropertyF>& GetMargin() const
+    const CowPtr<MarginPropertyF>& GetMargin() const
     {
         return margin_;
     }
 
-    const std::unique_ptr<PaddingPropertyF>& GetPadding() const
+    const CowPtr<PaddingPropertyF>& GetPadding() const
     {
         return padding_;
     }
@@ -188,40 +189,42 @@ public:
     void UpdateMargin(const MarginPropertyF& margin)
     {
         if (!margin_) {
-            margin_ = std::make_unique<MarginPropertyF>(margin);
+            margin_ = CowPtr<MarginPropertyF>::Make(margin);
             return;
         }
+        auto* marginProperty = margin_.Detach();
         if (margin.left) {
-            margin_->left = margin.left;
+            marginProperty->left = margin.left;
         }
         if (margin.right) {
-            margin_->right = margin.right;
+            marginProperty->right = margin.right;
         }
         if (margin.top) {
-            margin_->top = margin.top;
+            marginProperty->top = margin.top;
         }
         if (margin.bottom) {
-            margin_->bottom = margin.bottom;
+            marginProperty->bottom = margin.bottom;
         }
     }
 
     void UpdatePaddingWithBorder(const PaddingPropertyF& padding)
     {
         if (!padding_) {
-            padding_ = std::make_unique<PaddingPropertyF>(padding);
+            padding_ = CowPtr<PaddingPropertyF>::Make(padding);
             return;
         }
+        auto* paddingProperty = padding_.Detach();
         if (padding.left) {
-            padding_->left = padding.left;
+            paddingProperty->left = padding.left;
         }
         if (padding.right) {
-            padding_->right = padding.right;
+            paddingProperty->right = padding.right;
         }
         if (padding.top) {
-            padding_->top = padding.top;
+            paddingProperty->top = padding.top;
         }
         if (padding.bottom) {
-            padding_->bottom = padding.bottom;
+            paddingProperty->bottom = padding.bottom;
         }
     }
 
@@ -285,12 +288,17 @@ public:
         baselineDistance_ = baselineDistance;
     }
 
+    bool HasBaselineDistance() const
+    {
+        return baselineDistance_.has_value();
+    }
+
     float GetBaselineDistance()
     {
         return baselineDistance_.value_or(frame_.rect_.GetY());
     }
 
-    const std::unique_ptr<RectF>& GetPreviousState() const
+    const CowPtr<RectF>& GetPreviousState() const
     {
         return previousState_;
     }
@@ -307,15 +315,15 @@ private:
 
     // the frame size in parent local coordinate.
     GeometryProperty frame_;
-    // the size of margin property.
-    std::unique_ptr<MarginPropertyF> margin_;
-    // the size of padding property.
-    std::unique_ptr<MarginPropertyF> padding_;
-    // the size of content rect in current node local coordinate.
-    std::unique_ptr<GeometryProperty> content_;
+    // the size of margin property, shared with the clones until modified.
+    CowPtr<MarginPropertyF> margin_;
+    // the size of padding property, shared with the clones until modified.
+    CowPtr<MarginPropertyF> padding_;
+    // the size of content rect in current node local coordinate, shared with the clones until modified.
+    CowPtr<GeometryProperty> content_;
 
     // save node's state before SafeArea expansion
-    std::unique_ptr<RectF> previousState_;
+    CowPtr<RectF> previousState_;
 
     OffsetF parentGlobalOffset_;
     OffsetF parentAbsoluteOffset_;
@@ -72,7 +72,7 @@ UINode::~UINode()
 #endif
 
     if (!removeSilently_) {
-        ElementRegister::GetInstance()->RemoveItem(nodeId_, tag_);
+        ElementRegister::GetInstance()->RemoveItem(nodeId_, tag_.GetId());
     } else {
         ElementRegister::GetInstance()->RemoveItemSilently(nodeId_);
     }
@@ -483,7 +483,7 @@ void UINode::DumpTree(int32_t depth)
             DumpLog::GetInstance().AddDesc(std::string("IsDisappearing: ").append(std::to_string(IsDisappearing())));
         }
         DumpInfo();
-        DumpLog::GetInstance().Append(depth, tag_, static_cast<int32_t>(GetChildren().size()));
+        DumpLog::GetInstance().Append(depth, tag_.GetName(), static_cast<int32_t>(GetChildren().size()));
     }
     for (const auto& item : GetChildren()) {
         item->DumpTree(depth + 1);
@@ -501,7 +501,7 @@ bool UINode::DumpTreeById(int32_t depth, const std::string& id)
         DumpLog::GetInstance().AddDesc(std::string("Depth: ").append(std::to_string(GetDepth())));
         DumpLog::GetInstance().AddDesc(std::string("IsDisappearing: ").append(std::to_string(IsDisappearing())));
         DumpAdvanceInfo();
-        DumpLog::GetInstance().Print(depth, tag_, static_cast<int32_t>(GetChildren().size()));
+        DumpLog::GetInstance().Print(depth, tag_.GetName(), static_cast<int32_t>(GetChildren().size()));
         return true;
     }
     for (const auto& item : GetChildren()) {
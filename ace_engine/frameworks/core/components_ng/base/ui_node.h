@@ -27,6 +27,7 @@
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
+#include "base/utils/tag_registry.h"
 #include "base/view_data/view_data_wrap.h"
 #include "core/components_ng/event/focus_hub.h"
 #include "core/components_ng/event/gesture_event_hub.h"
@@ -155,7 +156,13 @@ public:
 
     const std::string& GetTag() const
     {
-        return tag_;
+        return tag_.GetName();
+    }
+
+    // the id of the tag interned in TagRegistry, compare it instead of the name on hot paths.
+    uint32_t GetTagId() const
+    {
+        return tag_.GetId();
     }
 
     int32_t GetId() const
@@ -558,7 +565,7 @@ private:
     std::list<std::pair<RefPtr<UINode>, uint32_t>> disappearingChildren_;
     std::unique_ptr<PerformanceCheckNode> nodeInfo_;
     WeakPtr<UINode> parent_;
-    std::string tag_ = "UINode";
+    InternedTag tag_;
     int32_t depth_ = 0;
     int32_t hostRootId_ = 0;
     int32_t hostPageId_ = 0;
@@ -101,7 +101,13 @@ bool GestureEventHub::ProcessTouchTestHit(const OffsetF& coordinateOffset, const
     if (userParallelClickEventActuator_) {
         auto clickRecognizer = userParallelClickEventActuator_->GetClickRecognizer();
         if (clickRecognizer) {
-            clickRecognizer->SetGestureInfo(MakeRefPtr<GestureInfo>(GestureTypeName::CLICK, true));
+            auto gestureInfo = clickRecognizer->GetGestureInfo();
+            if (gestureInfo) {
+                gestureInfo->SetType(GestureTypeName::CLICK);
+                gestureInfo->SetIsSystemGesture(true);
+            } else {
+                clickRecognizer->SetGestureInfo(MakeRefPtr<GestureInfo>(GestureTypeName::CLICK, true));
+            }
             clickRecognizer->SetOnAction(userParallelClickEventActuator_->GetClickEvent());
             clickRecognizer->SetCoordinateOffset(Offset(coordinateOffset.GetX(), coordinateOffset.GetY()));
             clickRecognizer->SetGetEventTargetImpl(getEventTargetImpl);
@@ -233,7 +239,7 @@ void GestureEventHub::ProcessTouchTestHierarchy(const OffsetF& coordinateOffset,
         }
         auto recognizerGroup = AceType::DynamicCast<RecognizerGroup>(recognizer);
         if (recognizerGroup) {
-            auto groupRecognizers = recognizerGroup->GetGroupRecognizer();
+            const auto& groupRecognizers = recognizerGroup->GetGroupRecognizer();
             for (const auto& groupRecognizer : groupRecognizers) {
                 if (groupRecognizer) {
                     groupRecognizer->SetCoordinateOffset(offset);
@@ -21,6 +21,18 @@
 #include "core/components_ng/gestures/recognizers/recognizer_group.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+constexpr size_t MAX_POOLED_SCOPES = 10;
+} // namespace
+
+void GestureScope::Reset(size_t touchId)
+{
+    // keep the capacity of recognizers_, members of the next touch are usually as many.
+    recognizers_.clear();
+    touchId_ = touchId;
+    isDelay_ = false;
+    hasGestureAccepted_ = false;
+}
 
 void GestureScope::AddMember(const RefPtr<NGGestureRecognizer>& recognizer)
 {
@@ -170,7 +182,7 @@ static bool CheckRecognizer(const RefPtr<NGGestureRecognizer>& recognizer)
     if (!group) {
         return recognizer->GetRefereeState() == RefereeState::PENDING;
     }
-    auto children = group->GetGroupRecognizer();
+    const auto& children = group->GetGroupRecognizer();
     for (auto iter = children.begin(); iter != children.end(); ++iter) {
         if (CheckRecognizer(*iter)) {
             return true;
@@ -218,7 +230,7 @@ void GestureReferee::AddGestureToScope(size_t touchId, const TouchTestResult& re
     if (iter != gestureScopes_.end()) {
         scope = iter->second;
     } else {
-        scope = MakeRefPtr<GestureScope>(touchId);
+        scope = AcquireScope(touchId);
         gestureScopes_.try_emplace(touchId, scope);
     }
     for (const auto& item : result) {
@@ -239,10 +251,32 @@ void GestureReferee::CleanGestureScope(size_t touchId)
             return;
         }
         scope->Close();
+        RecycleScope(scope);
         gestureScopes_.erase(iter);
     }
 }
 
+RefPtr<GestureScope> GestureReferee::AcquireScope(size_t touchId)
+{
+    if (scopePool_.empty()) {
+        return MakeRefPtr<GestureScope>(touchId);
+    }
+    auto scope = std::move(scopePool_.back());
+    scopePool_.pop_back();
+    scope->Reset(touchId);
+    return scope;
+}
+
+void GestureReferee::RecycleScope(const RefPtr<GestureScope>& scope)
+{
+    // only the scope map holds the scope, nothing else can observe it being reused.
+    if (!scope || scope->RefCount() > 1 || scopePool_.size() >= MAX_POOLED_SCOPES) {
+        return;
+    }
+    scope->Reset(0);
+    scopePool_.emplace_back(scope);
+}
+
 bool GestureReferee::QueryAllDone(size_t touchId)
 {
     bool ret = true;
@@ -282,6 +316,7 @@ void GestureReferee::CleanAll(bool isBlocked)
 {
     for (auto iter = gestureScopes_.begin(); iter != gestureScopes_.end(); iter++) {
         iter->second->Close(isBlocked);
+        RecycleScope(iter->second);
     }
     gestureScopes_.clear();
 }
@@ -364,6 +399,7 @@ void GestureReferee::HandleAcceptDisposal(const RefPtr<NGGestureRecognizer>& rec
         while (iter != gestureScopes_.end()) {
             if (iter->second->IsDelayClosed()) {
                 iter->second->Close();
+                RecycleScope(iter->second);
                 iter = gestureScopes_.erase(iter);
             } else {
                 ++iter;
@@ -430,6 +466,7 @@ void GestureReferee::HandleRejectDisposal(const RefPtr<NGGestureRecognizer>& rec
     while (iter != gestureScopes_.end()) {
         if (iter->second->IsDelayClosed()) {
             iter->second->Close();
+            RecycleScope(iter->second);
             iter = gestureScopes_.erase(iter);
         } else {
             ++iter;
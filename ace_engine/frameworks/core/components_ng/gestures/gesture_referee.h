@@ -19,6 +19,7 @@
 #include <list>
 #include <set>
 #include <unordered_map>
+#include <vector>
 
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
@@ -52,6 +53,9 @@ public:
     explicit GestureScope(size_t touchId) : touchId_(touchId) {}
     ~GestureScope() override = default;
 
+    // Clears the scope so that it can be reused for [touchId].
+    void Reset(size_t touchId);
+
     void AddMember(const RefPtr<NGGestureRecognizer>& recognizer);
     void DelMember(const RefPtr<NGGestureRecognizer>& recognizer);
 
@@ -96,7 +100,7 @@ public:
     void ForceCleanGestureScope();
 private:
     bool Existed(const RefPtr<NGGestureRecognizer>& recognizer);
-    std::list<WeakPtr<NGGestureRecognizer>> recognizers_;
+    std::vector<WeakPtr<NGGestureRecognizer>> recognizers_;
 
     size_t touchId_ = 0;
     bool isDelay_ = false;
@@ -139,9 +143,13 @@ private:
     void HandleAcceptDisposal(const RefPtr<NGGestureRecognizer>& recognizer);
     void HandlePendingDisposal(const RefPtr<NGGestureRecognizer>& recognizer);
     void HandleRejectDisposal(const RefPtr<NGGestureRecognizer>& recognizer);
+    RefPtr<GestureScope> AcquireScope(size_t touchId);
+    void RecycleScope(const RefPtr<GestureScope>& scope);
 
     // Stores gesture recognizer collection according to Id.
     std::unordered_map<size_t, RefPtr<GestureScope>> gestureScopes_;
+    // closed scopes kept for the next touch down.
+    std::vector<RefPtr<GestureScope>> scopePool_;
 
     std::function<void(size_t)> queryStateFunc_;
     SourceType lastSourceType_ = SourceType::NONE;
@@ -56,7 +56,7 @@ bool MultiFingersRecognizer::IsNeedResetStatus()
         return true;
     }
 
-    auto groupList = group->GetGroupRecognizer();
+    const auto& groupList = group->GetGroupRecognizer();
     for (auto &recognizer : groupList) {
         auto multiFingersRecognizer = AceType::DynamicCast<MultiFingersRecognizer>(recognizer);
         if (!multiFingersRecognizer) {
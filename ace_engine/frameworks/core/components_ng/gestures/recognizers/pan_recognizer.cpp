@@ -151,6 +151,7 @@ void PanRecognizer::HandleTouchDownEvent(const TouchEvent& event)
     lastTouchEvent_ = event;
     touchPoints_[event.id] = event;
     touchPointsDistance_[event.id] = Offset(0.0, 0.0);
+    RequestTouchPrediction();
     if (event.sourceType == SourceType::MOUSE) {
         inputEventType_ = InputEventType::MOUSE_BUTTON;
     } else {
@@ -230,6 +231,7 @@ void PanRecognizer::HandleTouchUpEvent(const TouchEvent& event)
     }
 
     if (refereeState_ == RefereeState::SUCCEED) {
+        RevertTouchPrediction(event);
         if (currentFingers_ == fingers_) {
             ResSchedReport::GetInstance().ResSchedDataReport("click");
             // last one to fire end.
@@ -268,7 +270,15 @@ void PanRecognizer::HandleTouchMoveEvent(const TouchEvent& event)
 
     globalPoint_ = Point(event.x, event.y);
     lastTouchEvent_ = event;
-    PointF windowPoint(event.GetOffset().GetX(), event.GetOffset().GetY());
+    RequestTouchPrediction();
+    // the pan is moved to the predicted position once accepted, the next move corrects the prediction error as the
+    // delta is taken from the predicted position.
+    Offset predictedOffset;
+    if (isTouchPredictionEnabled_ && refereeState_ == RefereeState::SUCCEED && event.predictedOffset) {
+        predictedOffset = event.predictedOffset.value();
+    }
+    PointF windowPoint(
+        event.GetOffset().GetX() + predictedOffset.GetX(), event.GetOffset().GetY() + predictedOffset.GetY());
     PointF windowTouchPoint(touchPoints_[event.id].GetOffset().GetX(), touchPoints_[event.id].GetOffset().GetY());
     NGGestureRecognizer::Transform(windowPoint, GetAttachedNode());
     NGGestureRecognizer::Transform(windowTouchPoint, GetAttachedNode());
@@ -281,7 +291,17 @@ void PanRecognizer::HandleTouchMoveEvent(const TouchEvent& event)
     mainDelta_ = GetMainAxisDelta();
     UpdateTouchPointInVelocityTracker(event.history.empty() ? event : event.history.back());
     averageDistance_ += delta_ / static_cast<double>(touchPoints_.size());
-    touchPoints_[event.id] = event;
+    auto& touchPoint = touchPoints_[event.id];
+    touchPoint = event;
+    touchPoint.x += predictedOffset.GetX();
+    touchPoint.y += predictedOffset.GetY();
+    touchPoint.screenX += predictedOffset.GetX();
+    touchPoint.screenY += predictedOffset.GetY();
+    if (predictedOffset.IsZero()) {
+        predictedOffsets_.erase(event.id);
+    } else {
+        predictedOffsets_[event.id] = predictedOffset;
+    }
     touchPointsDistance_[event.id] += delta_;
     time_ = event.time;
 
@@ -312,6 +332,47 @@ void PanRecognizer::HandleTouchMoveEvent(const TouchEvent& event)
     }
 }
 
+void PanRecognizer::RevertTouchPrediction(const TouchEvent& event)
+{
+    // the pan stays at the predicted position when no move follows, take it back to the pointer before it ends.
+    if (predictedOffsets_.erase(event.id) == 0) {
+        return;
+    }
+    auto iter = touchPoints_.find(event.id);
+    if (iter == touchPoints_.end()) {
+        return;
+    }
+    PointF windowPoint(event.GetOffset().GetX(), event.GetOffset().GetY());
+    PointF windowTouchPoint(iter->second.GetOffset().GetX(), iter->second.GetOffset().GetY());
+    NGGestureRecognizer::Transform(windowPoint, GetAttachedNode());
+    NGGestureRecognizer::Transform(windowTouchPoint, GetAttachedNode());
+    delta_ =
+        (Offset(windowPoint.GetX(), windowPoint.GetY()) - Offset(windowTouchPoint.GetX(), windowTouchPoint.GetY()));
+    mainDelta_ = GetMainAxisDelta();
+    averageDistance_ += delta_ / static_cast<double>(touchPoints_.size());
+    touchPointsDistance_[event.id] += delta_;
+    iter->second.x = event.x;
+    iter->second.y = event.y;
+    iter->second.screenX = event.screenX;
+    iter->second.screenY = event.screenY;
+    if ((direction_.type & PanDirection::VERTICAL) == 0) {
+        averageDistance_.SetY(0.0);
+    } else if ((direction_.type & PanDirection::HORIZONTAL) == 0) {
+        averageDistance_.SetX(0.0);
+    }
+    SendCallbackMsg(onActionUpdate_);
+}
+
+void PanRecognizer::RequestTouchPrediction()
+{
+    if (!isTouchPredictionEnabled_) {
+        return;
+    }
+    auto pipeline = PipelineContext::GetCurrentContext();
+    CHECK_NULL_VOID(pipeline);
+    pipeline->RequestTouchPrediction();
+}
+
 void PanRecognizer::OnFlushTouchEventsBegin()
 {
     isFlushTouchEventsEnd_ = false;
@@ -401,7 +462,7 @@ bool PanRecognizer::HandlePanAccept()
     return false;
 }
 
-void PanRecognizer::HandleTouchCancelEvent(const TouchEvent& /*event*/)
+void PanRecognizer::HandleTouchCancelEvent(const TouchEvent& event)
 {
     if ((refereeState_ != RefereeState::SUCCEED) && (refereeState_ != RefereeState::FAIL)) {
         Adjudicate(AceType::Claim(this), GestureDisposal::REJECT);
@@ -409,6 +470,7 @@ void PanRecognizer::HandleTouchCancelEvent(const TouchEvent& /*event*/)
     }
 
     if (refereeState_ == RefereeState::SUCCEED) {
+        RevertTouchPrediction(event);
         // AxisEvent is single one.
         SendCancelMsg();
     }
@@ -506,6 +568,7 @@ void PanRecognizer::OnResetStatus()
     touchPoints_.clear();
     averageDistance_.Reset();
     touchPointsDistance_.clear();
+    predictedOffsets_.clear();
 }
 
 void PanRecognizer::OnSucceedCancel()
@@ -77,6 +77,18 @@ public:
         isAllowMouse_ = isAllowMouse;
     }
 
+    // Moves the pan with the pointer position predicted to the present time of the frame, for less latency of
+    // the content following the finger.
+    void SetTouchPredictionEnabled(bool isTouchPredictionEnabled)
+    {
+        isTouchPredictionEnabled_ = isTouchPredictionEnabled;
+    }
+
+    bool IsTouchPredictionEnabled() const
+    {
+        return isTouchPredictionEnabled_;
+    }
+
     virtual RefPtr<GestureSnapshot> Dump() const override;
 
 private:
@@ -107,6 +119,8 @@ private:
     double GetMainAxisDelta();
     RefPtr<DragEventActuator> GetDragEventActuator();
     bool HandlePanAccept();
+    void RequestTouchPrediction();
+    void RevertTouchPrediction(const TouchEvent& event);
 
     void OnResetStatus() override;
     void OnSucceedCancel() override;
@@ -122,6 +136,8 @@ private:
     AxisEvent lastAxisEvent_;
     Offset averageDistance_;
     std::map<int32_t, Offset> touchPointsDistance_;
+    // offsets of the touch points moved ahead to the predicted positions.
+    std::map<int32_t, Offset> predictedOffsets_;
     Offset delta_;
     double mainDelta_ = 0.0;
     VelocityTracker velocityTracker_;
@@ -141,6 +157,7 @@ private:
     InputEventType inputEventType_ = InputEventType::TOUCH_SCREEN;
     bool isForDrag_ = false;
     bool isAllowMouse_ = true;
+    bool isTouchPredictionEnabled_ = false;
 };
 
 } // namespace OHOS::Ace::NG
@@ -55,11 +55,21 @@ void RecognizerGroup::AddChildren(const std::list<RefPtr<NGGestureRecognizer>>&
     // TODO: add state adjustment.
     for (const auto& child : recognizers) {
         if (child && !Existed(child) && child->SetGestureGroup(AceType::WeakClaim(this))) {
-            recognizers_.emplace_back(child);
+            PushBackChild(child);
         }
     }
 }
 
+void RecognizerGroup::PushBackChild(const RefPtr<NGGestureRecognizer>& recognizer)
+{
+    if (recycledNodes_.empty()) {
+        recognizers_.emplace_back(recognizer);
+        return;
+    }
+    recognizers_.splice(recognizers_.end(), recycledNodes_, recycledNodes_.begin());
+    recognizers_.back() = recognizer;
+}
+
 RefereeState RecognizerGroup::CheckStates(size_t touchId)
 {
     int count = 0;
@@ -147,12 +157,13 @@ void RecognizerGroup::OnResetStatus()
 {
     MultiFingersRecognizer::OnResetStatus();
     if (!remainChildOnResetStatus_) {
-        for (const auto& child : recognizers_) {
+        for (auto& child : recognizers_) {
             if (child) {
                 child->SetGestureGroup(nullptr);
+                child.Reset();
             }
         }
-        recognizers_.clear();
+        recycledNodes_.splice(recycledNodes_.end(), recognizers_);
     }
 }
 
@@ -69,7 +69,7 @@ public:
         }
 
         TouchEventTarget::AssignNodeId(id);
-        auto recognizers = GetGroupRecognizer();
+        const auto& recognizers = GetGroupRecognizer();
         for (const auto& recognizer : recognizers) {
             recognizer->AssignNodeId(id);
         }
@@ -78,7 +78,7 @@ public:
     void AttachFrameNode(const WeakPtr<NG::FrameNode>& node) override
     {
         TouchEventTarget::AttachFrameNode(node);
-        auto recognizers = GetGroupRecognizer();
+        const auto& recognizers = GetGroupRecognizer();
         for (const auto& recognizer : recognizers) {
             recognizer->AttachFrameNode(node);
         }
@@ -166,10 +166,13 @@ protected:
 
     bool Existed(const RefPtr<NGGestureRecognizer>& recognizer);
     bool CheckAllFailed();
+    void PushBackChild(const RefPtr<NGGestureRecognizer>& recognizer);
 
     void OnResetStatus() override;
 
     std::list<RefPtr<NGGestureRecognizer>> recognizers_;
+    // list nodes of the children released on reset, reused when children are added on the next touch down.
+    std::list<RefPtr<NGGestureRecognizer>> recycledNodes_;
     bool remainChildOnResetStatus_ = false;
 };
 
@@ -86,6 +86,7 @@ public:
         layoutAlgorithm_.Reset();
         skipMeasure_ = false;
         skipLayout_ = false;
+        measured_ = false;
     }
 
     std::optional<SizeF> MeasureContent(
@@ -103,6 +104,7 @@ public:
             return;
         }
         layoutAlgorithm_->Measure(layoutWrapper);
+        measured_ = true;
     }
 
     void Layout(LayoutWrapper* layoutWrapper) override
@@ -143,6 +145,12 @@ public:
         return skipLayout_;
     }
 
+    // whether the algorithm has measured the node, then it holds results to be taken by the pattern.
+    bool HasMeasured() const
+    {
+        return measured_;
+    }
+
     const RefPtr<LayoutAlgorithm>& GetLayoutAlgorithm() const
     {
         return layoutAlgorithm_;
@@ -185,6 +193,7 @@ private:
     bool skipLayout_ = false;
     bool percentHeight_ = false;
     bool percentWidth_ = false;
+    bool measured_ = false;
     uint64_t frameId = UITaskScheduler::GetFrameId();
 
     ACE_DISALLOW_COPY_AND_MOVE(LayoutAlgorithmWrapper);
@@ -160,40 +160,41 @@ void LayoutProperty::UpdateLayoutProperty(const LayoutProperty* layoutProperty)
 {
     layoutConstraint_ = layoutProperty->layoutConstraint_;
     if (layoutProperty->gridProperty_) {
-        gridProperty_ = std::make_unique<GridProperty>(*layoutProperty->gridProperty_);
+        gridProperty_ = layoutProperty->gridProperty_;
     }
     if (layoutProperty->calcLayoutConstraint_) {
-        calcLayoutConstraint_ = std::make_unique<MeasureProperty>(*layoutProperty->calcLayoutConstraint_);
+        calcLayoutConstraint_ = layoutProperty->calcLayoutConstraint_;
     }
     if (layoutProperty->padding_) {
-        padding_ = std::make_unique<PaddingProperty>(*layoutProperty->padding_);
+        padding_ = layoutProperty->padding_;
     }
     if (layoutProperty->margin_) {
-        margin_ = std::make_unique<PaddingProperty>(*layoutProperty->margin_);
+        margin_ = layoutProperty->margin_;
     }
     if (layoutProperty->borderWidth_) {
-        borderWidth_ = std::make_unique<BorderWidthProperty>(*layoutProperty->borderWidth_);
+        borderWidth_ = layoutProperty->borderWidth_;
     }
     if (layoutProperty->magicItemProperty_) {
-        magicItemProperty_ = std::make_unique<MagicItemProperty>(*layoutProperty->magicItemProperty_);
+        magicItemProperty_ = layoutProperty->magicItemProperty_;
     }
     if (layoutProperty->positionProperty_) {
-        positionProperty_ = std::make_unique<PositionProperty>(*layoutProperty->positionProperty_);
+        positionProperty_ = layoutProperty->positionProperty_;
     }
     if (layoutProperty->flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>(*layoutProperty->flexItemProperty_);
+        flexItemProperty_ = layoutProperty->flexItemProperty_;
     }
     if (layoutProperty->safeAreaInsets_) {
-        safeAreaInsets_ = std::make_unique<SafeAreaInsets>(*layoutProperty->safeAreaInsets_);
+        safeAreaInsets_ = layoutProperty->safeAreaInsets_;
     }
     if (layoutProperty->safeAreaExpandOpts_) {
-        safeAreaExpandOpts_ = std::make_unique<SafeAreaExpandOpts>(*layoutProperty->safeAreaExpandOpts_);
+        safeAreaExpandOpts_ = layoutProperty->safeAreaExpandOpts_;
     }
     geometryTransition_ = layoutProperty->geometryTransition_;
     propVisibility_ = layoutProperty->GetVisibility();
     measureType_ = layoutProperty->measureType_;
     layoutDirection_ = layoutProperty->layoutDirection_;
     propertyChangeFlag_ = layoutProperty->propertyChangeFlag_;
+    ++measureVersion_;
 #ifdef ENABLE_DRAG_FRAMEWORK
     propIsBindOverlay_ = layoutProperty->propIsBindOverlay_;
 #endif // ENABLE_DRAG_FRAMEWORK
@@ -205,17 +206,18 @@ void LayoutProperty::UpdateLayoutProperty(const LayoutProperty* layoutProperty)
 void LayoutProperty::UpdateCalcLayoutProperty(const MeasureProperty& constraint)
 {
     if (!calcLayoutConstraint_) {
-        calcLayoutConstraint_ = std::make_unique<MeasureProperty>(constraint);
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        calcLayoutConstraint_ = CowPtr<MeasureProperty>::Make(constraint);
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
         return;
     }
     if (*calcLayoutConstraint_ == constraint) {
         return;
     }
-    calcLayoutConstraint_->selfIdealSize = constraint.selfIdealSize;
-    calcLayoutConstraint_->maxSize = constraint.maxSize;
-    calcLayoutConstraint_->minSize = constraint.minSize;
-    propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    auto calcLayoutConstraint = calcLayoutConstraint_.Detach();
+    calcLayoutConstraint->selfIdealSize = constraint.selfIdealSize;
+    calcLayoutConstraint->maxSize = constraint.maxSize;
+    calcLayoutConstraint->minSize = constraint.minSize;
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
 }
 
 void LayoutProperty::UpdateLayoutConstraint(const LayoutConstraintF& parentConstraint)
@@ -321,11 +323,12 @@ void LayoutProperty::CheckAspectRatio()
 void LayoutProperty::BuildGridProperty(const RefPtr<FrameNode>& host)
 {
     CHECK_NULL_VOID(gridProperty_);
+    static const uint32_t gridContainerTagId = TagRegistry::GetInstance().Intern(V2::GRIDCONTAINER_ETS_TAG);
     auto parent = host->GetAncestorNodeOfFrame();
     while (parent) {
-        if (parent->GetTag() == V2::GRIDCONTAINER_ETS_TAG) {
+        if (parent->GetTagId() == gridContainerTagId) {
             auto containerLayout = parent->GetLayoutProperty();
-            gridProperty_->UpdateContainer(containerLayout, host);
+            gridProperty_.Detach()->UpdateContainer(containerLayout, host);
             UpdateUserDefinedIdealSize(CalcSize(CalcLength(gridProperty_->GetWidth()), std::nullopt));
             break;
         }
@@ -336,13 +339,13 @@ void LayoutProperty::BuildGridProperty(const RefPtr<FrameNode>& host)
 void LayoutProperty::UpdateGridProperty(std::optional<int32_t> span, std::optional<int32_t> offset, GridSizeType type)
 {
     if (!gridProperty_) {
-        gridProperty_ = std::make_unique<GridProperty>();
+        gridProperty_ = CowPtr<GridProperty>::Make();
     }
 
-    bool isSpanUpdated = (span.has_value() && gridProperty_->UpdateSpan(span.value(), type));
-    bool isOffsetUpdated = (offset.has_value() && gridProperty_->UpdateOffset(offset.value(), type));
+    bool isSpanUpdated = (span.has_value() && gridProperty_.Detach()->UpdateSpan(span.value(), type));
+    bool isOffsetUpdated = (offset.has_value() && gridProperty_.Detach()->UpdateOffset(offset.value(), type));
     if (isSpanUpdated || isOffsetUpdated) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
@@ -555,21 +558,21 @@ void LayoutProperty::OnVisibilityUpdate(VisibleType visible, bool allowTransitio
 void LayoutProperty::UpdateSafeAreaExpandOpts(const SafeAreaExpandOpts& opts)
 {
     if (!safeAreaExpandOpts_) {
-        safeAreaExpandOpts_ = std::make_unique<SafeAreaExpandOpts>();
+        safeAreaExpandOpts_ = CowPtr<SafeAreaExpandOpts>::Make();
     }
     if (*safeAreaExpandOpts_ != opts) {
-        *safeAreaExpandOpts_ = opts;
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
+        *safeAreaExpandOpts_.Detach() = opts;
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateSafeAreaInsets(const SafeAreaInsets& safeArea)
 {
     if (!safeAreaInsets_) {
-        safeAreaInsets_ = std::make_unique<SafeAreaInsets>();
+        safeAreaInsets_ = CowPtr<SafeAreaInsets>::Make();
     }
     if (*safeAreaInsets_ != safeArea) {
-        *safeAreaInsets_ = safeArea;
+        *safeAreaInsets_.Detach() = safeArea;
     }
 }
 
@@ -606,10 +609,12 @@ float LayoutProperty::GetAspectRatio() const
 void LayoutProperty::UpdateAspectRatio(float ratio)
 {
     if (!magicItemProperty_) {
-        magicItemProperty_ = std::make_unique<MagicItemProperty>();
+        magicItemProperty_ = CowPtr<MagicItemProperty>::Make();
+    } else if (magicItemProperty_->CheckAspectRatio(ratio)) {
+        return;
     }
-    if (magicItemProperty_->UpdateAspectRatio(ratio)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (magicItemProperty_.Detach()->UpdateAspectRatio(ratio)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
@@ -618,10 +623,11 @@ void LayoutProperty::ResetAspectRatio()
     if (!magicItemProperty_) {
         return;
     }
-    if (magicItemProperty_->HasAspectRatio()) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (!magicItemProperty_->HasAspectRatio()) {
+        return;
     }
-    magicItemProperty_->ResetAspectRatio();
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
+    magicItemProperty_.Detach()->ResetAspectRatio();
 }
 
 void LayoutProperty::UpdateGeometryTransition(const std::string& id, bool followWithoutTransition)
@@ -650,7 +656,7 @@ void LayoutProperty::UpdateGeometryTransition(const std::string& id, bool follow
         host->GetId(), geometryTransitionOld ? geometryTransitionOld->GetId().c_str() : "empty",
         geometryTransitionNew ? id.c_str() : "empty");
     ElementRegister::GetInstance()->DumpGeometryTransition();
-    propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE);
 }
 
 void LayoutProperty::UpdateLayoutDirection(TextDirection value)
@@ -659,106 +665,124 @@ void LayoutProperty::UpdateLayoutDirection(TextDirection value)
         return;
     }
     layoutDirection_ = value;
-    propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
 }
 
 void LayoutProperty::UpdateLayoutWeight(float value)
 {
     if (!magicItemProperty_) {
-        magicItemProperty_ = std::make_unique<MagicItemProperty>();
+        magicItemProperty_ = CowPtr<MagicItemProperty>::Make();
+    } else if (magicItemProperty_->CheckLayoutWeight(value)) {
+        return;
     }
-    if (magicItemProperty_->UpdateLayoutWeight(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (magicItemProperty_.Detach()->UpdateLayoutWeight(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateBorderWidth(const BorderWidthProperty& value)
 {
     if (!borderWidth_) {
-        borderWidth_ = std::make_unique<BorderWidthProperty>();
+        borderWidth_ = CowPtr<BorderWidthProperty>::Make();
+    } else if (*borderWidth_ == value) {
+        return;
     }
-    if (borderWidth_->UpdateWithCheck(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
+    if (borderWidth_.Detach()->UpdateWithCheck(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateOuterBorderWidth(const BorderWidthProperty& value)
 {
     if (!outerBorderWidth_) {
-        outerBorderWidth_ = std::make_unique<BorderWidthProperty>();
+        outerBorderWidth_ = CowPtr<BorderWidthProperty>::Make();
+    } else if (*outerBorderWidth_ == value) {
+        return;
     }
-    if (outerBorderWidth_->UpdateWithCheck(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
+    if (outerBorderWidth_.Detach()->UpdateWithCheck(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateAlignment(Alignment value)
 {
     if (!positionProperty_) {
-        positionProperty_ = std::make_unique<PositionProperty>();
+        positionProperty_ = CowPtr<PositionProperty>::Make();
+    } else if (positionProperty_->CheckAlignment(value)) {
+        return;
     }
-    if (positionProperty_->UpdateAlignment(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT;
+    if (positionProperty_.Detach()->UpdateAlignment(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT);
     }
 }
 
 void LayoutProperty::UpdateMargin(const MarginProperty& value)
 {
     if (!margin_) {
-        margin_ = std::make_unique<MarginProperty>();
+        margin_ = CowPtr<MarginProperty>::Make();
+    } else if (*margin_ == value) {
+        return;
     }
-    if (margin_->UpdateWithCheck(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
+    if (margin_.Detach()->UpdateWithCheck(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdatePadding(const PaddingProperty& value)
 {
     if (!padding_) {
-        padding_ = std::make_unique<PaddingProperty>();
+        padding_ = CowPtr<PaddingProperty>::Make();
+    } else if (*padding_ == value) {
+        return;
     }
-    if (padding_->UpdateWithCheck(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
+    if (padding_.Detach()->UpdateWithCheck(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateUserDefinedIdealSize(const CalcSize& value)
 {
     if (!calcLayoutConstraint_) {
-        calcLayoutConstraint_ = std::make_unique<MeasureProperty>();
+        calcLayoutConstraint_ = CowPtr<MeasureProperty>::Make();
+    } else if (calcLayoutConstraint_->selfIdealSize == value) {
+        return;
     }
-    if (calcLayoutConstraint_->UpdateSelfIdealSizeWithCheck(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (calcLayoutConstraint_.Detach()->UpdateSelfIdealSizeWithCheck(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::ClearUserDefinedIdealSize(bool clearWidth, bool clearHeight)
 {
-    if (!calcLayoutConstraint_) {
+    if (!calcLayoutConstraint_ || !calcLayoutConstraint_->selfIdealSize) {
         return;
     }
-    if (calcLayoutConstraint_->ClearSelfIdealSize(clearWidth, clearHeight)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (calcLayoutConstraint_.Detach()->ClearSelfIdealSize(clearWidth, clearHeight)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateCalcMinSize(const CalcSize& value)
 {
     if (!calcLayoutConstraint_) {
-        calcLayoutConstraint_ = std::make_unique<MeasureProperty>();
+        calcLayoutConstraint_ = CowPtr<MeasureProperty>::Make();
+    } else if (calcLayoutConstraint_->minSize == value) {
+        return;
     }
-    if (calcLayoutConstraint_->UpdateMinSizeWithCheck(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (calcLayoutConstraint_.Detach()->UpdateMinSizeWithCheck(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateCalcMaxSize(const CalcSize& value)
 {
     if (!calcLayoutConstraint_) {
-        calcLayoutConstraint_ = std::make_unique<MeasureProperty>();
+        calcLayoutConstraint_ = CowPtr<MeasureProperty>::Make();
+    } else if (calcLayoutConstraint_->maxSize == value) {
+        return;
     }
-    if (calcLayoutConstraint_->UpdateMaxSizeWithCheck(value)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (calcLayoutConstraint_.Detach()->UpdateMaxSizeWithCheck(value)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
@@ -768,7 +792,7 @@ void LayoutProperty::UpdateMarginSelfIdealSize(const SizeF& value)
         layoutConstraint_ = LayoutConstraintF();
     }
     if (layoutConstraint_->UpdateSelfMarginSizeWithCheck(OptionalSizeF(value))) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
@@ -777,10 +801,11 @@ void LayoutProperty::ResetCalcMinSize()
     if (!calcLayoutConstraint_) {
         return;
     }
-    if (calcLayoutConstraint_->minSize.has_value()) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (!calcLayoutConstraint_->minSize.has_value()) {
+        return;
     }
-    calcLayoutConstraint_->minSize.reset();
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
+    calcLayoutConstraint_.Detach()->minSize.reset();
 }
 
 void LayoutProperty::ResetCalcMaxSize()
@@ -788,10 +813,11 @@ void LayoutProperty::ResetCalcMaxSize()
     if (!calcLayoutConstraint_) {
         return;
     }
-    if (calcLayoutConstraint_->maxSize.has_value()) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (!calcLayoutConstraint_->maxSize.has_value()) {
+        return;
     }
-    calcLayoutConstraint_->maxSize.reset();
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
+    calcLayoutConstraint_.Detach()->maxSize.reset();
 }
 
 void LayoutProperty::ResetCalcMinSize(bool resetWidth)
@@ -803,11 +829,11 @@ void LayoutProperty::ResetCalcMinSize(bool resetWidth)
     bool resetSizeHasValue = resetWidth ? calcLayoutConstraint_->minSize.value().Width().has_value()
                                         : calcLayoutConstraint_->minSize.value().Height().has_value();
     CHECK_NULL_VOID(resetSizeHasValue);
-    propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     if (resetWidth) {
-        calcLayoutConstraint_->minSize.value().SetWidth(std::nullopt);
+        calcLayoutConstraint_.Detach()->minSize.value().SetWidth(std::nullopt);
     } else {
-        calcLayoutConstraint_->minSize.value().SetHeight(std::nullopt);
+        calcLayoutConstraint_.Detach()->minSize.value().SetHeight(std::nullopt);
     }
 }
 
@@ -820,21 +846,23 @@ void LayoutProperty::ResetCalcMaxSize(bool resetWidth)
     bool resetSizeHasValue = resetWidth ? calcLayoutConstraint_->maxSize.value().Width().has_value()
                                         : calcLayoutConstraint_->maxSize.value().Height().has_value();
     CHECK_NULL_VOID(resetSizeHasValue);
-    propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     if (resetWidth) {
-        calcLayoutConstraint_->maxSize.value().SetWidth(std::nullopt);
+        calcLayoutConstraint_.Detach()->maxSize.value().SetWidth(std::nullopt);
     } else {
-        calcLayoutConstraint_->maxSize.value().SetHeight(std::nullopt);
+        calcLayoutConstraint_.Detach()->maxSize.value().SetHeight(std::nullopt);
     }
 }
 
 void LayoutProperty::UpdateFlexGrow(float flexGrow)
 {
     if (!flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>();
+        flexItemProperty_ = CowPtr<FlexItemProperty>::Make();
+    } else if (flexItemProperty_->CheckFlexGrow(flexGrow)) {
+        return;
     }
-    if (flexItemProperty_->UpdateFlexGrow(flexGrow)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (flexItemProperty_.Detach()->UpdateFlexGrow(flexGrow)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
@@ -843,19 +871,22 @@ void LayoutProperty::ResetFlexGrow()
     if (!flexItemProperty_) {
         return;
     }
-    if (flexItemProperty_->HasFlexGrow()) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (!flexItemProperty_->HasFlexGrow()) {
+        return;
     }
-    flexItemProperty_->ResetFlexGrow();
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
+    flexItemProperty_.Detach()->ResetFlexGrow();
 }
 
 void LayoutProperty::UpdateFlexShrink(float flexShrink)
 {
     if (!flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>();
+        flexItemProperty_ = CowPtr<FlexItemProperty>::Make();
+    } else if (flexItemProperty_->CheckFlexShrink(flexShrink)) {
+        return;
     }
-    if (flexItemProperty_->UpdateFlexShrink(flexShrink)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (flexItemProperty_.Detach()->UpdateFlexShrink(flexShrink)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
@@ -864,29 +895,34 @@ void LayoutProperty::ResetFlexShrink()
     if (!flexItemProperty_) {
         return;
     }
-    if (flexItemProperty_->HasFlexShrink()) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (!flexItemProperty_->HasFlexShrink()) {
+        return;
     }
-    flexItemProperty_->ResetFlexShrink();
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
+    flexItemProperty_.Detach()->ResetFlexShrink();
 }
 
 void LayoutProperty::UpdateFlexBasis(const Dimension& flexBasis)
 {
     if (!flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>();
+        flexItemProperty_ = CowPtr<FlexItemProperty>::Make();
+    } else if (flexItemProperty_->CheckFlexBasis(flexBasis)) {
+        return;
     }
-    if (flexItemProperty_->UpdateFlexBasis(flexBasis)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (flexItemProperty_.Detach()->UpdateFlexBasis(flexBasis)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateAlignSelf(const FlexAlign& flexAlign)
 {
     if (!flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>();
+        flexItemProperty_ = CowPtr<FlexItemProperty>::Make();
+    } else if (flexItemProperty_->CheckAlignSelf(flexAlign)) {
+        return;
     }
-    if (flexItemProperty_->UpdateAlignSelf(flexAlign)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (flexItemProperty_.Detach()->UpdateAlignSelf(flexAlign)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
@@ -895,39 +931,48 @@ void LayoutProperty::ResetAlignSelf()
     if (!flexItemProperty_) {
         return;
     }
-    if (flexItemProperty_->HasAlignSelf()) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (!flexItemProperty_->HasAlignSelf()) {
+        return;
     }
-    flexItemProperty_->ResetAlignSelf();
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
+    flexItemProperty_.Detach()->ResetAlignSelf();
 }
 
 void LayoutProperty::UpdateAlignRules(const std::map<AlignDirection, AlignRule>& alignRules)
 {
     if (!flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>();
+        flexItemProperty_ = CowPtr<FlexItemProperty>::Make();
+    } else if (flexItemProperty_->CheckAlignRules(alignRules)) {
+        // keep sharing the property when it is set again with the same value.
+        return;
     }
-    if (flexItemProperty_->UpdateAlignRules(alignRules)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (flexItemProperty_.Detach()->UpdateAlignRules(alignRules)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateBias(const BiasPair& biasPair)
 {
     if (!flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>();
+        flexItemProperty_ = CowPtr<FlexItemProperty>::Make();
+    } else if (flexItemProperty_->CheckBias(biasPair)) {
+        // keep sharing the property when it is set again with the same value.
+        return;
     }
-    if (flexItemProperty_->UpdateBias(biasPair)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (flexItemProperty_.Detach()->UpdateBias(biasPair)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
 void LayoutProperty::UpdateDisplayIndex(int32_t displayIndex)
 {
     if (!flexItemProperty_) {
-        flexItemProperty_ = std::make_unique<FlexItemProperty>();
+        flexItemProperty_ = CowPtr<FlexItemProperty>::Make();
+    } else if (flexItemProperty_->CheckDisplayIndex(displayIndex)) {
+        return;
     }
-    if (flexItemProperty_->UpdateDisplayIndex(displayIndex)) {
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+    if (flexItemProperty_.Detach()->UpdateDisplayIndex(displayIndex)) {
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
     }
 }
 
@@ -942,8 +987,7 @@ void LayoutProperty::UpdateLayoutConstraint(const RefPtr<LayoutProperty>& layout
 {
     layoutConstraint_ = layoutProperty->layoutConstraint_;
     contentConstraint_ = layoutProperty->contentConstraint_;
-    gridProperty_ =
-        (layoutProperty->gridProperty_) ? std::make_unique<GridProperty>(*layoutProperty->gridProperty_) : nullptr;
+    gridProperty_ = layoutProperty->gridProperty_;
 }
 
 void LayoutProperty::UpdateVisibility(const VisibleType& value, bool allowTransition)
@@ -987,7 +1031,7 @@ void LayoutProperty::SetOverlayOffset(
         overlayOffsetY_.Reset();
     }
 
-    propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE;
+    UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT | PROPERTY_UPDATE_MEASURE);
 }
 
 void LayoutProperty::GetOverlayOffset(Dimension& overlayOffsetX, Dimension& overlayOffsetY)
@@ -73,42 +73,42 @@ public:
         return contentConstraint_;
     }
 
-    const std::unique_ptr<MagicItemProperty>& GetMagicItemProperty() const
+    const CowPtr<MagicItemProperty>& GetMagicItemProperty() const
     {
         return magicItemProperty_;
     }
 
-    const std::unique_ptr<PaddingProperty>& GetPaddingProperty() const
+    const CowPtr<PaddingProperty>& GetPaddingProperty() const
     {
         return padding_;
     }
 
-    const std::unique_ptr<MarginProperty>& GetMarginProperty() const
+    const CowPtr<MarginProperty>& GetMarginProperty() const
     {
         return margin_;
     }
 
-    const std::unique_ptr<BorderWidthProperty>& GetBorderWidthProperty() const
+    const CowPtr<BorderWidthProperty>& GetBorderWidthProperty() const
     {
         return borderWidth_;
     }
 
-    const std::unique_ptr<BorderWidthProperty>& GetOuterBorderWidthProperty() const
+    const CowPtr<BorderWidthProperty>& GetOuterBorderWidthProperty() const
     {
         return outerBorderWidth_;
     }
 
-    const std::unique_ptr<PositionProperty>& GetPositionProperty() const
+    const CowPtr<PositionProperty>& GetPositionProperty() const
     {
         return positionProperty_;
     }
 
-    const std::unique_ptr<MeasureProperty>& GetCalcLayoutConstraint() const
+    const CowPtr<MeasureProperty>& GetCalcLayoutConstraint() const
     {
         return calcLayoutConstraint_;
     }
 
-    const std::unique_ptr<FlexItemProperty>& GetFlexItemProperty() const
+    const CowPtr<FlexItemProperty>& GetFlexItemProperty() const
     {
         return flexItemProperty_;
     }
@@ -158,7 +158,7 @@ public:
         if (measureType_ == measureType) {
             return;
         }
-        propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+        UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
         measureType_ = measureType;
     }
 
@@ -238,14 +238,14 @@ public:
 
     void UpdateLayoutConstraint(const RefPtr<LayoutProperty>& layoutProperty);
 
-    const std::unique_ptr<SafeAreaInsets>& GetSafeAreaInsets() const
+    const CowPtr<SafeAreaInsets>& GetSafeAreaInsets() const
     {
         return safeAreaInsets_;
     }
 
     void UpdateSafeAreaInsets(const SafeAreaInsets& safeArea);
 
-    const std::unique_ptr<SafeAreaExpandOpts>& GetSafeAreaExpandOpts() const
+    const CowPtr<SafeAreaExpandOpts>& GetSafeAreaExpandOpts() const
     {
         return safeAreaExpandOpts_;
     }
@@ -300,20 +300,21 @@ private:
     std::optional<LayoutConstraintF> layoutConstraint_;
     std::optional<LayoutConstraintF> contentConstraint_;
 
-    std::unique_ptr<MeasureProperty> calcLayoutConstraint_;
-    std::unique_ptr<PaddingProperty> padding_;
-    std::unique_ptr<MarginProperty> margin_;
+    // groups are shared with the clones until modified, see CowPtr.
+    CowPtr<MeasureProperty> calcLayoutConstraint_;
+    CowPtr<PaddingProperty> padding_;
+    CowPtr<MarginProperty> margin_;
     std::optional<MarginPropertyF> marginResult_;
 
-    std::unique_ptr<SafeAreaExpandOpts> safeAreaExpandOpts_;
-    std::unique_ptr<SafeAreaInsets> safeAreaInsets_;
+    CowPtr<SafeAreaExpandOpts> safeAreaExpandOpts_;
+    CowPtr<SafeAreaInsets> safeAreaInsets_;
 
-    std::unique_ptr<BorderWidthProperty> borderWidth_;
-    std::unique_ptr<BorderWidthProperty> outerBorderWidth_;
-    std::unique_ptr<MagicItemProperty> magicItemProperty_;
-    std::unique_ptr<PositionProperty> positionProperty_;
-    std::unique_ptr<FlexItemProperty> flexItemProperty_;
-    std::unique_ptr<GridProperty> gridProperty_;
+    CowPtr<BorderWidthProperty> borderWidth_;
+    CowPtr<BorderWidthProperty> outerBorderWidth_;
+    CowPtr<MagicItemProperty> magicItemProperty_;
+    CowPtr<PositionProperty> positionProperty_;
+    CowPtr<FlexItemProperty> flexItemProperty_;
+    CowPtr<GridProperty> gridProperty_;
     std::optional<MeasureType> measureType_;
     std::optional<TextDirection> layoutDirection_;
 
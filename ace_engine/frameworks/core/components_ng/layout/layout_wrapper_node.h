@@ -23,6 +23,7 @@
 
 #include "base/geometry/offset.h"
 #include "base/memory/ace_type.h"
+#include "base/memory/frame_arena.h"
 #include "base/memory/referenced.h"
 #include "base/thread/cancelable_callback.h"
 #include "base/utils/macros.h"
@@ -47,7 +48,7 @@ class LayoutWrapperNode;
 
 using LazyBuildFunction = std::function<void(RefPtr<LayoutWrapperNode>)>;
 
-class ACE_EXPORT LayoutWrapperNode : public LayoutWrapper {
+class ACE_EXPORT LayoutWrapperNode : public LayoutWrapper, public FrameArenaObject {
     DECLARE_ACE_TYPE(LayoutWrapperNode, LayoutWrapper)
 public:
     LayoutWrapperNode(
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_LAYOUTS_MEASURE_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_LAYOUTS_MEASURE_CACHE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "base/geometry/ng/size_t.h"
+#include "core/components_ng/layout/layout_property.h"
+#include "core/components_ng/property/layout_constraint.h"
+
+namespace OHOS::Ace::NG {
+
+/**
+ * MeasureCache keeps the sizes a node measured with its last few constraints. Containers like Flex and Grid measure a
+ * child with several constraints in one pass, a child whose layout property is not changed since then takes the size
+ * from the cache instead of measuring its subtree again. An entry is valid as long as the measure version of the
+ * layout property is the one it was measured with, so it is invalidated by any change flagged to remeasure, including
+ * the requests propagated from the children.
+ *
+ * Only one of the entries matches the geometry of the children, the one measured last. When the node takes another
+ * entry, its children are measured again before the node is laid out.
+ */
+class MeasureCache final {
+public:
+    static constexpr size_t CAPACITY = 4;
+
+    struct Entry {
+        std::optional<LayoutConstraintF> layoutConstraint;
+        std::optional<LayoutConstraintF> contentConstraint;
+        SizeF frameSize;
+        std::optional<SizeF> contentSize;
+        std::optional<float> baselineDistance;
+        uint32_t version = 0;
+    };
+
+    MeasureCache() = default;
+    ~MeasureCache() = default;
+
+    // return the index of the entry measured with the constraints now set in layoutProperty, -1 if there is none.
+    int32_t Find(const RefPtr<LayoutProperty>& layoutProperty) const
+    {
+        auto version = layoutProperty->GetMeasureVersion();
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            const auto& entry = entries_[i];
+            if (entry.version == version &&
+                layoutProperty->ConstraintEqual(entry.layoutConstraint, entry.contentConstraint)) {
+                return static_cast<int32_t>(i);
+            }
+        }
+        return -1;
+    }
+
+    const Entry& GetEntry(int32_t index) const
+    {
+        return entries_[index];
+    }
+
+    // add the result of measuring the node and its children, it replaces the entry with the same constraints or
+    // evicts the oldest one when the cache is full.
+    void Add(Entry&& entry)
+    {
+        auto iter = std::find_if(entries_.begin(), entries_.end(), [&entry](const Entry& item) {
+            return item.version == entry.version && item.layoutConstraint == entry.layoutConstraint &&
+                   item.contentConstraint == entry.contentConstraint;
+        });
+        if (iter != entries_.end()) {
+            entries_.erase(iter);
+        } else if (entries_.size() >= CAPACITY) {
+            entries_.pop_back();
+        }
+        entries_.insert(entries_.begin(), std::move(entry));
+        subtreeIndex_ = 0;
+        pendingParentConstraint_.reset();
+        pending_ = false;
+    }
+
+    // whether the children are measured with the constraint of the entry.
+    bool IsSubtreeEntry(int32_t index) const
+    {
+        return index == subtreeIndex_;
+    }
+
+    void SetPending(const std::optional<LayoutConstraintF>& parentConstraint)
+    {
+        pendingParentConstraint_ = parentConstraint;
+        pending_ = true;
+    }
+
+    void ResetPending()
+    {
+        pendingParentConstraint_.reset();
+        pending_ = false;
+    }
+
+    // the node took an entry whose children are not measured, they have to be measured before layout.
+    bool IsPending() const
+    {
+        return pending_;
+    }
+
+    const std::optional<LayoutConstraintF>& GetPendingParentConstraint() const
+    {
+        return pendingParentConstraint_;
+    }
+
+    void Clear()
+    {
+        entries_.clear();
+        subtreeIndex_ = -1;
+        ResetPending();
+    }
+
+private:
+    std::vector<Entry> entries_;
+    int32_t subtreeIndex_ = -1;
+    std::optional<LayoutConstraintF> pendingParentConstraint_;
+    bool pending_ = false;
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_LAYOUTS_MEASURE_CACHE_H
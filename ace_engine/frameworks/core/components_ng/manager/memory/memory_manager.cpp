@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/manager/memory/memory_manager.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "base/log/ace_trace.h"
+#include "base/log/dump_log.h"
+#include "base/utils/utils.h"
+#include "core/components_ng/base/frame_node.h"
+#include "core/pipeline/base/element_register.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr size_t BYTES_PER_KB = 1024;
+const char* CATEGORY_NAMES[] = { "image", "other" };
+} // namespace
+
+void MemoryManager::UpdateUsage(const RefPtr<FrameNode>& node, MemoryCategory category, size_t bytes)
+{
+    CHECK_NULL_VOID(node);
+    RemoveUsage(node->GetId());
+    if (bytes == 0) {
+        return;
+    }
+    auto pageNode = node->GetPageNode();
+    auto pageId = pageNode ? pageNode->GetId() : MEMORY_NO_PAGE_ID;
+    records_[node->GetId()] = { pageId, category, bytes };
+    pageBytes_[pageId][static_cast<size_t>(category)] += bytes;
+    totalBytes_ += bytes;
+    if (pageId != MEMORY_NO_PAGE_ID && std::find(pageOrder_.begin(), pageOrder_.end(), pageId) == pageOrder_.end()) {
+        // never shown yet, treat it as the coldest one.
+        pageOrder_.emplace_front(pageId);
+    }
+}
+
+void MemoryManager::RemoveUsage(int32_t nodeId)
+{
+    auto iter = records_.find(nodeId);
+    if (iter == records_.end()) {
+        return;
+    }
+    const auto& record = iter->second;
+    auto pageIter = pageBytes_.find(record.pageId);
+    if (pageIter != pageBytes_.end()) {
+        auto& bytes = pageIter->second[static_cast<size_t>(record.category)];
+        bytes -= std::min(bytes, record.bytes);
+    }
+    totalBytes_ -= std::min(totalBytes_, record.bytes);
+    records_.erase(iter);
+}
+
+void MemoryManager::OnPageShow(int32_t pageId)
+{
+    // drop pages holding nothing, the order list only needs to rank pages in the ledger.
+    pageOrder_.remove_if([this, pageId](int32_t id) {
+        if (id != pageId && GetPageBytes(id) == 0) {
+            pageBytes_.erase(id);
+            return true;
+        }
+        return id == pageId;
+    });
+    pageOrder_.emplace_back(pageId);
+}
+
+size_t MemoryManager::GetPageBytes(int32_t pageId) const
+{
+    auto iter = pageBytes_.find(pageId);
+    if (iter == pageBytes_.end()) {
+        return 0;
+    }
+    size_t total = 0;
+    for (auto bytes : iter->second) {
+        total += bytes;
+    }
+    return total;
+}
+
+size_t MemoryManager::GetTrimTarget(int32_t level) const
+{
+    if (level >= MEMORY_LEVEL_CRITICAL) {
+        return 0;
+    }
+    if (level == MEMORY_LEVEL_LOW) {
+        return budget_ / 2;
+    }
+    return budget_;
+}
+
+void MemoryManager::TrimMemory(int32_t level)
+{
+    auto target = GetTrimTarget(level);
+    if (totalBytes_ <= target) {
+        return;
+    }
+    ACE_SCOPED_TRACE("TrimMemory level:%d, total:%zu, target:%zu", level, totalBytes_, target);
+    // the top page and nodes out of pages are only trimmed on critical level.
+    std::vector<int32_t> pages(pageOrder_.begin(), pageOrder_.end());
+    auto currentPageId = pages.empty() ? MEMORY_NO_PAGE_ID : pages.back();
+    if (!pages.empty()) {
+        pages.pop_back();
+    }
+    if (level >= MEMORY_LEVEL_CRITICAL) {
+        if (currentPageId != MEMORY_NO_PAGE_ID) {
+            pages.emplace_back(currentPageId);
+        }
+        pages.emplace_back(MEMORY_NO_PAGE_ID);
+    }
+    for (auto pageId : pages) {
+        TrimPage(pageId, level);
+        if (totalBytes_ <= target) {
+            break;
+        }
+    }
+}
+
+void MemoryManager::TrimPage(int32_t pageId, int32_t level)
+{
+    std::vector<int32_t> nodeIds;
+    for (const auto& [nodeId, record] : records_) {
+        if (record.pageId == pageId) {
+            nodeIds.emplace_back(nodeId);
+        }
+    }
+    for (auto nodeId : nodeIds) {
+        auto node = ElementRegister::GetInstance()->GetUINodeById(nodeId);
+        if (!node) {
+            RemoveUsage(nodeId);
+            continue;
+        }
+        // the node reports the memory it keeps after releasing.
+        node->OnNotifyMemoryLevel(level);
+    }
+}
+
+void MemoryManager::DumpInfo() const
+{
+    DumpLog::GetInstance().Print("------------MemoryInfo------------");
+    DumpLog::GetInstance().Print("Total(KB): " + std::to_string(totalBytes_ / BYTES_PER_KB) +
+                                 ", Budget(KB): " + std::to_string(budget_ / BYTES_PER_KB));
+    auto dumpPage = [this](int32_t pageId, const CategoryBytes& bytes) {
+        std::string info = "Page: " + std::to_string(pageId);
+        for (size_t i = 0; i < bytes.size(); ++i) {
+            info.append(", ").append(CATEGORY_NAMES[i]).append("(KB): ");
+            info.append(std::to_string(bytes[i] / BYTES_PER_KB));
+        }
+        DumpLog::GetInstance().Print(1, info);
+    };
+    // hottest page first
+    for (auto iter = pageOrder_.rbegin(); iter != pageOrder_.rend(); ++iter) {
+        auto pageIter = pageBytes_.find(*iter);
+        if (pageIter != pageBytes_.end()) {
+            dumpPage(*iter, pageIter->second);
+        }
+    }
+    auto noPageIter = pageBytes_.find(MEMORY_NO_PAGE_ID);
+    if (noPageIter != pageBytes_.end()) {
+        dumpPage(MEMORY_NO_PAGE_ID, noPageIter->second);
+    }
+}
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_MANAGER_MEMORY_MEMORY_MANAGER_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_MANAGER_MEMORY_MEMORY_MANAGER_H
+
+#include <array>
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+#include "base/utils/macros.h"
+
+namespace OHOS::Ace::NG {
+class FrameNode;
+
+// memory levels notified by the system, see PipelineBase::NotifyMemoryLevel.
+constexpr int32_t MEMORY_LEVEL_MODERATE = 0;
+constexpr int32_t MEMORY_LEVEL_LOW = 1;
+constexpr int32_t MEMORY_LEVEL_CRITICAL = 2;
+// records of nodes not under any page, such as overlays.
+constexpr int32_t MEMORY_NO_PAGE_ID = -1;
+constexpr size_t DEFAULT_MEMORY_BUDGET = 128 * 1024 * 1024;
+
+enum class MemoryCategory : uint8_t {
+    IMAGE = 0,
+    OTHER,
+    COUNT,
+};
+
+/**
+ * Ledger of the approximate memory retained by components, grouped by page. Components report what
+ * they hold, and on memory pressure the nodes of the least recently shown pages are asked to release
+ * memory first through FrameNode::OnNotifyMemoryLevel.
+ */
+class ACE_FORCE_EXPORT MemoryManager : public virtual AceType {
+    DECLARE_ACE_TYPE(MemoryManager, AceType);
+
+public:
+    MemoryManager() = default;
+    ~MemoryManager() override = default;
+
+    // Records [bytes] retained by [node], 0 removes the record of the node.
+    void UpdateUsage(const RefPtr<FrameNode>& node, MemoryCategory category, size_t bytes);
+    void RemoveUsage(int32_t nodeId);
+
+    // Called when [pageId] becomes the top page, pages shown earlier are colder.
+    void OnPageShow(int32_t pageId);
+
+    // Asks the nodes of the coldest pages to release memory until the ledger fits the target of [level].
+    void TrimMemory(int32_t level);
+
+    // Asks the nodes of [pageId] to release what they can regenerate, used when the page is hibernated.
+    void ReleasePage(int32_t pageId)
+    {
+        TrimPage(pageId, MEMORY_LEVEL_MODERATE);
+    }
+
+    void SetBudget(size_t budget)
+    {
+        budget_ = budget;
+    }
+
+    size_t GetTotalBytes() const
+    {
+        return totalBytes_;
+    }
+
+    size_t GetPageBytes(int32_t pageId) const;
+
+    void DumpInfo() const;
+
+private:
+    struct MemoryRecord {
+        int32_t pageId = MEMORY_NO_PAGE_ID;
+        MemoryCategory category = MemoryCategory::OTHER;
+        size_t bytes = 0;
+    };
+    using CategoryBytes = std::array<size_t, static_cast<size_t>(MemoryCategory::COUNT)>;
+
+    size_t GetTrimTarget(int32_t level) const;
+    void TrimPage(int32_t pageId, int32_t level);
+
+    // node id -> record
+    std::unordered_map<int32_t, MemoryRecord> records_;
+    std::unordered_map<int32_t, CategoryBytes> pageBytes_;
+    // page ids, coldest first
+    std::list<int32_t> pageOrder_;
+    size_t totalBytes_ = 0;
+    size_t budget_ = DEFAULT_MEMORY_BUDGET;
+
+    ACE_DISALLOW_COPY_AND_MOVE(MemoryManager);
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_MANAGER_MEMORY_MEMORY_MANAGER_H
@@ -217,8 +217,11 @@ bool SharedTransitionExchange::CreateSizeAnimation(const RefPtr<FrameNode>& src,
     finishCallbacks_.emplace_back([weakFrame = WeakPtr<FrameNode>(src), initSize, initAspectRatio]() {
         auto src = weakFrame.Upgrade();
         CHECK_NULL_VOID(src);
-        if (src->GetLayoutProperty()->GetCalcLayoutConstraint()) {
-            src->GetLayoutProperty()->GetCalcLayoutConstraint()->selfIdealSize = initSize;
+        const auto& layoutProperty = src->GetLayoutProperty();
+        if (layoutProperty->GetCalcLayoutConstraint()) {
+            MeasureProperty constraint = *layoutProperty->GetCalcLayoutConstraint();
+            constraint.selfIdealSize = initSize;
+            layoutProperty->UpdateCalcLayoutProperty(constraint);
         }
         if (initAspectRatio.has_value()) {
             src->GetLayoutProperty()->UpdateAspectRatio(initAspectRatio.value());
@@ -36,6 +36,12 @@ public:
         };
     }
 
+    // the draw function only holds the paint method and the paint wrapper, it is safe to create off the UI thread.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return BACKGROUND_TASK;
+    }
+
     void PaintRect(RSCanvas& canvas, PaintWrapper* paintWrapper);
 
 private:
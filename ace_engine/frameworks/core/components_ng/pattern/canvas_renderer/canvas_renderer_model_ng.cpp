@@ -1415,7 +1415,10 @@ void CanvasRendererModelNG::GetImageDataModel(const BaseInfo& baseInfo, const Im
     auto finalWidth = static_cast<uint32_t>(std::abs(imageSize.width));
     std::unique_ptr<Ace::ImageData> data = GetImageData(baseInfo, imageSize);
 
-    if (data != nullptr) {
+    if (data != nullptr && data->pixels) {
+        auto count = std::min(static_cast<size_t>(finalHeight) * finalWidth, data->pixels->size());
+        ConvertBgraToRgba(data->pixels->data(), buffer, count);
+    } else if (data != nullptr) {
         for (uint32_t idx = 0; idx < finalHeight * finalWidth; ++idx) {
             buffer[4 * idx] = data->data[idx].GetRed();
             buffer[4 * idx + 1] = data->data[idx].GetGreen();
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/custom_paint/canvas_command_list.h"
+
+#include "base/utils/utils.h"
+#include "core/components_ng/pattern/custom_paint/canvas_paint_method.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr size_t ARG_COUNT[] = {
+    0, // TASK
+    4, // FILL_RECT
+    4, // STROKE_RECT
+    4, // CLEAR_RECT
+    4, // ADD_RECT
+    0, // BEGIN_PATH
+    0, // CLOSE_PATH
+    2, // MOVE_TO
+    2, // LINE_TO
+    6, // ARC
+    6, // BEZIER_CURVE_TO
+    4, // QUADRATIC_CURVE_TO
+    0, // FILL
+    0, // STROKE
+};
+static_assert(sizeof(ARG_COUNT) / sizeof(ARG_COUNT[0]) == static_cast<size_t>(CanvasCommand::COUNT),
+    "ARG_COUNT must match CanvasCommand");
+} // namespace
+
+size_t CanvasCommandList::GetArgCount(CanvasCommand command)
+{
+    return ARG_COUNT[static_cast<size_t>(command)];
+}
+
+void CanvasCommandList::AddRecord(CanvasCommand command)
+{
+    if (!records_.empty() && records_.back().command == command) {
+        ++records_.back().count;
+        return;
+    }
+    records_.push_back({ command, 1 });
+}
+
+void CanvasCommandList::PushTask(const TaskFunc& task)
+{
+    tasks_.emplace_back(task);
+    AddRecord(CanvasCommand::TASK);
+}
+
+void CanvasCommandList::Push(CanvasCommand command, std::initializer_list<double> args)
+{
+    if (command == CanvasCommand::TASK || command >= CanvasCommand::COUNT || args.size() != GetArgCount(command)) {
+        return;
+    }
+    args_.insert(args_.end(), args.begin(), args.end());
+    AddRecord(command);
+}
+
+void CanvasCommandList::Replay(CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) const
+{
+    size_t argIndex = 0;
+    size_t taskIndex = 0;
+    // records may be appended by a task during the replay, and a command of the same type is counted into the last
+    // record, so the containers are accessed by index and the count is read again on each step.
+    for (size_t recordIndex = 0; recordIndex < records_.size(); ++recordIndex) {
+        auto command = records_[recordIndex].command;
+        for (uint32_t i = 0; i < records_[recordIndex].count; ++i) {
+            const double* arg = args_.data() + argIndex;
+            argIndex += GetArgCount(command);
+            switch (command) {
+                case CanvasCommand::TASK:
+                    tasks_[taskIndex++](paintMethod, paintWrapper);
+                    break;
+                case CanvasCommand::FILL_RECT:
+                    paintMethod.FillRect(paintWrapper, Rect(arg[0], arg[1], arg[2], arg[3]));
+                    break;
+                case CanvasCommand::STROKE_RECT:
+                    paintMethod.StrokeRect(paintWrapper, Rect(arg[0], arg[1], arg[2], arg[3]));
+                    break;
+                case CanvasCommand::CLEAR_RECT:
+                    paintMethod.ClearRect(paintWrapper, Rect(arg[0], arg[1], arg[2], arg[3]));
+                    break;
+                case CanvasCommand::ADD_RECT:
+                    paintMethod.AddRect(paintWrapper, Rect(arg[0], arg[1], arg[2], arg[3]));
+                    break;
+                case CanvasCommand::BEGIN_PATH:
+                    paintMethod.BeginPath();
+                    break;
+                case CanvasCommand::CLOSE_PATH:
+                    paintMethod.ClosePath();
+                    break;
+                case CanvasCommand::MOVE_TO:
+                    paintMethod.MoveTo(paintWrapper, arg[0], arg[1]);
+                    break;
+                case CanvasCommand::LINE_TO:
+                    paintMethod.LineTo(paintWrapper, arg[0], arg[1]);
+                    break;
+                case CanvasCommand::ARC: {
+                    ArcParam param { arg[0], arg[1], arg[2], arg[3], arg[4], !NearZero(arg[5]) };
+                    paintMethod.Arc(paintWrapper, param);
+                    break;
+                }
+                case CanvasCommand::BEZIER_CURVE_TO: {
+                    BezierCurveParam param { arg[0], arg[1], arg[2], arg[3], arg[4], arg[5] };
+                    paintMethod.BezierCurveTo(paintWrapper, param);
+                    break;
+                }
+                case CanvasCommand::QUADRATIC_CURVE_TO: {
+                    QuadraticCurveParam param { arg[0], arg[1], arg[2], arg[3] };
+                    paintMethod.QuadraticCurveTo(paintWrapper, param);
+                    break;
+                }
+                case CanvasCommand::FILL:
+                    paintMethod.Fill(paintWrapper);
+                    break;
+                case CanvasCommand::STROKE:
+                    paintMethod.Stroke(paintWrapper);
+                    break;
+                default:
+                    break;
+            }
+        }
+    }
+}
+} // namespace OHOS::Ace::NG
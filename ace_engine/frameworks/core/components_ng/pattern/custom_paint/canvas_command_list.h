@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_CUSTOM_PAINT_CANVAS_COMMAND_LIST_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_CUSTOM_PAINT_CANVAS_COMMAND_LIST_H
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <initializer_list>
+#include <vector>
+
+#include "base/utils/macros.h"
+
+namespace OHOS::Ace::NG {
+class CanvasPaintMethod;
+class PaintWrapper;
+using TaskFunc = std::function<void(CanvasPaintMethod&, PaintWrapper*)>;
+
+// Draw calls recorded without a closure, any other call is recorded as TASK.
+enum class CanvasCommand : uint8_t {
+    TASK = 0,
+    FILL_RECT,
+    STROKE_RECT,
+    CLEAR_RECT,
+    ADD_RECT,
+    BEGIN_PATH,
+    CLOSE_PATH,
+    MOVE_TO,
+    LINE_TO,
+    ARC,
+    BEZIER_CURVE_TO,
+    QUADRATIC_CURVE_TO,
+    FILL,
+    STROKE,
+    COUNT,
+};
+
+/**
+ * CanvasCommandList records the calls of CanvasRenderingContext2D between two paints. Commands are kept as opcodes
+ * with their arguments packed in one array, and a run of the same command is stored as one record with a repeat
+ * count. The storage is reused by the next frame after Clear.
+ */
+class ACE_EXPORT CanvasCommandList final {
+public:
+    CanvasCommandList() = default;
+    ~CanvasCommandList() = default;
+
+    void PushTask(const TaskFunc& task);
+    void Push(CanvasCommand command, std::initializer_list<double> args);
+    void Replay(CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) const;
+
+    bool Empty() const
+    {
+        return records_.empty();
+    }
+
+    size_t RecordCount() const
+    {
+        return records_.size();
+    }
+
+    void Clear()
+    {
+        records_.clear();
+        args_.clear();
+        tasks_.clear();
+    }
+
+    static size_t GetArgCount(CanvasCommand command);
+
+private:
+    struct Record {
+        CanvasCommand command = CanvasCommand::TASK;
+        uint32_t count = 0;
+    };
+
+    void AddRecord(CanvasCommand command);
+
+    std::vector<Record> records_;
+    std::vector<double> args_;
+    // a task may record more commands while being replayed, deque keeps it alive on push_back.
+    std::deque<TaskFunc> tasks_;
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_CUSTOM_PAINT_CANVAS_COMMAND_LIST_H
@@ -111,7 +111,7 @@ void CanvasPaintMethod::UpdateContentModifier(PaintWrapper* paintWrapper)
     }
 #endif
 
-    if (tasks_.empty()) {
+    if (tasks_.Empty()) {
         return;
     }
 
@@ -120,10 +120,8 @@ void CanvasPaintMethod::UpdateContentModifier(PaintWrapper* paintWrapper)
 #else
     rsCanvas_->Scale(viewScale, viewScale);
 #endif
-    for (const auto& task : tasks_) {
-        task(*this, paintWrapper);
-    }
-    tasks_.clear();
+    tasks_.Replay(*this, paintWrapper);
+    tasks_.Clear();
     CHECK_NULL_VOID(contentModifier_);
     contentModifier_->MarkModifierDirty();
 }
@@ -140,7 +138,7 @@ void CanvasPaintMethod::ImageObjReady(const RefPtr<Ace::ImageObject>& imageObj)
     TaskFunc func = [canvasImage](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
         paintMethod.DrawImage(paintWrapper, canvasImage, 0, 0);
     };
-    tasks_.emplace_back(func);
+    tasks_.PushTask(func);
 }
 
 void CanvasPaintMethod::ImageObjFailed()
@@ -581,13 +579,9 @@ std::unique_ptr<Ace::ImageData> CanvasPaintMethod::GetImageData(
     std::unique_ptr<Ace::ImageData> imageData = std::make_unique<Ace::ImageData>();
     imageData->dirtyWidth = dirtyWidth;
     imageData->dirtyHeight = dirtyHeight;
-    // a pixel include 4 data(blue, green, red, alpha)
-    for (int i = 0; i < size * 4; i += 4) {
-        auto blue = pixels[i];
-        auto green = pixels[i + 1];
-        auto red = pixels[i + 2];
-        auto alpha = pixels[i + 3];
-        imageData->data.emplace_back(Color::FromARGB(alpha, red, green, blue));
+    if (size > 0) {
+        imageData->pixels = std::make_shared<std::vector<uint32_t>>(size);
+        PackBgraBytes(pixels, imageData->pixels->data(), static_cast<size_t>(size));
     }
     return imageData;
 }
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_CUSTOM_PAINT_CANVAS_PAINT_METHOD_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_CUSTOM_PAINT_CANVAS_PAINT_METHOD_H
 
+#include "core/components_ng/pattern/custom_paint/canvas_command_list.h"
 #include "core/components_ng/pattern/custom_paint/custom_paint_paint_method.h"
 #include "core/components_ng/pattern/custom_paint/offscreen_canvas_pattern.h"
 
@@ -24,9 +25,7 @@
 #endif
 
 namespace OHOS::Ace::NG {
-class CanvasPaintMethod;
 class RosenRenderContext;
-using TaskFunc = std::function<void(CanvasPaintMethod&, PaintWrapper*)>;
 class CanvasPaintMethod : public CustomPaintPaintMethod {
     DECLARE_ACE_TYPE(CanvasPaintMethod, CustomPaintPaintMethod)
 public:
@@ -46,12 +45,17 @@ public:
 
     void PushTask(const TaskFunc& task)
     {
-        tasks_.emplace_back(task);
+        tasks_.PushTask(task);
+    }
+
+    void PushCommand(CanvasCommand command, std::initializer_list<double> args)
+    {
+        tasks_.Push(command, args);
     }
 
     bool HasTask() const
     {
-        return !tasks_.empty();
+        return !tasks_.Empty();
     }
 
     double GetWidth()
@@ -129,7 +133,7 @@ private:
     }
 #endif
 
-    std::list<TaskFunc> tasks_;
+    CanvasCommandList tasks_;
 
     RefPtr<Ace::ImageObject> imageObj_ = nullptr;
 
@@ -111,6 +111,14 @@ inline T ConvertStrToEnum(const char* key, const LinearMapNode<T>* map, size_t l
     int64_t index = BinarySearchFindIndex(map, length, key);
     return index != -1 ? map[index].value : defaultValue;
 }
+
+#ifndef USE_ROSEN_DRAWING
+// releases the reference to the ImageData pixels held by an image made from them.
+void ReleaseSharedPixels(const void* /* pixels */, void* context)
+{
+    delete static_cast<std::shared_ptr<std::vector<uint32_t>>*>(context);
+}
+#endif
 } // namespace
 
 void CustomPaintPaintMethod::UpdateRecordingCanvas(float width, float height)
@@ -755,32 +763,59 @@ void CustomPaintPaintMethod::DrawSvgImage(PaintWrapper* paintWrapper, const Ace:
 
 void CustomPaintPaintMethod::PutImageData(PaintWrapper* paintWrapper, const Ace::ImageData& imageData)
 {
-    if (imageData.data.empty()) {
-        return;
+    std::unique_ptr<uint32_t[]> colors;
+    const uint32_t* data = nullptr;
+    size_t count = 0;
+    if (imageData.pixels) {
+        // the shared pixels are BGRA already.
+        data = imageData.pixels->data();
+        count = imageData.pixels->size();
+    } else {
+        count = imageData.data.size();
+        if (count == 0) {
+            return;
+        }
+        colors.reset(new (std::nothrow) uint32_t[count]);
+        CHECK_NULL_VOID(colors);
+        for (size_t i = 0; i < count; ++i) {
+            colors[i] = imageData.data[i].GetValue();
+        }
+        data = colors.get();
     }
-    uint32_t* data = new (std::nothrow) uint32_t[imageData.data.size()];
-    CHECK_NULL_VOID(data);
-
-    for (uint32_t i = 0; i < imageData.data.size(); ++i) {
-        data[i] = imageData.data[i].GetValue();
+    if (count == 0 || imageData.dirtyWidth <= 0 || imageData.dirtyHeight <= 0 ||
+        count < static_cast<size_t>(imageData.dirtyWidth) * static_cast<size_t>(imageData.dirtyHeight)) {
+        return;
     }
 #ifndef USE_ROSEN_DRAWING
-    SkBitmap skBitmap;
     auto imageInfo = SkImageInfo::Make(imageData.dirtyWidth, imageData.dirtyHeight, SkColorType::kBGRA_8888_SkColorType,
         SkAlphaType::kOpaque_SkAlphaType);
-    skBitmap.allocPixels(imageInfo);
-    skBitmap.setPixels(data);
+    SkPixmap pixmap(imageInfo, data, imageInfo.minRowBytes());
+    // the recording canvas keeps the image after this call, so it must own its pixels. The shared pixels are kept
+    // alive by the release context, the local colors are copied.
+    sk_sp<SkImage> image;
+    if (imageData.pixels) {
+        auto* context = new std::shared_ptr<std::vector<uint32_t>>(imageData.pixels);
+        image = SkImage::MakeFromRaster(pixmap, &ReleaseSharedPixels, context);
+    } else {
+        image = SkImage::MakeRasterCopy(pixmap);
+    }
+    CHECK_NULL_VOID(image);
     auto contentOffset = GetContentOffset(paintWrapper);
 
     SkPaint paint;
     paint.setBlendMode(SkBlendMode::kSrc);
-    skCanvas_->drawImage(skBitmap.asImage(), imageData.x + contentOffset.GetX(), imageData.y + contentOffset.GetY(),
+    skCanvas_->drawImage(image, imageData.x + contentOffset.GetX(), imageData.y + contentOffset.GetY(),
         SkSamplingOptions(), &paint);
 #else
     RSBitmap bitmap;
     RSBitmapFormat format { RSColorType::COLORTYPE_BGRA_8888, RSAlphaType::ALPHATYPE_OPAQUE };
     bitmap.Build(imageData.dirtyWidth, imageData.dirtyHeight, format);
-    bitmap.SetPixels(data);
+    CHECK_NULL_VOID(bitmap.GetPixels());
+    auto byteSize = static_cast<size_t>(imageData.dirtyWidth) * static_cast<size_t>(imageData.dirtyHeight) *
+                    sizeof(uint32_t);
+    if (memcpy_s(bitmap.GetPixels(), byteSize, data, byteSize) != EOK) {
+        return;
+    }
     auto contentOffset = GetContentOffset(paintWrapper);
     RSBrush brush;
     brush.SetBlendMode(RSBlendMode::SRC);
@@ -788,7 +823,6 @@ void CustomPaintPaintMethod::PutImageData(PaintWrapper* paintWrapper, const Ace:
     rsCanvas_->DrawBitmap(bitmap, imageData.x + contentOffset.GetX(), imageData.y + contentOffset.GetY());
     rsCanvas_->DetachBrush();
 #endif
-    delete[] data;
 }
 
 void CustomPaintPaintMethod::FillRect(PaintWrapper* paintWrapper, const Rect& rect)
@@ -96,10 +96,7 @@ void CustomPaintPattern::SetAntiAlias(bool isEnabled)
 
 void CustomPaintPattern::FillRect(const Rect& rect)
 {
-    auto task = [rect](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.FillRect(paintWrapper, rect);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::FILL_RECT, { rect.Left(), rect.Top(), rect.Width(), rect.Height() });
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -107,10 +104,7 @@ void CustomPaintPattern::FillRect(const Rect& rect)
 
 void CustomPaintPattern::StrokeRect(const Rect& rect)
 {
-    auto task = [rect](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.StrokeRect(paintWrapper, rect);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::STROKE_RECT, { rect.Left(), rect.Top(), rect.Width(), rect.Height() });
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -118,10 +112,7 @@ void CustomPaintPattern::StrokeRect(const Rect& rect)
 
 void CustomPaintPattern::ClearRect(const Rect& rect)
 {
-    auto task = [rect](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.ClearRect(paintWrapper, rect);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::CLEAR_RECT, { rect.Left(), rect.Top(), rect.Width(), rect.Height() });
 
     auto host = GetHost();
     CHECK_NULL_VOID(host);
@@ -130,10 +121,7 @@ void CustomPaintPattern::ClearRect(const Rect& rect)
 
 void CustomPaintPattern::Fill()
 {
-    auto task = [](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.Fill(paintWrapper);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::FILL, {});
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -152,10 +140,7 @@ void CustomPaintPattern::Fill(const RefPtr<CanvasPath2D>& path)
 
 void CustomPaintPattern::Stroke()
 {
-    auto task = [](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.Stroke(paintWrapper);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::STROKE, {});
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -196,10 +181,7 @@ void CustomPaintPattern::Clip(const RefPtr<CanvasPath2D>& path)
 
 void CustomPaintPattern::BeginPath()
 {
-    auto task = [](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.BeginPath();
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::BEGIN_PATH, {});
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -207,10 +189,7 @@ void CustomPaintPattern::BeginPath()
 
 void CustomPaintPattern::ClosePath()
 {
-    auto task = [](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.ClosePath();
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::CLOSE_PATH, {});
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -218,10 +197,7 @@ void CustomPaintPattern::ClosePath()
 
 void CustomPaintPattern::MoveTo(double x, double y)
 {
-    auto task = [x, y](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.MoveTo(paintWrapper, x, y);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::MOVE_TO, { x, y });
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -229,10 +205,7 @@ void CustomPaintPattern::MoveTo(double x, double y)
 
 void CustomPaintPattern::LineTo(double x, double y)
 {
-    auto task = [x, y](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.LineTo(paintWrapper, x, y);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::LINE_TO, { x, y });
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -240,10 +213,8 @@ void CustomPaintPattern::LineTo(double x, double y)
 
 void CustomPaintPattern::Arc(const ArcParam& param)
 {
-    auto task = [param](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.Arc(paintWrapper, param);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::ARC, { param.x, param.y, param.radius, param.startAngle, param.endAngle,
+        param.anticlockwise ? 1.0 : 0.0 });
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -262,10 +233,7 @@ void CustomPaintPattern::ArcTo(const ArcToParam& param)
 
 void CustomPaintPattern::AddRect(const Rect& rect)
 {
-    auto task = [rect](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.AddRect(paintWrapper, rect);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::ADD_RECT, { rect.Left(), rect.Top(), rect.Width(), rect.Height() });
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -284,10 +252,8 @@ void CustomPaintPattern::Ellipse(const EllipseParam& param)
 
 void CustomPaintPattern::BezierCurveTo(const BezierCurveParam& param)
 {
-    auto task = [param](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.BezierCurveTo(paintWrapper, param);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(
+        CanvasCommand::BEZIER_CURVE_TO, { param.cp1x, param.cp1y, param.cp2x, param.cp2y, param.x, param.y });
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -295,10 +261,7 @@ void CustomPaintPattern::BezierCurveTo(const BezierCurveParam& param)
 
 void CustomPaintPattern::QuadraticCurveTo(const QuadraticCurveParam& param)
 {
-    auto task = [param](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
-        paintMethod.QuadraticCurveTo(paintWrapper, param);
-    };
-    paintMethod_->PushTask(task);
+    paintMethod_->PushCommand(CanvasCommand::QUADRATIC_CURVE_TO, { param.cpx, param.cpy, param.x, param.y });
     auto host = GetHost();
     CHECK_NULL_VOID(host);
     host->MarkDirtyNode(PROPERTY_UPDATE_RENDER);
@@ -422,13 +422,9 @@ std::unique_ptr<Ace::ImageData> OffscreenCanvasPaintMethod::GetImageData(
     std::unique_ptr<Ace::ImageData> imageData = std::make_unique<Ace::ImageData>();
     imageData->dirtyWidth = dirtyWidth;
     imageData->dirtyHeight = dirtyHeight;
-    // a pixel include 4 data blue, green, red, alpha
-    for (int i = 0; i < size * 4; i += 4) {
-        auto blue = pixels[i];
-        auto green = pixels[i + 1];
-        auto red = pixels[i + 2];
-        auto alpha = pixels[i + 3];
-        imageData->data.emplace_back(Color::FromARGB(alpha, red, green, blue));
+    if (size > 0) {
+        imageData->pixels = std::make_shared<std::vector<uint32_t>>(size);
+        PackBgraBytes(pixels, imageData->pixels->data(), static_cast<size_t>(size));
     }
     return imageData;
 }
@@ -56,7 +56,7 @@ void FolderStackLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper)
     if (!isIntoFolderStack_) {
         auto childLayoutProperty = AceType::DynamicCast<StackLayoutProperty>(layoutWrapper->GetLayoutProperty());
         if (childLayoutProperty->GetPositionProperty()) {
-            childLayoutProperty->GetPositionProperty()->UpdateAlignment(align);
+            childLayoutProperty->UpdateAlignment(align);
         }
         StackLayoutAlgorithm::Layout(layoutWrapper);
         return;
@@ -314,6 +314,27 @@ float GridPattern::GetMainGap() const
     return mainGap;
 }
 
+std::optional<PredictBuildParam> GridPattern::GetPredictBuildParam(float predictOffset)
+{
+    if (!isConfigScrollable_) {
+        return std::nullopt;
+    }
+    PredictRangeInfo rangeInfo;
+    rangeInfo.startIndex = gridLayoutInfo_.startIndex_;
+    rangeInfo.endIndex = gridLayoutInfo_.endIndex_;
+    rangeInfo.totalCount = gridLayoutInfo_.childrenCount_;
+    rangeInfo.lanes = gridLayoutInfo_.crossCount_;
+    rangeInfo.averageLineSize = gridLayoutInfo_.GetAverageLineHeight() + GetMainGap();
+    auto items = ScrollablePredictBuilder::ComputePredictItems(predictOffset, rangeInfo);
+    if (items.empty()) {
+        return std::nullopt;
+    }
+    // items of a regular grid share the constraint of their neighbours in the viewport
+    auto constraint = GetChildParentConstraint(Negative(predictOffset) ? rangeInfo.endIndex : rangeInfo.startIndex);
+    CHECK_NULL_RETURN(constraint, std::nullopt);
+    return PredictBuildParam { std::move(items), constraint.value() };
+}
+
 bool GridPattern::UpdateCurrentOffset(float offset, int32_t source)
 {
     if (!isConfigScrollable_ || !scrollable_) {
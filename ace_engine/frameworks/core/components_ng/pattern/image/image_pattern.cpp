@@ -33,6 +33,7 @@
 #include "core/components_ng/event/event_hub.h"
 #include "core/components_ng/pattern/image/image_layout_property.h"
 #include "core/components_ng/pattern/image/image_paint_method.h"
+#include "core/components_ng/pattern/stage/page_pattern.h"
 #include "core/components_ng/property/measure_property.h"
 #include "core/pipeline_ng/pipeline_context.h"
 #include "frameworks/bridge/common/utils/engine_helper.h"
@@ -45,6 +46,10 @@
 #endif
 
 namespace OHOS::Ace::NG {
+namespace {
+constexpr size_t IMAGE_BYTES_PER_PIXEL = 4;
+} // namespace
+
 napi_value ConvertPixmapNapi(const RefPtr<PixelMap>& pixelMap)
 {
 #if defined(PIXEL_MAP_SUPPORTED) && !defined(ANDROID_PLATFORM) && !defined(IOS_PLATFORM)
@@ -205,6 +210,7 @@ void ImagePattern::OnImageLoadSuccess()
 
     SetImagePaintConfig(image_, srcRect_, dstRect_, loadingCtx_->GetSourceInfo().IsSvg());
     PrepareAnimation(image_);
+    ReportRetainedMemory();
     if (host->IsDraggable()) {
         EnableDrag();
     }
@@ -512,9 +518,9 @@ void ImagePattern::UpdateInternalResource(ImageSourceInfo& sourceInfo)
 void ImagePattern::OnNotifyMemoryLevel(int32_t level)
 {
     // TODO: do different data cleaning operation according to level
-    // when image component is [onShow], do not clean image data
+    // when image component is [onShow] on the page shown, do not clean image data
     // TODO: use [isActive_] to determine image data management
-    if (isShow_) {
+    if (isShow_ && IsOnShowPage()) {
         return;
     }
 
@@ -523,6 +529,7 @@ void ImagePattern::OnNotifyMemoryLevel(int32_t level)
     image_ = nullptr;
     altLoadingCtx_ = nullptr;
     altImage_ = nullptr;
+    ReportRetainedMemory();
 
     // clean rs node to release the sk_sp<SkImage> held by it
     // TODO: release PixelMap resource when use PixelMap resource to draw image
@@ -543,6 +550,7 @@ void ImagePattern::OnRecycle()
     image_ = nullptr;
     altLoadingCtx_ = nullptr;
     altImage_ = nullptr;
+    ReportRetainedMemory();
 
     auto frameNode = GetHost();
     CHECK_NULL_VOID(frameNode);
@@ -571,6 +579,9 @@ void ImagePattern::OnVisibleChange(bool visible)
 {
     if (!visible) {
         CloseSelectOverlay();
+    } else if (isShow_ && !loadingCtx_) {
+        // image data may be released by memory trimming while the page was in background.
+        LoadImageDataIfNeed();
     }
     // control svg / gif animation
     if (image_) {
@@ -588,11 +599,10 @@ void ImagePattern::OnAttachToFrameNode()
     renderCtx->SetClipToBounds(false);
     renderCtx->SetUsingContentRectForRenderFrame(true);
 
-    // register image frame node to pipeline context to receive memory level notification and window state change
-    // notification
+    // register image frame node to pipeline context to receive window state change notification, memory level
+    // notification is sent by MemoryManager once decoded data is reported.
     auto pipeline = PipelineContext::GetCurrentContext();
     CHECK_NULL_VOID(pipeline);
-    pipeline->AddNodesToNotifyMemoryLevel(host->GetId());
     pipeline->AddWindowStateChangedCallback(host->GetId());
 }
 
@@ -604,7 +614,33 @@ void ImagePattern::OnDetachFromFrameNode(FrameNode* frameNode)
     auto pipeline = AceType::DynamicCast<PipelineContext>(PipelineBase::GetCurrentContext());
     CHECK_NULL_VOID(pipeline);
     pipeline->RemoveWindowStateChangedCallback(id);
-    pipeline->RemoveNodesToNotifyMemoryLevel(id);
+    pipeline->GetMemoryManager()->RemoveUsage(id);
+}
+
+bool ImagePattern::IsOnShowPage()
+{
+    auto host = GetHost();
+    CHECK_NULL_RETURN(host, true);
+    auto pageNode = host->GetPageNode();
+    CHECK_NULL_RETURN(pageNode, true);
+    auto pagePattern = pageNode->GetPattern<PagePattern>();
+    CHECK_NULL_RETURN(pagePattern, true);
+    return pagePattern->IsOnShow();
+}
+
+void ImagePattern::ReportRetainedMemory()
+{
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    auto pipeline = host->GetContext();
+    CHECK_NULL_VOID(pipeline);
+    size_t bytes = 0;
+    if (image_ && loadingCtx_) {
+        // decoded pixels are resized to the destination size when it is known.
+        auto size = loadingCtx_->GetDstSize().IsPositive() ? loadingCtx_->GetDstSize() : loadingCtx_->GetImageSize();
+        bytes = static_cast<size_t>(size.Width() * size.Height()) * IMAGE_BYTES_PER_PIXEL;
+    }
+    pipeline->GetMemoryManager()->UpdateUsage(host, MemoryCategory::IMAGE, bytes);
 }
 
 void ImagePattern::EnableDrag()
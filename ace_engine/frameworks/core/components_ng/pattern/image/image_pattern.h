@@ -168,6 +168,9 @@ private:
     void OnImageDataReady();
     void OnImageLoadFail(const std::string& errorMsg);
     void OnImageLoadSuccess();
+    // reports the decoded data held by this image to the memory ledger of the pipeline.
+    void ReportRetainedMemory();
+    bool IsOnShowPage();
     void SetImagePaintConfig(
         const RefPtr<CanvasImage>& canvasImage, const RectF& srcRect, const RectF& dstRect, bool isSvg);
     void UpdateInternalResource(ImageSourceInfo& sourceInfo);
@@ -33,6 +33,8 @@ namespace {
 constexpr int32_t DEFAULT_DURATION = 1000; // ms
 constexpr uint32_t CRITICAL_TIME = 50;      // ms. If show time of image is less than this, use more cacheImages.
 constexpr int64_t MICROSEC_TO_MILLISEC = 1000;
+constexpr double MAX_CACHE_IMAGE_BYTES = 64.0 * 1024 * 1024; // memory of the decoded images kept ahead.
+constexpr double BYTES_PER_PIXEL = 4.0;
 constexpr int32_t DEFAULT_ITERATIONS = 1;
 
 } // namespace
@@ -100,7 +102,7 @@ void ImageAnimatorPattern::SetShowingIndex(int32_t index)
         cacheImages_.emplace_back(newCacheImageStruct);
         UpdateShowingImageInfo(cacheImageNode, index);
     } else {
-        // wait for cache image loading
+        // decoding falls behind, drop the frame and keep the showing one until the cache image is loaded.
         ACE_SCOPED_TRACE("ImageAnimator waitForCache src %s, index %d", images_[index].src.c_str(), index);
         return;
     }
@@ -184,12 +186,28 @@ std::list<ImageAnimatorPattern::CacheImageStruct>::iterator ImageAnimatorPattern
     return cacheImages_.end();
 }
 
-void ImageAnimatorPattern::GenerateCachedImages()
+size_t ImageAnimatorPattern::GetCacheImageNum()
 {
-    CHECK_NULL_VOID(images_.size());
     auto averageShowTime = animator_->GetDuration() / images_.size();
     size_t cacheImageNum = averageShowTime >= CRITICAL_TIME ? 1 : 2;
-    cacheImageNum = std::min(images_.size() - 1, cacheImageNum);
+    // the cache images decode the next frames in a ring, when it covers all the other frames a loop decodes nothing.
+    cacheImageNum = std::max(cacheImageNum, static_cast<size_t>(preDecode_));
+    auto host = GetHost();
+    if (host) {
+        auto hostSize = host->GetGeometryNode()->GetPaddingSize();
+        if (hostSize.IsPositive()) {
+            auto imageBytes = hostSize.Width() * hostSize.Height() * BYTES_PER_PIXEL;
+            auto maxCacheImageNum = std::max(static_cast<size_t>(MAX_CACHE_IMAGE_BYTES / imageBytes), size_t(1));
+            cacheImageNum = std::min(cacheImageNum, maxCacheImageNum);
+        }
+    }
+    return std::min(images_.size() - 1, cacheImageNum);
+}
+
+void ImageAnimatorPattern::GenerateCachedImages()
+{
+    CHECK_NULL_VOID(images_.size());
+    auto cacheImageNum = GetCacheImageNum();
     if (cacheImages_.size() > cacheImageNum) {
         cacheImages_.resize(cacheImageNum);
         return;
@@ -209,6 +227,8 @@ bool ImageAnimatorPattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>&
     if (!isLayouted_) {
         isLayouted_ = true;
         if (fixedSize_ && images_.size()) {
+            // the size of the decoded images is known now.
+            GenerateCachedImages();
             int32_t nextIndex = GetNextIndex(nowImageIndex_);
             for (auto& cacheImage : cacheImages_) {
                 UpdateCacheImageInfo(cacheImage, nextIndex);
@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_IMAGE_ANIMATOR_IMAGE_ANIMATOR_PATTERN_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_IMAGE_ANIMATOR_IMAGE_ANIMATOR_PATTERN_H
 
+#include <algorithm>
+
 #include "core/animation/animator.h"
 #include "core/animation/picture_animation.h"
 #include "core/components/declaration/image/image_animator_declaration.h"
@@ -82,7 +84,10 @@ public:
         animator_->SetFillMode(fillMode);
     }
 
-    void SetPreDecode(int32_t preDecode) {}
+    void SetPreDecode(int32_t preDecode)
+    {
+        preDecode_ = std::max(preDecode, 0);
+    }
 
     void SetIsReverse(bool isReverse)
     {
@@ -121,6 +126,7 @@ private:
     void UpdateCacheImageInfo(CacheImageStruct& cacheImage, int32_t index);
     std::list<CacheImageStruct>::iterator FindCacheImageNode(const std::string& src);
     int32_t GetNextIndex(int32_t preIndex);
+    size_t GetCacheImageNum();
     void GenerateCachedImages();
     void AddImageLoadSuccessEvent(const RefPtr<FrameNode>& imageFrameNode);
     static bool IsShowingSrc(const RefPtr<FrameNode>& imageFrameNode, const std::string& src);
@@ -136,6 +142,7 @@ private:
     Animator::Status status_ = Animator::Status::IDLE;
     int32_t durationTotal_ = 0;
     int32_t nowImageIndex_ = 0;
+    int32_t preDecode_ = 0;
     uint64_t repeatCallbackId_ = 0;
     bool isReverse_ = false;
     bool fixedSize_ = true;
@@ -207,6 +207,15 @@ void ListModelNG::SetFriction(double friction)
     pattern->SetFriction(friction);
 }
 
+void ListModelNG::SetTouchPredictionEnabled(bool isTouchPredictionEnabled)
+{
+    auto frameNode = ViewStackProcessor::GetInstance()->GetMainFrameNode();
+    CHECK_NULL_VOID(frameNode);
+    auto pattern = frameNode->GetPattern<ListPattern>();
+    CHECK_NULL_VOID(pattern);
+    pattern->SetTouchPredictionEnabled(isTouchPredictionEnabled);
+}
+
 void ListModelNG::SetOnScroll(OnScrollEvent&& onScroll)
 {
     auto frameNode = ViewStackProcessor::GetInstance()->GetMainFrameNode();
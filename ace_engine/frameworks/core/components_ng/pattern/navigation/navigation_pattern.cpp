@@ -22,6 +22,7 @@
 #include "base/perfmonitor/perf_constants.h"
 #include "base/memory/referenced.h"
 #include "base/mousestyle/mouse_style.h"
+#include "base/utils/time_util.h"
 #include "base/utils/utils.h"
 #include "core/common/container.h"
 #include "core/common/recorder/event_recorder.h"
@@ -802,6 +803,36 @@ RefPtr<UINode> NavigationPattern::GenerateUINodeByIndex(int32_t index)
     return navigationStack_->CreateNodeByIndex(index);
 }
 
+void NavigationPattern::PrebuildNavDestination(const RefPtr<RouteInfo>& routeInfo)
+{
+    CHECK_NULL_VOID(routeInfo);
+    CHECK_NULL_VOID(navigationStack_);
+    if (navigationStack_->HasPrebuiltNode(routeInfo) || navigationStack_->GetFromCacheNode(routeInfo->GetName())) {
+        return;
+    }
+    auto pipeline = PipelineContext::GetCurrentContext();
+    CHECK_NULL_VOID(pipeline);
+    pipeline->AddPredictTask([weak = WeakClaim(this), weakRouteInfo = WeakPtr<RouteInfo>(routeInfo)](
+                                 int64_t deadline, bool /* canUseLongPredictTask */) {
+        auto pattern = weak.Upgrade();
+        CHECK_NULL_VOID(pattern);
+        auto routeInfo = weakRouteInfo.Upgrade();
+        CHECK_NULL_VOID(routeInfo);
+        auto navigationStack = pattern->GetNavigationStack();
+        CHECK_NULL_VOID(navigationStack);
+        if (navigationStack->HasPrebuiltNode(routeInfo)) {
+            return;
+        }
+        if (GetSysTimestamp() > deadline) {
+            // no time left in this idle period, try in the next one.
+            pattern->PrebuildNavDestination(routeInfo);
+            return;
+        }
+        ACE_SCOPED_TRACE("NavDestination prebuild %s", routeInfo->GetName().c_str());
+        navigationStack->AddPrebuiltNode(routeInfo, navigationStack->CreateNodeByRouteInfo(routeInfo));
+    });
+}
+
 void NavigationPattern::InitDividerMouseEvent(const RefPtr<InputEventHub>& inputHub)
 {
     CHECK_NULL_VOID(inputHub);
@@ -119,6 +119,11 @@ public:
         navigationStack_->Add(name, navDestinationNode, mode, routeInfo);
     }
 
+    /*
+     * Build the NavDestination of routeInfo off the tree in idle time, so a later push of the route only attaches it.
+     */
+    void PrebuildNavDestination(const RefPtr<RouteInfo>& routeInfo);
+
     RefPtr<UINode> GetNavDestinationNode(const std::string& name)
     {
         return navigationStack_->Get(name);
@@ -15,6 +15,7 @@
 
 #include "core/components_ng/pattern/navigation/navigation_stack.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "core/components_ng/pattern/navrouter/navdestination_group_node.h"
@@ -24,6 +25,8 @@
 namespace OHOS::Ace::NG {
 namespace {
 constexpr int32_t NOT_EXIST = -1;
+// a press or hover hints one route, keep the last two in case the user moves to a neighbour.
+constexpr size_t MAX_PREBUILT_NODES = 2;
 }
 void NavigationStack::Remove()
 {
@@ -385,4 +388,33 @@ std::optional<std::pair<std::string, RefPtr<UINode>>> NavigationStack::GetFromCa
     }
     return std::nullopt;
 }
+
+void NavigationStack::AddPrebuiltNode(const RefPtr<RouteInfo>& routeInfo, const RefPtr<UINode>& navDestinationNode)
+{
+    if (routeInfo == nullptr || navDestinationNode == nullptr || HasPrebuiltNode(routeInfo)) {
+        return;
+    }
+    if (prebuiltNodes_.size() >= MAX_PREBUILT_NODES) {
+        prebuiltNodes_.pop_front();
+    }
+    prebuiltNodes_.emplace_back(routeInfo, navDestinationNode);
+}
+
+bool NavigationStack::HasPrebuiltNode(const RefPtr<RouteInfo>& routeInfo) const
+{
+    return std::any_of(prebuiltNodes_.begin(), prebuiltNodes_.end(),
+        [&routeInfo](const auto& prebuiltNode) { return prebuiltNode.first == routeInfo; });
+}
+
+RefPtr<UINode> NavigationStack::TakePrebuiltNode(const RefPtr<RouteInfo>& routeInfo)
+{
+    for (auto it = prebuiltNodes_.begin(); it != prebuiltNodes_.end(); ++it) {
+        if ((*it).first == routeInfo) {
+            auto navDestinationNode = (*it).second;
+            prebuiltNodes_.erase(it);
+            return navDestinationNode;
+        }
+    }
+    return nullptr;
+}
 } // namespace OHOS::Ace::NG
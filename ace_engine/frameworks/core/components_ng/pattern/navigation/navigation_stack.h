@@ -17,6 +17,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_NAVIGATION_NAVIGATION_STACK_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_NAVIGATION_NAVIGATION_STACK_H
 
+#include <list>
 #include <optional>
 
 #include "base/memory/referenced.h"
@@ -98,6 +99,13 @@ public:
     void RemoveCacheNode(int32_t handle);
     void ReOrderCache(const std::string& name, const RefPtr<UINode>& navDestinationNode);
 
+    /*
+     * NavDestinations built ahead of a likely push, each one is taken by the next push of the route it was built for.
+     */
+    void AddPrebuiltNode(const RefPtr<RouteInfo>& routeInfo, const RefPtr<UINode>& navDestinationNode);
+    bool HasPrebuiltNode(const RefPtr<RouteInfo>& routeInfo) const;
+    RefPtr<UINode> TakePrebuiltNode(const RefPtr<RouteInfo>& routeInfo);
+
     void Remove();
     void Remove(const std::string& name);
     void Remove(const std::string& name, const RefPtr<UINode>& navDestinationNode);
@@ -150,6 +158,7 @@ private:
     // prev backup NavPathList
     NavPathList preNavPathList_;
     NavPathList cacheNodes_;
+    std::list<std::pair<RefPtr<RouteInfo>, RefPtr<UINode>>> prebuiltNodes_;
 };
 } // namespace OHOS::Ace::NG
 #endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_NAVIGATION_NAVIGATION_STACK_H
@@ -57,9 +57,23 @@ public:
         }
     }
 
+    void SetOnPrebuildDestination(OnDestinationChangeEvent&& onPrebuildDestinationEvent)
+    {
+        onPrebuildDestinationEvent_ = onPrebuildDestinationEvent;
+    }
+
+    // fired when a push of the destination is likely, e.g. the NavRouter is pressed or hovered.
+    void FirePrebuildDestinationEvent() const
+    {
+        if (onPrebuildDestinationEvent_) {
+            onPrebuildDestinationEvent_();
+        }
+    }
+
 private:
     OnStateChangeEvent onStateChangeEvent_;
     OnDestinationChangeEvent onDestinationChangeEvent_;
+    OnDestinationChangeEvent onPrebuildDestinationEvent_;
 };
 
 } // namespace OHOS::Ace::NG
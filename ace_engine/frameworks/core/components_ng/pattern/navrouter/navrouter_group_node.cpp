@@ -121,9 +121,24 @@ void NavRouterGroupNode::SetDestinationChangeEvent(const RefPtr<UINode>& parent)
         CHECK_NULL_VOID(navigationPattern);
         navRouter->AddNavDestinationToNavigation(navigation);
     };
+    auto onPrebuildDestination = [weak = WeakClaim(this),
+                                     weakNavigation = WeakPtr<NavigationGroupNode>(navigationNode)]() {
+        auto navRouter = weak.Upgrade();
+        CHECK_NULL_VOID(navRouter);
+        // the navDestination declared under NavRouter is built with it already.
+        CHECK_NULL_VOID(!navRouter->GetNavDestinationNode());
+        auto navRouterPattern = navRouter->GetPattern<NavRouterPattern>();
+        CHECK_NULL_VOID(navRouterPattern);
+        auto navigation = weakNavigation.Upgrade();
+        CHECK_NULL_VOID(navigation);
+        auto navigationPattern = navigation->GetPattern<NavigationPattern>();
+        CHECK_NULL_VOID(navigationPattern);
+        navigationPattern->PrebuildNavDestination(navRouterPattern->GetRouteInfo());
+    };
     auto eventHub = GetEventHub<NavRouterEventHub>();
     CHECK_NULL_VOID(eventHub);
     eventHub->SetOnDestinationChange(std::move(onDestinationChange));
+    eventHub->SetOnPrebuildDestination(std::move(onPrebuildDestination));
 }
 
 void NavRouterGroupNode::AddNavDestinationToNavigation(const RefPtr<UINode>& parent)
@@ -164,6 +179,9 @@ void NavRouterGroupNode::AddNavDestinationToNavigation(const RefPtr<UINode>& par
         // create navDestination with routeInfo
         name = routeInfo->GetName();
         RefPtr<UINode> uiNode = navigationStack->GetFromCacheNode(name);
+        if (uiNode == nullptr) {
+            uiNode = navigationStack->TakePrebuiltNode(routeInfo);
+        }
         if (uiNode == nullptr) {
             uiNode = navigationStack->CreateNodeByRouteInfo(routeInfo);
         }
@@ -36,6 +36,38 @@ void NavRouterPattern::OnModifyDone()
     };
     clickListener_ = MakeRefPtr<ClickEvent>(std::move(clickCallback));
     gesture->AddClickEvent(clickListener_);
+    InitPrebuildEvent(host, gesture);
+}
+
+void NavRouterPattern::InitPrebuildEvent(const RefPtr<FrameNode>& host, const RefPtr<GestureEventHub>& gesture)
+{
+    auto touchCallback = [weak = WeakClaim(this)](TouchEventInfo& info) {
+        if (info.GetTouches().empty() || info.GetTouches().front().GetTouchType() != TouchType::DOWN) {
+            return;
+        }
+        auto pattern = weak.Upgrade();
+        CHECK_NULL_VOID(pattern);
+        auto eventHub = pattern->GetEventHub<NavRouterEventHub>();
+        CHECK_NULL_VOID(eventHub);
+        eventHub->FirePrebuildDestinationEvent();
+    };
+    touchListener_ = MakeRefPtr<TouchEventImpl>(std::move(touchCallback));
+    gesture->AddTouchEvent(touchListener_);
+
+    auto inputHub = host->GetOrCreateInputEventHub();
+    CHECK_NULL_VOID(inputHub);
+    auto hoverCallback = [weak = WeakClaim(this)](bool isHovered) {
+        if (!isHovered) {
+            return;
+        }
+        auto pattern = weak.Upgrade();
+        CHECK_NULL_VOID(pattern);
+        auto eventHub = pattern->GetEventHub<NavRouterEventHub>();
+        CHECK_NULL_VOID(eventHub);
+        eventHub->FirePrebuildDestinationEvent();
+    };
+    hoverListener_ = MakeRefPtr<InputEvent>(std::move(hoverCallback));
+    inputHub->AddOnHoverEvent(hoverListener_);
 }
 
 } // namespace OHOS::Ace::NG
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_NAVROUTER_NAVROUTER_PATTERN_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_NAVROUTER_NAVROUTER_PATTERN_H
 
+#include "core/components_ng/event/input_event.h"
 #include "core/components_ng/pattern/navigation/navigation_declaration.h"
 #include "core/components_ng/pattern/navigation/navigation_stack.h"
 #include "core/components_ng/pattern/navrouter/navrouter_event_hub.h"
@@ -72,7 +73,11 @@ public:
     }
 
 private:
+    void InitPrebuildEvent(const RefPtr<FrameNode>& host, const RefPtr<GestureEventHub>& gesture);
+
     RefPtr<ClickEvent> clickListener_;
+    RefPtr<TouchEventImpl> touchListener_;
+    RefPtr<InputEvent> hoverListener_;
     std::string name_;
     RefPtr<RouteInfo> routeInfo_;
     NavRouteMode mode_ = NavRouteMode::PUSH_WITH_RECREATE;
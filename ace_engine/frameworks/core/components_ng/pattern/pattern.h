@@ -405,6 +405,7 @@ public:
     virtual void OnReuse() {}
 
     virtual void OnAttachToMainTree() {}
+    virtual void OnDetachFromMainTree() {}
 
     virtual void FromJson(const std::unique_ptr<JsonValue>& json) {}
 
@@ -15,6 +15,9 @@
 
 #include "core/components_ng/pattern/relative_container/relative_container_layout_algorithm.h"
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "base/geometry/ng/offset_t.h"
 #include "base/geometry/ng/size_t.h"
 #include "base/log/ace_trace.h"
@@ -38,34 +41,73 @@ inline bool IsAnchorContainer(const std::string& anchor)
 {
     return anchor == "__container__";
 }
+
+inline bool IsAnchorContainer(int32_t anchor)
+{
+    return anchor == RelativeContainerLayoutPlan::CONTAINER_ANCHOR;
+}
+
+inline bool IsHorizontalDirection(AlignDirection alignDirection)
+{
+    return static_cast<uint32_t>(alignDirection) < HORIZONTAL_DIRECTION_RANGE;
+}
+
+const CowPtr<FlexItemProperty>& GetFlexItemProperty(const RefPtr<LayoutWrapper>& childWrapper)
+{
+    static const CowPtr<FlexItemProperty> emptyFlexItem;
+    auto layoutProperty = childWrapper->GetLayoutProperty();
+    return layoutProperty ? layoutProperty->GetFlexItemProperty() : emptyFlexItem;
+}
 } // namespace
 
-void RelativeContainerLayoutAlgorithm::UpdateVerticalTwoAlignValues(
-    TwoAlignedValues& twoAlignedValues, AlignRule alignRule)
+SizeF RelativeContainerLayoutAlgorithm::GetAnchorSize(const AnchoredRule& anchoredRule) const
 {
-    if (twoAlignedValues.first.has_value() && twoAlignedValues.second.has_value()) {
-        return;
+    return children_[anchoredRule.anchor]->GetGeometryNode()->GetMarginFrameSize();
+}
+
+std::optional<float> RelativeContainerLayoutAlgorithm::CalcHorizontalAlignValue(const AnchoredRule& anchoredRule)
+{
+    auto isContainer = IsAnchorContainer(anchoredRule.anchor);
+    switch (anchoredRule.rule.horizontal) {
+        case HorizontalAlign::START:
+            return isContainer ? 0.0f : childOffsets_[anchoredRule.anchor].GetX();
+        case HorizontalAlign::CENTER:
+            return isContainer ? containerSizeWithoutPaddingBorder_.Width() / 2.0f
+                               : GetAnchorSize(anchoredRule).Width() / 2.0f +
+                                     childOffsets_[anchoredRule.anchor].GetX();
+        case HorizontalAlign::END:
+            return isContainer ? containerSizeWithoutPaddingBorder_.Width()
+                               : GetAnchorSize(anchoredRule).Width() + childOffsets_[anchoredRule.anchor].GetX();
+        default:
+            return std::nullopt;
     }
-    auto result = 0.0f;
-    switch (alignRule.vertical) {
+}
+
+std::optional<float> RelativeContainerLayoutAlgorithm::CalcVerticalAlignValue(const AnchoredRule& anchoredRule)
+{
+    auto isContainer = IsAnchorContainer(anchoredRule.anchor);
+    switch (anchoredRule.rule.vertical) {
         case VerticalAlign::TOP:
-            result = IsAnchorContainer(alignRule.anchor) ? 0.0f : recordOffsetMap_[alignRule.anchor].GetY();
-            break;
+            return isContainer ? 0.0f : childOffsets_[anchoredRule.anchor].GetY();
         case VerticalAlign::CENTER:
-            result = IsAnchorContainer(alignRule.anchor)
-                         ? containerSizeWithoutPaddingBorder_.Height() / 2.0f
-                         : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Height() / 2.0f +
-                               recordOffsetMap_[alignRule.anchor].GetY();
-            break;
+            return isContainer ? containerSizeWithoutPaddingBorder_.Height() / 2.0f
+                               : GetAnchorSize(anchoredRule).Height() / 2.0f +
+                                     childOffsets_[anchoredRule.anchor].GetY();
         case VerticalAlign::BOTTOM:
-            result = IsAnchorContainer(alignRule.anchor)
-                         ? containerSizeWithoutPaddingBorder_.Height()
-                         : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Height() +
-                               recordOffsetMap_[alignRule.anchor].GetY();
-            break;
+            return isContainer ? containerSizeWithoutPaddingBorder_.Height()
+                               : GetAnchorSize(anchoredRule).Height() + childOffsets_[anchoredRule.anchor].GetY();
         default:
-            break;
+            return std::nullopt;
     }
+}
+
+void RelativeContainerLayoutAlgorithm::UpdateVerticalTwoAlignValues(
+    TwoAlignedValues& twoAlignedValues, const AnchoredRule& anchoredRule)
+{
+    if (twoAlignedValues.first.has_value() && twoAlignedValues.second.has_value()) {
+        return;
+    }
+    auto result = CalcVerticalAlignValue(anchoredRule).value_or(0.0f);
     if (!twoAlignedValues.first.has_value()) {
         twoAlignedValues.first = result;
         return;
@@ -76,31 +118,12 @@ void RelativeContainerLayoutAlgorithm::UpdateVerticalTwoAlignValues(
 }
 
 void RelativeContainerLayoutAlgorithm::UpdateHorizontalTwoAlignValues(
-    TwoAlignedValues& twoAlignedValues, AlignRule alignRule)
+    TwoAlignedValues& twoAlignedValues, const AnchoredRule& anchoredRule)
 {
     if (twoAlignedValues.first.has_value() && twoAlignedValues.second.has_value()) {
         return;
     }
-    auto result = 0.0f;
-    switch (alignRule.horizontal) {
-        case HorizontalAlign::START:
-            result = IsAnchorContainer(alignRule.anchor) ? 0.0f : recordOffsetMap_[alignRule.anchor].GetX();
-            break;
-        case HorizontalAlign::CENTER:
-            result = IsAnchorContainer(alignRule.anchor)
-                         ? containerSizeWithoutPaddingBorder_.Width() / 2.0f
-                         : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Width() / 2.0f +
-                               recordOffsetMap_[alignRule.anchor].GetX();
-            break;
-        case HorizontalAlign::END:
-            result = IsAnchorContainer(alignRule.anchor)
-                         ? containerSizeWithoutPaddingBorder_.Width()
-                         : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Width() +
-                               recordOffsetMap_[alignRule.anchor].GetX();
-            break;
-        default:
-            break;
-    }
+    auto result = CalcHorizontalAlignValue(anchoredRule).value_or(0.0f);
     if (!twoAlignedValues.first.has_value()) {
         twoAlignedValues.first = result;
         return;
@@ -114,10 +137,6 @@ void RelativeContainerLayoutAlgorithm::DetermineTopologicalOrder(LayoutWrapper*
 {
     auto relativeContainerLayoutProperty = layoutWrapper->GetLayoutProperty();
     CHECK_NULL_VOID(relativeContainerLayoutProperty);
-    idNodeMap_.clear();
-    reliedOnMap_.clear();
-    recordOffsetMap_.clear();
-    incomingDegreeMap_.clear();
     auto layoutConstraint = relativeContainerLayoutProperty->GetLayoutConstraint();
     auto idealSize = CreateIdealSize(layoutConstraint.value(), Axis::HORIZONTAL, MeasureType::MATCH_PARENT);
     containerSizeWithoutPaddingBorder_ = idealSize.ConvertToSizeT();
@@ -128,11 +147,15 @@ void RelativeContainerLayoutAlgorithm::DetermineTopologicalOrder(LayoutWrapper*
         MinusPaddingToSize(padding_, containerSizeWithoutPaddingBorder_);
     }
     CollectNodesById(layoutWrapper);
-    GetDependencyRelationship();
-    if (!PreTopologicalLoopDetection()) {
-        const auto& childrenWrappers = layoutWrapper->GetAllChildrenWithBuild();
+    if (!IsPlanValid()) {
+        ACE_SCOPED_TRACE("RelativeContainer compile plan, children:%zu", children_.size());
+        CompilePlan();
+    }
+    isHorizontalRelyOnContainer_ = plan_->horizontalRelyOnContainer;
+    isVerticalRelyOnContainer_ = plan_->verticalRelyOnContainer;
+    if (plan_->hasLoop) {
         auto constraint = relativeContainerLayoutProperty->CreateChildConstraint();
-        for (const auto& childrenWrapper : childrenWrappers) {
+        for (const auto& childrenWrapper : children_) {
             childrenWrapper->SetActive(false);
             constraint.selfIdealSize = OptionalSizeF(0.0f, 0.0f);
             childrenWrapper->Measure(constraint);
@@ -140,7 +163,16 @@ void RelativeContainerLayoutAlgorithm::DetermineTopologicalOrder(LayoutWrapper*
         }
         return;
     }
-    TopologicalSort(renderList_);
+    // a child anchored to a gone child is not laid out.
+    for (const auto& step : plan_->steps) {
+        for (auto anchor : step.anchors) {
+            auto anchorLayoutProperty = children_[anchor]->GetLayoutProperty();
+            if (anchorLayoutProperty && anchorLayoutProperty->GetVisibility() == VisibleType::GONE) {
+                children_[step.index]->SetActive(false);
+                break;
+            }
+        }
+    }
 }
 
 void RelativeContainerLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
@@ -152,46 +184,8 @@ void RelativeContainerLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
     auto relativeContainerLayoutProperty = layoutWrapper->GetLayoutProperty();
     CHECK_NULL_VOID(relativeContainerLayoutProperty);
     DetermineTopologicalOrder(layoutWrapper);
-    if (SystemProperties::GetDebugEnabled()) {
-        std::string result = "[";
-        for (const auto& nodeName : renderList_) {
-            result += nodeName + ",";
-        }
-        if (!renderList_.empty()) {
-            result = result.substr(0, result.length() - 1);
-        }
-        result += "]";
-    }
-    for (const auto& nodeName : renderList_) {
-        if (idNodeMap_.find(nodeName) == idNodeMap_.end()) {
-            continue;
-        }
-        auto childWrapper = idNodeMap_[nodeName];
-        auto childConstraint = relativeContainerLayoutProperty->CreateChildConstraint();
-        if (!childWrapper->IsActive()) {
-            childWrapper->Measure(childConstraint);
-            continue;
-        }
-        if (!childWrapper->GetLayoutProperty() || !childWrapper->GetLayoutProperty()->GetFlexItemProperty()) {
-            childWrapper->Measure(childConstraint);
-            recordOffsetMap_[nodeName] = OffsetF(0.0f, 0.0f);
-            continue;
-        }
-        const auto& flexItem = childWrapper->GetLayoutProperty()->GetFlexItemProperty();
-        if (!flexItem->HasAlignRules()) {
-            childWrapper->Measure(childConstraint);
-            recordOffsetMap_[nodeName] = OffsetF(0.0f, 0.0f);
-            continue;
-        }
-        flexItem->ClearAlignValue();
-        auto alignRules = flexItem->GetAlignRulesValue();
-        auto frameNode = childWrapper->GetHostNode();
-        if (!alignRules.empty() && frameNode && frameNode->GetLayoutProperty()) {
-            // when child has alignRules and position, the position property do not work.
-            frameNode->GetLayoutProperty()->SetUsingPosition(false);
-        }
-        CalcSizeParam(layoutWrapper, nodeName);
-        CalcOffsetParam(layoutWrapper, nodeName);
+    for (const auto& step : plan_->steps) {
+        MeasureChild(layoutWrapper, step);
     }
 
     auto& calcLayoutConstraint = relativeContainerLayoutProperty->GetCalcLayoutConstraint();
@@ -203,6 +197,28 @@ void RelativeContainerLayoutAlgorithm::Measure(LayoutWrapper* layoutWrapper)
     }
 }
 
+void RelativeContainerLayoutAlgorithm::MeasureChild(LayoutWrapper* layoutWrapper, const Step& step)
+{
+    const auto& childWrapper = children_[step.index];
+    auto childConstraint = layoutWrapper->GetLayoutProperty()->CreateChildConstraint();
+    if (!childWrapper->IsActive()) {
+        childWrapper->Measure(childConstraint);
+        return;
+    }
+    const auto& flexItem = GetFlexItemProperty(childWrapper);
+    if (!flexItem || !flexItem->HasAlignRules()) {
+        childWrapper->Measure(childConstraint);
+        return;
+    }
+    auto frameNode = childWrapper->GetHostNode();
+    if (!flexItem->GetAlignRulesValue().empty() && frameNode && frameNode->GetLayoutProperty()) {
+        // when child has alignRules and position, the position property do not work.
+        frameNode->GetLayoutProperty()->SetUsingPosition(false);
+    }
+    CalcSizeParam(layoutWrapper, step);
+    CalcOffsetParam(step);
+}
+
 void RelativeContainerLayoutAlgorithm::MeasureSelf(LayoutWrapper* layoutWrapper)
 {
     if (Container::LessThanAPIVersion(PlatformVersion::VERSION_ELEVEN)) {
@@ -213,15 +229,13 @@ void RelativeContainerLayoutAlgorithm::MeasureSelf(LayoutWrapper* layoutWrapper)
     CHECK_NULL_VOID(relativeContainerLayoutProperty);
     RectF relativeContainerRect(0, 0, 0, 0);
     auto selfIdealSize = relativeContainerLayoutProperty->GetCalcLayoutConstraint()->selfIdealSize;
-    for (const auto& nodeName : renderList_) {
-        if (idNodeMap_.find(nodeName) == idNodeMap_.end()) {
-            continue;
-        }
-        auto childWrapper = idNodeMap_[nodeName];
+    for (const auto& step : plan_->steps) {
+        const auto& childWrapper = children_[step.index];
         if (childWrapper->GetLayoutProperty()->GetVisibility() == VisibleType::GONE) {
             continue;
         }
-        RectF tempRect(recordOffsetMap_[nodeName].GetX(), recordOffsetMap_[nodeName].GetY(),
+        const auto& childOffset = childOffsets_[step.index];
+        RectF tempRect(childOffset.GetX(), childOffset.GetY(),
             childWrapper->GetGeometryNode()->GetMarginFrameSize().Width(),
             childWrapper->GetGeometryNode()->GetMarginFrameSize().Height());
         relativeContainerRect = relativeContainerRect.CombineRectT(tempRect);
@@ -247,194 +261,155 @@ void RelativeContainerLayoutAlgorithm::Layout(LayoutWrapper* layoutWrapper)
     auto left = padding_.left.value_or(0);
     auto top = padding_.top.value_or(0);
     auto paddingOffset = OffsetF(left, top);
+    // offsets are only known for the children measured by this algorithm.
+    bool hasOffsets =
+        childOffsets_.size() == childrenWrapper.size() && plan_->idOwners.size() == childrenWrapper.size();
+    size_t index = 0;
     for (const auto& childWrapper : childrenWrapper) {
-        if (!childWrapper->GetLayoutProperty()->GetFlexItemProperty()) {
-            childWrapper->GetGeometryNode()->SetMarginFrameOffset(OffsetF(0.0f, 0.0f) + paddingOffset);
-            childWrapper->Layout();
-            continue;
-        }
-        if (!childWrapper->GetHostNode()->GetInspectorId().has_value()) {
-            childWrapper->GetGeometryNode()->SetMarginFrameOffset(OffsetF(0.0f, 0.0f) + paddingOffset);
-            childWrapper->Layout();
-            continue;
+        auto curOffset = OffsetF(0.0f, 0.0f);
+        if (hasOffsets && childWrapper->GetLayoutProperty()->GetFlexItemProperty() && plan_->idOwners[index] >= 0) {
+            curOffset = childOffsets_[plan_->idOwners[index]];
         }
-        if (recordOffsetMap_.find(childWrapper->GetHostNode()->GetInspectorIdValue()) == recordOffsetMap_.end()) {
-            childWrapper->GetGeometryNode()->SetMarginFrameOffset(OffsetF(0.0f, 0.0f) + paddingOffset);
-            childWrapper->Layout();
-            continue;
-        }
-        auto curOffset = recordOffsetMap_[childWrapper->GetHostNode()->GetInspectorIdValue()];
         childWrapper->GetGeometryNode()->SetMarginFrameOffset(curOffset + paddingOffset);
         childWrapper->Layout();
+        ++index;
     }
 }
 
 void RelativeContainerLayoutAlgorithm::CollectNodesById(LayoutWrapper* layoutWrapper)
 {
-    idNodeMap_.clear();
     auto relativeContainerLayoutProperty = layoutWrapper->GetLayoutProperty();
     auto left = padding_.left.value_or(0);
     auto top = padding_.top.value_or(0);
     auto paddingOffset = OffsetF(left, top);
     auto constraint = relativeContainerLayoutProperty->GetLayoutConstraint();
     const auto& childrenWrappers = layoutWrapper->GetAllChildrenWithBuild();
-    for (const auto& childWrapper : childrenWrappers) {
-        auto childLayoutProperty = childWrapper->GetLayoutProperty();
+    children_.assign(childrenWrappers.begin(), childrenWrappers.end());
+    childOffsets_.assign(children_.size(), OffsetF(0.0f, 0.0f));
+    for (const auto& childWrapper : children_) {
         auto childHostNode = childWrapper->GetHostNode();
         childWrapper->SetActive();
         if (childHostNode && childHostNode->GetInspectorId().has_value()) {
-            auto geometryNode = childWrapper->GetGeometryNode();
-            auto childConstraint = relativeContainerLayoutProperty->CreateChildConstraint();
             if (childHostNode->GetInspectorId()->empty()) {
+                auto childConstraint = relativeContainerLayoutProperty->CreateChildConstraint();
                 childConstraint.maxSize = SizeF(constraint->maxSize);
                 childConstraint.minSize = SizeF(0.0f, 0.0f);
                 childWrapper->Measure(childConstraint);
                 childWrapper->GetGeometryNode()->SetMarginFrameOffset(OffsetF(0.0f, 0.0f) + paddingOffset);
-                idNodeMap_.emplace(childHostNode->GetInspectorIdValue(), childWrapper);
             }
-            idNodeMap_.emplace(childHostNode->GetInspectorIdValue(), childWrapper);
         } else {
             childWrapper->SetActive(false);
         }
     }
 }
 
-void RelativeContainerLayoutAlgorithm::GetDependencyRelationship()
+bool RelativeContainerLayoutAlgorithm::IsPlanValid() const
 {
-    for (const auto& node : idNodeMap_) {
-        auto childWrapper = node.second;
-        const auto& flexItem = childWrapper->GetLayoutProperty()->GetFlexItemProperty();
-        auto childHostNode = childWrapper->GetHostNode();
-        if (!flexItem) {
-            continue;
+    if (!plan_->compiled || plan_->childIds.size() != children_.size()) {
+        return false;
+    }
+    for (size_t index = 0; index < children_.size(); ++index) {
+        auto childHostNode = children_[index]->GetHostNode();
+        if (childHostNode ? childHostNode->GetInspectorId() != plan_->childIds[index]
+                          : plan_->childIds[index].has_value()) {
+            return false;
         }
-        for (const auto& alignRule : flexItem->GetAlignRulesValue()) {
-            if (IsAnchorContainer(alignRule.second.anchor) ||
-                idNodeMap_.find(alignRule.second.anchor) == idNodeMap_.end()) {
-                    if (static_cast<uint32_t>(alignRule.first) < HORIZONTAL_DIRECTION_RANGE) {
-                        isHorizontalRelyOnContainer_ = true;
-                    } else if (static_cast<uint32_t>(alignRule.first) < VERTICAL_DIRECTION_RANGE) {
-                        isVerticalRelyOnContainer_ = true;
-                    }
-                continue;
-            }
-            auto anchorChildWrapper = idNodeMap_[alignRule.second.anchor];
-            auto anchorChildLayoutProp = anchorChildWrapper->GetLayoutProperty();
-            auto anchorChildVisibility = anchorChildLayoutProp->GetVisibility();
-            if (anchorChildVisibility == VisibleType::GONE) {
-                childWrapper->SetActive(false);
-            }
-            // if a is the anchor of b, then reliedOnMap should place <a, [b]> for the first appearance
-            // of key a. Otherwise b will be inserted into the exsiting value list
-            if (reliedOnMap_.count(alignRule.second.anchor) == 0) {
-                std::set<std::string> reliedList;
-                reliedList.insert(childHostNode->GetInspectorIdValue());
-                reliedOnMap_[alignRule.second.anchor] = reliedList;
-                continue;
-            }
-            reliedOnMap_[alignRule.second.anchor].insert(childHostNode->GetInspectorIdValue());
+        if (GetFlexItemProperty(children_[index]) != plan_->childFlexItems[index]) {
+            return false;
         }
     }
+    return true;
 }
 
-bool RelativeContainerLayoutAlgorithm::PreTopologicalLoopDetection()
+void RelativeContainerLayoutAlgorithm::CompilePlan()
 {
-    std::queue<std::string> visitedNode;
-    std::queue<std::string> layoutQueue;
+    auto& plan = *plan_;
+    auto childCount = children_.size();
+    plan = RelativeContainerLayoutPlan();
+    plan.compiled = true;
+    plan.childIds.resize(childCount);
+    plan.childFlexItems.resize(childCount);
+    plan.idOwners.assign(childCount, -1);
+    std::unordered_map<std::string, int32_t> idIndexes;
+    for (size_t index = 0; index < childCount; ++index) {
+        plan.childFlexItems[index] = GetFlexItemProperty(children_[index]);
+        auto childHostNode = children_[index]->GetHostNode();
+        if (!childHostNode || !childHostNode->GetInspectorId().has_value()) {
+            continue;
+        }
+        plan.childIds[index] = childHostNode->GetInspectorId();
+        // a later child with the same id is ignored, as the first one is found by the id.
+        plan.idOwners[index] =
+            idIndexes.emplace(childHostNode->GetInspectorIdValue(), static_cast<int32_t>(index)).first->second;
+    }
 
-    for (const auto& node : idNodeMap_) {
-        auto childWrapper = node.second;
-        auto childHostNode = childWrapper->GetHostNode();
-        const auto& flexItem = childWrapper->GetLayoutProperty()->GetFlexItemProperty();
-        if (!flexItem) {
-            visitedNode.push(node.first);
-            layoutQueue.push(childHostNode->GetInspectorIdValue());
+    std::vector<Step> steps(childCount);
+    std::vector<std::vector<int32_t>> dependents(childCount);
+    std::vector<uint32_t> incomingDegrees(childCount, 0);
+    std::vector<int32_t> order;
+    size_t nodeCount = 0;
+    for (size_t index = 0; index < childCount; ++index) {
+        if (plan.idOwners[index] != static_cast<int32_t>(index)) {
             continue;
         }
-        std::set<std::string> anchorSet;
-        for (const auto& alignRule : flexItem->GetAlignRulesValue()) {
-            if (IsAnchorContainer(alignRule.second.anchor) ||
-                idNodeMap_.find(alignRule.second.anchor) == idNodeMap_.end()) {
-                continue;
+        ++nodeCount;
+        auto& step = steps[index];
+        step.index = static_cast<int32_t>(index);
+        const auto& flexItem = plan.childFlexItems[index];
+        if (flexItem && flexItem->HasAlignRules()) {
+            for (const auto& alignRule : flexItem->GetAlignRulesValue()) {
+                auto anchor = RelativeContainerLayoutPlan::CONTAINER_ANCHOR;
+                auto iter = idIndexes.find(alignRule.second.anchor);
+                if (IsAnchorContainer(alignRule.second.anchor) || iter == idIndexes.end()) {
+                    if (static_cast<uint32_t>(alignRule.first) < HORIZONTAL_DIRECTION_RANGE) {
+                        plan.horizontalRelyOnContainer = true;
+                    } else if (static_cast<uint32_t>(alignRule.first) < VERTICAL_DIRECTION_RANGE) {
+                        plan.verticalRelyOnContainer = true;
+                    }
+                    // a rule anchored to a child not found is ignored.
+                    if (!IsAnchorContainer(alignRule.second.anchor)) {
+                        continue;
+                    }
+                } else {
+                    anchor = iter->second;
+                    if (std::find(step.anchors.begin(), step.anchors.end(), anchor) == step.anchors.end()) {
+                        step.anchors.emplace_back(anchor);
+                        dependents[anchor].emplace_back(step.index);
+                    }
+                }
+                step.rules.push_back({ alignRule.first, alignRule.second, anchor });
             }
-            anchorSet.insert(alignRule.second.anchor);
         }
-        incomingDegreeMap_[childHostNode->GetInspectorIdValue()] = anchorSet.size();
-        if (incomingDegreeMap_[childHostNode->GetInspectorIdValue()] == 0) {
-            layoutQueue.push(childHostNode->GetInspectorIdValue());
+        incomingDegrees[index] = step.anchors.size();
+        if (incomingDegrees[index] == 0) {
+            order.emplace_back(step.index);
         }
     }
-    std::map<std::string, uint32_t> incomingDegreeMapCopy;
-    incomingDegreeMapCopy.insert(incomingDegreeMap_.begin(), incomingDegreeMap_.end());
-    while (!layoutQueue.empty()) {
-        auto currentNodeInspectorId = layoutQueue.front();
-        layoutQueue.pop();
-        auto reliedSet = reliedOnMap_[currentNodeInspectorId];
-        for (const auto& node : reliedSet) {
-            if (incomingDegreeMapCopy.find(node) == incomingDegreeMapCopy.end() || IsAnchorContainer(node)) {
-                continue;
-            }
-            incomingDegreeMapCopy[node] -= 1;
-            if (incomingDegreeMapCopy[node] == 0) {
-                layoutQueue.push(node);
+    for (size_t head = 0; head < order.size(); ++head) {
+        for (auto dependent : dependents[order[head]]) {
+            if (--incomingDegrees[dependent] == 0) {
+                order.emplace_back(dependent);
             }
         }
-        incomingDegreeMapCopy.erase(currentNodeInspectorId);
-        visitedNode.push(currentNodeInspectorId);
-    }
-    if (!incomingDegreeMapCopy.empty()) {
-        std::string loopDependentNodes;
-        for (const auto& node : incomingDegreeMapCopy) {
-            loopDependentNodes += node.first + ",";
-        }
-        return false;
     }
-    return true;
-}
-
-void RelativeContainerLayoutAlgorithm::TopologicalSort(std::list<std::string>& renderList)
-{
-    std::queue<std::string> layoutQueue;
-    for (const auto& node : idNodeMap_) {
-        auto childWrapper = node.second;
-        auto childHostNode = childWrapper->GetHostNode();
-        const auto& flexItem = childWrapper->GetLayoutProperty()->GetFlexItemProperty();
-        if (!flexItem || incomingDegreeMap_[childHostNode->GetInspectorIdValue()] == 0) {
-            layoutQueue.push(childHostNode->GetInspectorIdValue());
-        }
+    if (order.size() != nodeCount) {
+        plan.hasLoop = true;
+        return;
     }
-    while (!layoutQueue.empty()) {
-        auto currentNodeInspectorId = layoutQueue.front();
-        layoutQueue.pop();
-        // reduce incoming degree of nodes relied on currentNode
-        auto reliedList = reliedOnMap_[currentNodeInspectorId];
-        for (const auto& node : reliedList) {
-            if (incomingDegreeMap_.find(node) == incomingDegreeMap_.end() || IsAnchorContainer(node)) {
-                continue;
-            }
-            incomingDegreeMap_[node] -= 1;
-            if (incomingDegreeMap_[node] == 0) {
-                layoutQueue.push(node);
-            }
-        }
-        renderList.emplace_back(currentNodeInspectorId);
+    plan.steps.reserve(order.size());
+    for (auto index : order) {
+        plan.steps.emplace_back(std::move(steps[index]));
     }
 }
 
-void RelativeContainerLayoutAlgorithm::CalcSizeParam(LayoutWrapper* layoutWrapper, const std::string& nodeName)
+void RelativeContainerLayoutAlgorithm::CalcSizeParam(LayoutWrapper* layoutWrapper, const Step& step)
 {
-    if (idNodeMap_.find(nodeName) == idNodeMap_.end()) {
-        return;
-    }
-    auto childWrapper = idNodeMap_[nodeName];
+    const auto& childWrapper = children_[step.index];
     auto childLayoutProperty = childWrapper->GetLayoutProperty();
     CHECK_NULL_VOID(childLayoutProperty);
-    CHECK_NULL_VOID(childWrapper->GetLayoutProperty()->GetFlexItemProperty());
-    CHECK_NULL_VOID(childWrapper->GetLayoutProperty()->GetFlexItemProperty()->HasAlignRules());
     auto relativeContainerLayoutProperty = layoutWrapper->GetLayoutProperty();
     CHECK_NULL_VOID(relativeContainerLayoutProperty);
     auto childConstraint = relativeContainerLayoutProperty->CreateChildConstraint();
-    auto alignRules = childWrapper->GetLayoutProperty()->GetFlexItemProperty()->GetAlignRulesValue();
     const auto& calcConstraint = childLayoutProperty->GetCalcLayoutConstraint();
     bool horizontalHasIdealSize = false;
     bool verticalHasIdealSize = false;
@@ -448,40 +423,48 @@ void RelativeContainerLayoutAlgorithm::CalcSizeParam(LayoutWrapper* layoutWrappe
     }
     horizontalHasIdealSize &= Container::GreatOrEqualAPIVersion(PlatformVersion::VERSION_ELEVEN);
     verticalHasIdealSize &= Container::GreatOrEqualAPIVersion(PlatformVersion::VERSION_ELEVEN);
-    const auto& childFlexItemProperty = childLayoutProperty->GetFlexItemProperty();
     std::optional<float> childIdealWidth;
     std::optional<float> childIdealHeight;
 
-    for (const auto& alignRule : alignRules) {
-        if (idNodeMap_.find(alignRule.second.anchor) == idNodeMap_.end() &&
-            !IsAnchorContainer(alignRule.second.anchor)) {
-            continue;
-        }
-        if (static_cast<uint32_t>(alignRule.first) < HORIZONTAL_DIRECTION_RANGE) {
-            if (!childFlexItemProperty->GetTwoHorizontalDirectionAligned()) {
-                CalcHorizontalLayoutParam(alignRule.first, alignRule.second, layoutWrapper, nodeName);
+    AlignValues alignValues;
+    auto aligned = [&alignValues](AlignDirection alignDirection) {
+        return alignValues[static_cast<size_t>(alignDirection)].has_value();
+    };
+    auto alignValue = [&alignValues](AlignDirection alignDirection) {
+        return alignValues[static_cast<size_t>(alignDirection)].value_or(0.0f);
+    };
+    auto twoHorizontalDirectionAligned = [&aligned]() {
+        return (aligned(AlignDirection::LEFT) && aligned(AlignDirection::RIGHT)) ||
+               (aligned(AlignDirection::RIGHT) && aligned(AlignDirection::MIDDLE)) ||
+               (aligned(AlignDirection::LEFT) && aligned(AlignDirection::MIDDLE));
+    };
+    auto twoVerticalDirectionAligned = [&aligned]() {
+        return (aligned(AlignDirection::TOP) && aligned(AlignDirection::CENTER)) ||
+               (aligned(AlignDirection::BOTTOM) && aligned(AlignDirection::CENTER)) ||
+               (aligned(AlignDirection::TOP) && aligned(AlignDirection::BOTTOM));
+    };
+    for (const auto& anchoredRule : step.rules) {
+        auto& value = alignValues[static_cast<size_t>(anchoredRule.direction)];
+        if (IsHorizontalDirection(anchoredRule.direction)) {
+            if (!twoHorizontalDirectionAligned()) {
+                value = CalcHorizontalAlignValue(anchoredRule);
             }
         } else {
-            if (!childFlexItemProperty->GetTwoVerticalDirectionAligned()) {
-                CalcVerticalLayoutParam(alignRule.first, alignRule.second, layoutWrapper, nodeName);
+            if (!twoVerticalDirectionAligned()) {
+                value = CalcVerticalAlignValue(anchoredRule);
             }
         }
     }
-    if (childFlexItemProperty->GetTwoHorizontalDirectionAligned()) {
-        auto checkAlign = AlignDirection::MIDDLE;
-        if (childFlexItemProperty->GetAligned(checkAlign)) {
-            auto middleValue = childFlexItemProperty->GetAlignValue(checkAlign);
-            checkAlign = AlignDirection::LEFT;
-            if (childFlexItemProperty->GetAligned(checkAlign)) {
-                childIdealWidth = 2.0f * std::max(middleValue - childFlexItemProperty->GetAlignValue(checkAlign), 0.0f);
+    if (twoHorizontalDirectionAligned()) {
+        if (aligned(AlignDirection::MIDDLE)) {
+            auto middleValue = alignValue(AlignDirection::MIDDLE);
+            if (aligned(AlignDirection::LEFT)) {
+                childIdealWidth = 2.0f * std::max(middleValue - alignValue(AlignDirection::LEFT), 0.0f);
             } else {
-                checkAlign = AlignDirection::RIGHT;
-                childIdealWidth = 2.0f * std::max(childFlexItemProperty->GetAlignValue(checkAlign) - middleValue, 0.0f);
+                childIdealWidth = 2.0f * std::max(alignValue(AlignDirection::RIGHT) - middleValue, 0.0f);
             }
         } else {
-            childIdealWidth = std::max(childFlexItemProperty->GetAlignValue(AlignDirection::RIGHT) -
-                                           childFlexItemProperty->GetAlignValue(AlignDirection::LEFT),
-                0.0f);
+            childIdealWidth = std::max(alignValue(AlignDirection::RIGHT) - alignValue(AlignDirection::LEFT), 0.0f);
         }
         if (childIdealWidth.has_value() && LessOrEqual(childIdealWidth.value(), 0.0f)) {
             childConstraint.selfIdealSize.SetWidth(0.0f);
@@ -490,23 +473,16 @@ void RelativeContainerLayoutAlgorithm::CalcSizeParam(LayoutWrapper* layoutWrappe
             return;
         }
     }
-    if (childFlexItemProperty->GetTwoVerticalDirectionAligned()) {
-        auto checkAlign = AlignDirection::CENTER;
-        if (childFlexItemProperty->GetAligned(checkAlign)) {
-            auto centerValue = childFlexItemProperty->GetAlignValue(checkAlign);
-            checkAlign = AlignDirection::TOP;
-            if (childFlexItemProperty->GetAligned(checkAlign)) {
-                childIdealHeight =
-                    2.0f * std::max(centerValue - childFlexItemProperty->GetAlignValue(checkAlign), 0.0f);
+    if (twoVerticalDirectionAligned()) {
+        if (aligned(AlignDirection::CENTER)) {
+            auto centerValue = alignValue(AlignDirection::CENTER);
+            if (aligned(AlignDirection::TOP)) {
+                childIdealHeight = 2.0f * std::max(centerValue - alignValue(AlignDirection::TOP), 0.0f);
             } else {
-                checkAlign = AlignDirection::BOTTOM;
-                childIdealHeight =
-                    2.0f * std::max(childFlexItemProperty->GetAlignValue(checkAlign) - centerValue, 0.0f);
+                childIdealHeight = 2.0f * std::max(alignValue(AlignDirection::BOTTOM) - centerValue, 0.0f);
             }
         } else {
-            childIdealHeight = std::max(childFlexItemProperty->GetAlignValue(AlignDirection::BOTTOM) -
-                                            childFlexItemProperty->GetAlignValue(AlignDirection::TOP),
-                0.0f);
+            childIdealHeight = std::max(alignValue(AlignDirection::BOTTOM) - alignValue(AlignDirection::TOP), 0.0f);
         }
         if (childIdealHeight.has_value() && LessOrEqual(childIdealHeight.value(), 0.0f)) {
             childConstraint.selfIdealSize.SetWidth(0.0f);
@@ -531,34 +507,28 @@ void RelativeContainerLayoutAlgorithm::CalcSizeParam(LayoutWrapper* layoutWrappe
     childWrapper->Measure(childConstraint);
 }
 
-void RelativeContainerLayoutAlgorithm::CalcOffsetParam(LayoutWrapper* layoutWrapper, const std::string& nodeName)
+void RelativeContainerLayoutAlgorithm::CalcOffsetParam(const Step& step)
 {
-    auto childWrapper = idNodeMap_[nodeName];
-    auto alignRules = childWrapper->GetLayoutProperty()->GetFlexItemProperty()->GetAlignRulesValue();
     float offsetX = 0.0f;
     bool offsetXCalculated = false;
     float offsetY = 0.0f;
     bool offsetYCalculated = false;
-    for (const auto& alignRule : alignRules) {
-        if (idNodeMap_.find(alignRule.second.anchor) == idNodeMap_.end() &&
-            !IsAnchorContainer(alignRule.second.anchor)) {
-            continue;
-        }
-        if (static_cast<uint32_t>(alignRule.first) < HORIZONTAL_DIRECTION_RANGE) {
+    for (const auto& anchoredRule : step.rules) {
+        if (IsHorizontalDirection(anchoredRule.direction)) {
             if (!offsetXCalculated) {
                 offsetX = CalcHorizontalOffset(
-                    alignRule.first, alignRule.second, containerSizeWithoutPaddingBorder_.Width(), nodeName);
+                    anchoredRule.direction, anchoredRule, containerSizeWithoutPaddingBorder_.Width(), step.index);
                 offsetXCalculated = true;
             }
         } else {
             if (!offsetYCalculated) {
                 offsetY = CalcVerticalOffset(
-                    alignRule.first, alignRule.second, containerSizeWithoutPaddingBorder_.Height(), nodeName);
+                    anchoredRule.direction, anchoredRule, containerSizeWithoutPaddingBorder_.Height(), step.index);
                 offsetYCalculated = true;
             }
         }
     }
-    recordOffsetMap_[nodeName] = OffsetF(offsetX, offsetY) + CalcBias(childWrapper);
+    childOffsets_[step.index] = OffsetF(offsetX, offsetY) + CalcBias(step);
 }
 
 bool RelativeContainerLayoutAlgorithm::IsValidBias(float bias)
@@ -566,12 +536,13 @@ bool RelativeContainerLayoutAlgorithm::IsValidBias(float bias)
     return GreatOrEqual(bias, 0.0f);
 }
 
-OffsetF RelativeContainerLayoutAlgorithm::CalcBias(const RefPtr<LayoutWrapper>& childWrapper)
+OffsetF RelativeContainerLayoutAlgorithm::CalcBias(const Step& step)
 {
     OffsetF emptyBiasOffset;
     if (Container::LessThanAPIVersion(PlatformVersion::VERSION_ELEVEN)) {
         return emptyBiasOffset;
     }
+    const auto& childWrapper = children_[step.index];
     auto layoutProperty = childWrapper->GetLayoutProperty();
     CHECK_NULL_RETURN(layoutProperty, emptyBiasOffset);
     const auto& flexItemProperty = layoutProperty->GetFlexItemProperty();
@@ -580,7 +551,6 @@ OffsetF RelativeContainerLayoutAlgorithm::CalcBias(const RefPtr<LayoutWrapper>&
     auto biasX = flexItemProperty->GetBiasValue().first;
     auto biasY = flexItemProperty->GetBiasValue().second;
     CHECK_NULL_RETURN(flexItemProperty->HasAlignRules(), emptyBiasOffset);
-    auto alignRules = flexItemProperty->GetAlignRulesValue();
     const auto& calcLayoutConstraint = layoutProperty->GetCalcLayoutConstraint();
     ChildIdealSize childIdealSize;
     if (calcLayoutConstraint && calcLayoutConstraint->selfIdealSize.has_value() &&
@@ -595,7 +565,7 @@ OffsetF RelativeContainerLayoutAlgorithm::CalcBias(const RefPtr<LayoutWrapper>&
     if (!childIdealSize.first.has_value() && !childIdealSize.second.has_value()) {
         return OffsetF(0.0f, 0.0f);
     }
-    auto alignedValuesOnTwoDirections = GetFirstTwoAlignValues(childWrapper, flexItemProperty, childIdealSize);
+    auto alignedValuesOnTwoDirections = GetFirstTwoAlignValues(step, childIdealSize);
     auto horizontalOffset = 0.0f;
     auto verticalOffset = 0.0f;
     auto horizontalValues = alignedValuesOnTwoDirections.first;
@@ -613,113 +583,34 @@ OffsetF RelativeContainerLayoutAlgorithm::CalcBias(const RefPtr<LayoutWrapper>&
 }
 
 std::pair<TwoAlignedValues, TwoAlignedValues> RelativeContainerLayoutAlgorithm::GetFirstTwoAlignValues(
-    const RefPtr<LayoutWrapper>& childWrapper, const std::unique_ptr<FlexItemProperty>& flexItemProperty,
-    const ChildIdealSize& childIdealSize)
+    const Step& step, const ChildIdealSize& childIdealSize)
 {
-    CHECK_NULL_RETURN(flexItemProperty, {});
-    CHECK_NULL_RETURN(flexItemProperty->HasAlignRules(), {});
-    auto alignRules = flexItemProperty->GetAlignRulesValue();
     TwoAlignedValues horizontalValues;
     TwoAlignedValues verticalValues;
-    for (const auto& alignRule : alignRules) {
+    for (const auto& anchoredRule : step.rules) {
         bool horizontalCheckTwoSidesAligned = horizontalValues.first.has_value() && horizontalValues.second.has_value();
         bool verticalCheckTwoSidesAligned = verticalValues.second.has_value() && verticalValues.second.has_value();
         if (horizontalCheckTwoSidesAligned && verticalCheckTwoSidesAligned) {
             break;
         }
-        if (idNodeMap_.find(alignRule.second.anchor) == idNodeMap_.end() &&
-            !IsAnchorContainer(alignRule.second.anchor)) {
-            continue;
-        }
-        if (static_cast<uint32_t>(alignRule.first) < HORIZONTAL_DIRECTION_RANGE && !horizontalCheckTwoSidesAligned &&
+        if (IsHorizontalDirection(anchoredRule.direction) && !horizontalCheckTwoSidesAligned &&
             childIdealSize.first.has_value()) {
-            UpdateHorizontalTwoAlignValues(horizontalValues, alignRule.second);
-        } else if (static_cast<uint32_t>(alignRule.first) >= HORIZONTAL_DIRECTION_RANGE &&
-                   !verticalCheckTwoSidesAligned && childIdealSize.second.has_value()) {
-            UpdateVerticalTwoAlignValues(verticalValues, alignRule.second);
+            UpdateHorizontalTwoAlignValues(horizontalValues, anchoredRule);
+        } else if (!IsHorizontalDirection(anchoredRule.direction) && !verticalCheckTwoSidesAligned &&
+                   childIdealSize.second.has_value()) {
+            UpdateVerticalTwoAlignValues(verticalValues, anchoredRule);
         }
     }
     return { horizontalValues, verticalValues };
 }
 
-void RelativeContainerLayoutAlgorithm::CalcHorizontalLayoutParam(AlignDirection alignDirection,
-    const AlignRule& alignRule, LayoutWrapper* layoutWrapper, const std::string& nodeName)
-{
-    if (idNodeMap_.find(nodeName) == idNodeMap_.end()) {
-        return;
-    }
-    auto childWrapper = idNodeMap_[nodeName];
-    auto childLayoutProperty = childWrapper->GetLayoutProperty();
-    CHECK_NULL_VOID(childLayoutProperty);
-    const auto& childFlexItemProperty = childLayoutProperty->GetFlexItemProperty();
-    switch (alignRule.horizontal) {
-        case HorizontalAlign::START:
-            childFlexItemProperty->SetAlignValue(
-                alignDirection, IsAnchorContainer(alignRule.anchor) ? 0.0f : recordOffsetMap_[alignRule.anchor].GetX());
-            break;
-        case HorizontalAlign::CENTER:
-            childFlexItemProperty->SetAlignValue(alignDirection,
-                IsAnchorContainer(alignRule.anchor)
-                    ? containerSizeWithoutPaddingBorder_.Width() / 2.0f
-                    : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Width() / 2.0f +
-                          recordOffsetMap_[alignRule.anchor].GetX());
-            break;
-        case HorizontalAlign::END:
-            childFlexItemProperty->SetAlignValue(
-                alignDirection, IsAnchorContainer(alignRule.anchor)
-                                    ? containerSizeWithoutPaddingBorder_.Width()
-                                    : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Width() +
-                                          recordOffsetMap_[alignRule.anchor].GetX());
-            break;
-        default:
-            break;
-    }
-}
-
-void RelativeContainerLayoutAlgorithm::CalcVerticalLayoutParam(AlignDirection alignDirection,
-    const AlignRule& alignRule, LayoutWrapper* layoutWrapper, const std::string& nodeName)
-{
-    if (idNodeMap_.find(nodeName) == idNodeMap_.end()) {
-        return;
-    }
-    auto childWrapper = idNodeMap_[nodeName];
-    auto childLayoutProperty = childWrapper->GetLayoutProperty();
-    CHECK_NULL_VOID(childLayoutProperty);
-    const auto& childFlexItemProperty = childLayoutProperty->GetFlexItemProperty();
-    switch (alignRule.vertical) {
-        case VerticalAlign::TOP:
-            childFlexItemProperty->SetAlignValue(
-                alignDirection, IsAnchorContainer(alignRule.anchor) ? 0.0f : recordOffsetMap_[alignRule.anchor].GetY());
-            break;
-        case VerticalAlign::CENTER:
-            childFlexItemProperty->SetAlignValue(alignDirection,
-                IsAnchorContainer(alignRule.anchor)
-                    ? containerSizeWithoutPaddingBorder_.Height() / 2.0f
-                    : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Height() / 2.0f +
-                          recordOffsetMap_[alignRule.anchor].GetY());
-            break;
-        case VerticalAlign::BOTTOM:
-            childFlexItemProperty->SetAlignValue(
-                alignDirection, IsAnchorContainer(alignRule.anchor)
-                                    ? containerSizeWithoutPaddingBorder_.Height()
-                                    : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Height() +
-                                          recordOffsetMap_[alignRule.anchor].GetY());
-            break;
-        default:
-            break;
-    }
-}
-
-float RelativeContainerLayoutAlgorithm::CalcHorizontalOffset(
-    AlignDirection alignDirection, const AlignRule& alignRule, float containerWidth, const std::string& nodeName)
+float RelativeContainerLayoutAlgorithm::CalcHorizontalOffset(AlignDirection alignDirection,
+    const AnchoredRule& anchoredRule, float containerWidth, int32_t index)
 {
     float offsetX = 0.0f;
-    auto childWrapper = idNodeMap_[nodeName];
-
-    float flexItemWidth = childWrapper->GetGeometryNode()->GetMarginFrameSize().Width();
-    float anchorWidth = IsAnchorContainer(alignRule.anchor)
-                            ? containerWidth
-                            : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Width();
+    const auto& alignRule = anchoredRule.rule;
+    float flexItemWidth = children_[index]->GetGeometryNode()->GetMarginFrameSize().Width();
+    float anchorWidth = IsAnchorContainer(anchoredRule.anchor) ? containerWidth : GetAnchorSize(anchoredRule).Width();
     switch (alignDirection) {
         case AlignDirection::LEFT:
             switch (alignRule.horizontal) {
@@ -769,20 +660,18 @@ float RelativeContainerLayoutAlgorithm::CalcHorizontalOffset(
         default:
             break;
     }
-    offsetX += IsAnchorContainer(alignRule.anchor) ? 0.0f : recordOffsetMap_[alignRule.anchor].GetX();
+    offsetX += IsAnchorContainer(anchoredRule.anchor) ? 0.0f : childOffsets_[anchoredRule.anchor].GetX();
     return offsetX;
 }
 
-float RelativeContainerLayoutAlgorithm::CalcVerticalOffset(
-    AlignDirection alignDirection, const AlignRule& alignRule, float containerHeight, const std::string& nodeName)
+float RelativeContainerLayoutAlgorithm::CalcVerticalOffset(AlignDirection alignDirection,
+    const AnchoredRule& anchoredRule, float containerHeight, int32_t index)
 {
     float offsetY = 0.0f;
-    auto childWrapper = idNodeMap_[nodeName];
-
-    float flexItemHeight = childWrapper->GetGeometryNode()->GetMarginFrameSize().Height();
-    float anchorHeight = IsAnchorContainer(alignRule.anchor)
-                             ? containerHeight
-                             : idNodeMap_[alignRule.anchor]->GetGeometryNode()->GetMarginFrameSize().Height();
+    const auto& alignRule = anchoredRule.rule;
+    float flexItemHeight = children_[index]->GetGeometryNode()->GetMarginFrameSize().Height();
+    float anchorHeight =
+        IsAnchorContainer(anchoredRule.anchor) ? containerHeight : GetAnchorSize(anchoredRule).Height();
     switch (alignDirection) {
         case AlignDirection::TOP:
             switch (alignRule.vertical) {
@@ -832,7 +721,7 @@ float RelativeContainerLayoutAlgorithm::CalcVerticalOffset(
         default:
             break;
     }
-    offsetY += IsAnchorContainer(alignRule.anchor) ? 0.0f : recordOffsetMap_[alignRule.anchor].GetY();
+    offsetY += IsAnchorContainer(anchoredRule.anchor) ? 0.0f : childOffsets_[anchoredRule.anchor].GetY();
     return offsetY;
 }
 
@@ -16,9 +16,13 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RELATIVE_CONTAINER_RELATIVE_CONTAINER_LAYOUT_ALGORITHM_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RELATIVE_CONTAINER_RELATIVE_CONTAINER_LAYOUT_ALGORITHM_H
 
+#include <array>
 #include <cstdint>
 #include <map>
+#include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include "core/components_ng/layout/layout_algorithm.h"
 #include "core/components_ng/layout/layout_wrapper.h"
@@ -28,50 +32,94 @@ namespace OHOS::Ace::NG {
 using AlignRulesItem = std::map<AlignDirection, AlignRule>;
 using TwoAlignedValues = std::pair<std::optional<float>, std::optional<float>>;
 using ChildIdealSize = TwoAlignedValues;
+
+/**
+ * The align rules of the children of a RelativeContainer compiled to child indexes, with the children in measure
+ * order. The pattern keeps the plan across measures, and it is only compiled again when the inspector id or the flex
+ * item property of a child changes, or when children are added or removed.
+ */
+struct RelativeContainerLayoutPlan {
+    static constexpr int32_t CONTAINER_ANCHOR = -1;
+
+    struct AnchoredRule {
+        AlignDirection direction = AlignDirection::LEFT;
+        AlignRule rule;
+        // index of the anchor child, CONTAINER_ANCHOR when anchored to the container.
+        int32_t anchor = CONTAINER_ANCHOR;
+    };
+
+    struct Step {
+        int32_t index = 0;
+        // rules whose anchor exists, in the order of AlignDirection.
+        std::vector<AnchoredRule> rules;
+        // distinct anchor children of the rules.
+        std::vector<int32_t> anchors;
+    };
+
+    bool compiled = false;
+    bool hasLoop = false;
+    bool horizontalRelyOnContainer = false;
+    bool verticalRelyOnContainer = false;
+    // inspector id and flex item property of each child when compiled. Holding the flex item property makes any
+    // update of it copy the property, so comparing the pointers is enough to find the changes.
+    std::vector<std::optional<std::string>> childIds;
+    std::vector<CowPtr<FlexItemProperty>> childFlexItems;
+    // index of the first child with the same id, -1 for a child without id.
+    std::vector<int32_t> idOwners;
+    // children with id in topological order, empty if the rules have a loop.
+    std::vector<Step> steps;
+};
+
 class ACE_EXPORT RelativeContainerLayoutAlgorithm : public LayoutAlgorithm {
     DECLARE_ACE_TYPE(RelativeContainerLayoutAlgorithm, LayoutAlgorithm);
 
 public:
-    RelativeContainerLayoutAlgorithm() = default;
+    RelativeContainerLayoutAlgorithm() : plan_(std::make_shared<RelativeContainerLayoutPlan>()) {}
+    explicit RelativeContainerLayoutAlgorithm(const std::shared_ptr<RelativeContainerLayoutPlan>& plan)
+        : plan_(plan ? plan : std::make_shared<RelativeContainerLayoutPlan>())
+    {}
     ~RelativeContainerLayoutAlgorithm() override = default;
 
     void Measure(LayoutWrapper* layoutWrapper) override;
     void Layout(LayoutWrapper* layoutWrapper) override;
 
 private:
+    using AnchoredRule = RelativeContainerLayoutPlan::AnchoredRule;
+    using Step = RelativeContainerLayoutPlan::Step;
+    // align values of the child being measured, indexed by AlignDirection.
+    using AlignValues = std::array<std::optional<float>, static_cast<size_t>(AlignDirection::BOTTOM) + 1>;
+
     void DetermineTopologicalOrder(LayoutWrapper* layoutWrapper);
     void MeasureSelf(LayoutWrapper* layoutWrapper);
     void CollectNodesById(LayoutWrapper* layoutWrapper);
-    void GetDependencyRelationship();
-    bool PreTopologicalLoopDetection();
-    void TopologicalSort(std::list<std::string>& renderList);
-    void CalcSizeParam(LayoutWrapper* layoutWrapper, const std::string& nodeName);
-    void CalcOffsetParam(LayoutWrapper* layoutWrapper, const std::string& nodeName);
-    void CalcHorizontalLayoutParam(AlignDirection alignDirection, const AlignRule& alignRule,
-        LayoutWrapper* layoutWrapper, const std::string& nodeName);
-    void CalcVerticalLayoutParam(AlignDirection alignDirection, const AlignRule& alignRule,
-        LayoutWrapper* layoutWrapper, const std::string& nodeName);
-    float CalcHorizontalOffset(
-        AlignDirection alignDirection, const AlignRule& alignRule, float containerWidth, const std::string& nodeName);
-    float CalcVerticalOffset(
-        AlignDirection alignDirection, const AlignRule& alignRule, float containerHeight, const std::string& nodeName);
+    bool IsPlanValid() const;
+    void CompilePlan();
+    void MeasureChild(LayoutWrapper* layoutWrapper, const Step& step);
+    void CalcSizeParam(LayoutWrapper* layoutWrapper, const Step& step);
+    void CalcOffsetParam(const Step& step);
+    SizeF GetAnchorSize(const AnchoredRule& anchoredRule) const;
+    std::optional<float> CalcHorizontalAlignValue(const AnchoredRule& anchoredRule);
+    std::optional<float> CalcVerticalAlignValue(const AnchoredRule& anchoredRule);
+    float CalcHorizontalOffset(AlignDirection alignDirection, const AnchoredRule& anchoredRule, float containerWidth,
+        int32_t index);
+    float CalcVerticalOffset(AlignDirection alignDirection, const AnchoredRule& anchoredRule, float containerHeight,
+        int32_t index);
 
     bool IsValidBias(float bias);
-    OffsetF CalcBias(const RefPtr<LayoutWrapper>& childWrapper);
+    OffsetF CalcBias(const Step& step);
 
-    std::pair<TwoAlignedValues, TwoAlignedValues> GetFirstTwoAlignValues(const RefPtr<LayoutWrapper>& childWrapper,
-        const std::unique_ptr<FlexItemProperty>& flexItemProperty, const ChildIdealSize& childIdealSize);
+    std::pair<TwoAlignedValues, TwoAlignedValues> GetFirstTwoAlignValues(
+        const Step& step, const ChildIdealSize& childIdealSize);
 
-    void UpdateVerticalTwoAlignValues(TwoAlignedValues& twoAlignedValues, AlignRule alignRule);
-    void UpdateHorizontalTwoAlignValues(TwoAlignedValues& twoAlignedValues, AlignRule alignRule);
+    void UpdateVerticalTwoAlignValues(TwoAlignedValues& twoAlignedValues, const AnchoredRule& anchoredRule);
+    void UpdateHorizontalTwoAlignValues(TwoAlignedValues& twoAlignedValues, const AnchoredRule& anchoredRule);
 
     bool isHorizontalRelyOnContainer_ = false;
     bool isVerticalRelyOnContainer_ = false;
-    std::list<std::string> renderList_;
-    std::map<std::string, RefPtr<LayoutWrapper>> idNodeMap_;
-    std::map<std::string, uint32_t> incomingDegreeMap_;
-    std::map<std::string, std::set<std::string>> reliedOnMap_;
-    std::map<std::string, OffsetF> recordOffsetMap_;
+    std::shared_ptr<RelativeContainerLayoutPlan> plan_;
+    std::vector<RefPtr<LayoutWrapper>> children_;
+    // offset of each child in the container without padding and border, indexed as children_.
+    std::vector<OffsetF> childOffsets_;
     PaddingPropertyF padding_;
     SizeF containerSizeWithoutPaddingBorder_;
 };
@@ -31,7 +31,7 @@ public:
 
     RefPtr<LayoutAlgorithm> CreateLayoutAlgorithm() override
     {
-        return MakeRefPtr<RelativeContainerLayoutAlgorithm>();
+        return MakeRefPtr<RelativeContainerLayoutAlgorithm>(layoutPlan_);
     }
 
     RefPtr<LayoutProperty> CreateLayoutProperty() override
@@ -43,6 +43,10 @@ public:
     {
         return false;
     }
+
+private:
+    // align rules of the children compiled by the layout algorithm, kept until the children change.
+    std::shared_ptr<RelativeContainerLayoutPlan> layoutPlan_ = std::make_shared<RelativeContainerLayoutPlan>();
 };
 
 } // namespace OHOS::Ace::NG
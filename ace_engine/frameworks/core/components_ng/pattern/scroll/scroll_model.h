@@ -58,6 +58,7 @@ public:
     virtual void SetNestedScroll(const NestedScrollOptions& nestedOpt) = 0;
     virtual void SetScrollEnabled(bool scrollEnabled) = 0;
     virtual void SetFriction(double friction) = 0;
+    virtual void SetTouchPredictionEnabled(bool isTouchPredictionEnabled) = 0;
     virtual void SetScrollSnap(ScrollSnapAlign scrollSnapAlign, const Dimension& intervalSize,
         const std::vector<Dimension>& snapPaginations, const std::pair<bool, bool>& enableSnapToSide) = 0;
     virtual void SetEnablePaging(bool enablePaging) = 0;
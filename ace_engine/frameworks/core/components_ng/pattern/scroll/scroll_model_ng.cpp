@@ -245,6 +245,15 @@ void ScrollModelNG::SetFriction(double friction)
     pattern->SetFriction(friction);
 }
 
+void ScrollModelNG::SetTouchPredictionEnabled(bool isTouchPredictionEnabled)
+{
+    auto frameNode = ViewStackProcessor::GetInstance()->GetMainFrameNode();
+    CHECK_NULL_VOID(frameNode);
+    auto pattern = frameNode->GetPattern<ScrollPattern>();
+    CHECK_NULL_VOID(pattern);
+    pattern->SetTouchPredictionEnabled(isTouchPredictionEnabled);
+}
+
 void ScrollModelNG::SetScrollSnap(ScrollSnapAlign scrollSnapAlign, const Dimension& intervalSize,
     const std::vector<Dimension>& snapPaginations, const std::pair<bool, bool>& enableSnapToSide)
 {
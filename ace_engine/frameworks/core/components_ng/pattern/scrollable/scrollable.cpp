@@ -160,6 +160,7 @@ void Scrollable::Initialize(const WeakPtr<PipelineBase>& context)
         panRecognizerNG_->SetOnActionUpdate(actionUpdate);
         panRecognizerNG_->SetOnActionEnd(actionEnd);
         panRecognizerNG_->SetOnActionCancel(actionCancel);
+        panRecognizerNG_->SetTouchPredictionEnabled(isTouchPredictionEnabled_);
     }
 
     // use RawRecognizer to receive next touch down event to stop animation.
@@ -453,6 +454,9 @@ void Scrollable::StartScrollAnimation(float mainPosition, float correctVelocity)
     float friction = friction_ > 0 ? friction_ : sFriction_;
     initVelocity_ = correctVelocity;
     finalPosition_ = mainPosition + correctVelocity / (friction * -FRICTION_SCALE);
+    if (flingPredictCallback_) {
+        flingPredictCallback_(GetFinalPosition() - mainPosition, correctVelocity);
+    }
 
     if (calePredictSnapOffsetCallback_) {
         std::optional<float> predictSnapOffset =
@@ -62,6 +62,7 @@ using ContinuousSlidingCallback = std::function<double()>;
 using CalePredictSnapOffsetCallback =
     std::function<std::optional<float>(float delta, float dragDistance, float velocity)>;
 using NeedScrollSnapToSideCallback = std::function<bool(float delta)>;
+using FlingPredictCallback = std::function<void(float predictOffset, float velocity)>;
 using NestableScrollCallback = std::function<ScrollResult(float, int32_t, NestedState)>;
 using DragFRCSceneCallback = std::function<void(double velocity, NG::SceneStatus sceneStatus)>;
 using ScrollMotionFRCSceneCallback = std::function<void(double velocity, NG::SceneStatus sceneStatus)>;
@@ -142,6 +143,14 @@ public:
         }
     }
 
+    void SetTouchPredictionEnabled(bool isTouchPredictionEnabled)
+    {
+        isTouchPredictionEnabled_ = isTouchPredictionEnabled;
+        if (panRecognizerNG_) {
+            panRecognizerNG_->SetTouchPredictionEnabled(isTouchPredictionEnabled);
+        }
+    }
+
     void SetScrollEndCallback(const ScrollEventCallback& scrollEndCallback)
     {
         scrollEndCallback_ = scrollEndCallback;
@@ -378,6 +387,11 @@ public:
         needScrollSnapToSideCallback_ = std::move(needScrollSnapToSideCallback);
     }
 
+    void SetFlingPredictCallback(FlingPredictCallback&& flingPredictCallback)
+    {
+        flingPredictCallback_ = std::move(flingPredictCallback);
+    }
+
     void ProcessScrollSnapSpringMotion(float scrollSnapDelta, float scrollSnapVelocity);
 
     void StopSnapController()
@@ -511,11 +525,13 @@ private:
 
     EdgeEffect edgeEffect_ = EdgeEffect::NONE;
     bool canOverScroll_ = true;
+    bool isTouchPredictionEnabled_ = false;
 
     // scrollSnap
     bool needScrollSnapChange_ = false;
     CalePredictSnapOffsetCallback calePredictSnapOffsetCallback_;
     NeedScrollSnapToSideCallback needScrollSnapToSideCallback_;
+    FlingPredictCallback flingPredictCallback_;
     GestureEventFunc actionEnd_;
 
     DragFRCSceneCallback dragFRCSceneCallback_;
@@ -398,6 +398,7 @@ void ScrollablePattern::AddScrollEvent()
     scrollable->SetScrollEndCallback(std::move(scrollEnd));
     scrollable->SetUnstaticFriction(friction_);
     scrollable->SetMaxFlingVelocity(maxFlingVelocity_);
+    scrollable->SetTouchPredictionEnabled(isTouchPredictionEnabled_);
 
     auto scrollSnap = [weak = WeakClaim(this)](double targetOffset, double velocity) -> bool {
         auto pattern = weak.Upgrade();
@@ -422,6 +423,13 @@ void ScrollablePattern::AddScrollEvent()
     };
     scrollable->SetNeedScrollSnapToSideCallback(std::move(needScrollSnapToSideCallback));
 
+    auto flingPredictCallback = [weak = WeakClaim(this)](float predictOffset, float velocity) {
+        auto pattern = weak.Upgrade();
+        CHECK_NULL_VOID(pattern);
+        pattern->OnFlingPredict(predictOffset);
+    };
+    scrollable->SetFlingPredictCallback(std::move(flingPredictCallback));
+
     auto dragFRCSceneCallback = [weak = WeakClaim(this)](double velocity, SceneStatus sceneStatus) {
         auto pattern = weak.Upgrade();
         CHECK_NULL_VOID(pattern);
@@ -441,6 +449,29 @@ void ScrollablePattern::AddScrollEvent()
     gestureHub->AddScrollableEvent(scrollableEvent_);
 }
 
+void ScrollablePattern::OnFlingPredict(float predictOffset)
+{
+    auto param = GetPredictBuildParam(predictOffset);
+    if (!param.has_value() || param->items.empty()) {
+        return;
+    }
+    if (!predictBuilder_) {
+        predictBuilder_ = MakeRefPtr<ScrollablePredictBuilder>(GetHost());
+    }
+    predictBuilder_->Request(std::move(param.value()));
+}
+
+std::optional<LayoutConstraintF> ScrollablePattern::GetChildParentConstraint(int32_t index) const
+{
+    auto host = GetHost();
+    CHECK_NULL_RETURN(host, std::nullopt);
+    auto child = host->GetChildByIndex(index);
+    CHECK_NULL_RETURN(child, std::nullopt);
+    auto geometryNode = child->GetGeometryNode();
+    CHECK_NULL_RETURN(geometryNode, std::nullopt);
+    return geometryNode->GetParentLayoutConstraint();
+}
+
 void ScrollablePattern::SetEdgeEffect(EdgeEffect edgeEffect)
 {
     auto gestureHub = GetGestureHub();
@@ -642,7 +673,7 @@ void ScrollablePattern::UpdateBorderRadius()
     }
 }
 
-void ScrollablePattern::SetScrollBar(const std::unique_ptr<ScrollBarProperty>& property)
+void ScrollablePattern::SetScrollBar(const CowPtr<ScrollBarProperty>& property)
 {
     if (!property) {
         SetScrollBar(DisplayMode::AUTO);
@@ -784,6 +815,14 @@ void ScrollablePattern::SetMaxFlingVelocity(double max)
     scrollable->SetMaxFlingVelocity(max);
 }
 
+void ScrollablePattern::SetTouchPredictionEnabled(bool isTouchPredictionEnabled)
+{
+    isTouchPredictionEnabled_ = isTouchPredictionEnabled;
+    CHECK_NULL_VOID(scrollableEvent_);
+    auto scrollable = scrollableEvent_->GetScrollable();
+    scrollable->SetTouchPredictionEnabled(isTouchPredictionEnabled_);
+}
+
 void ScrollablePattern::GetParentNavigation()
 {
     if (navBarPattern_) {
@@ -36,6 +36,7 @@
 #include "core/components_ng/pattern/scrollable/scrollable_controller.h"
 #include "core/components_ng/pattern/scrollable/scrollable_coordination_event.h"
 #include "core/components_ng/pattern/scrollable/scrollable_paint_property.h"
+#include "core/components_ng/pattern/scrollable/scrollable_predict_builder.h"
 #include "core/components_ng/pattern/scrollable/scrollable_properties.h"
 #include "core/components_ng/render/animation_utils.h"
 #include "core/event/mouse_event.h"
@@ -153,7 +154,7 @@ public:
 
     // scrollBar
     virtual void UpdateScrollBarOffset() = 0;
-    void SetScrollBar(const std::unique_ptr<ScrollBarProperty>& property);
+    void SetScrollBar(const CowPtr<ScrollBarProperty>& property);
     void SetScrollBar(DisplayMode displayMode);
     void SetScrollBarProxy(const RefPtr<ScrollBarProxy>& scrollBarProxy);
     void CreateScrollBarOverlayModifier();
@@ -264,6 +265,8 @@ public:
 
     void SetMaxFlingVelocity(double max);
 
+    void SetTouchPredictionEnabled(bool isTouchPredictionEnabled);
+
     void StopAnimate();
     bool AnimateRunning() const
     {
@@ -328,6 +331,13 @@ public:
         return false;
     }
 
+    // prebuild children a fling is going to bring into view, [predictOffset] is the offset at the end of fling.
+    virtual std::optional<PredictBuildParam> GetPredictBuildParam(float predictOffset)
+    {
+        return std::nullopt;
+    }
+    void OnFlingPredict(float predictOffset);
+
     void SetScrollSource(int32_t scrollSource)
     {
         if (scrollSource == SCROLL_FROM_JUMP || scrollSource == SCROLL_FROM_FOCUS_JUMP) {
@@ -501,6 +511,8 @@ protected:
 
     void Register2DragDropManager();
 
+    std::optional<LayoutConstraintF> GetChildParentConstraint(int32_t index) const;
+
 private:
     virtual void OnScrollEndCallback() {};
 
@@ -592,6 +604,7 @@ private:
     RefPtr<ScrollableEvent> scrollableEvent_;
     RefPtr<ScrollEdgeEffect> scrollEffect_;
     RefPtr<RefreshCoordination> refreshCoordination_;
+    RefPtr<ScrollablePredictBuilder> predictBuilder_;
     int32_t scrollSource_ = SCROLL_FROM_NONE;
     // scrollBar
     RefPtr<ScrollBar> scrollBar_;
@@ -606,6 +619,7 @@ private:
     double scrollBarOutBoundaryExtent_ = 0.0;
     double friction_ = FRICTION;
     double maxFlingVelocity_ = MAX_VELOCITY;
+    bool isTouchPredictionEnabled_ = false;
     // scroller
     RefPtr<Animator> animator_;
     bool scrollAbort_ = false;
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/scrollable/scrollable_predict_builder.h"
+
+#include <cmath>
+
+#include "base/log/ace_trace.h"
+#include "base/utils/time_util.h"
+#include "base/utils/utils.h"
+#include "core/components_ng/base/frame_node.h"
+#include "core/pipeline_ng/pipeline_context.h"
+
+namespace OHOS::Ace::NG {
+void ScrollablePredictBuilder::Request(PredictBuildParam&& param)
+{
+    if (param.items.empty()) {
+        param_.reset();
+        return;
+    }
+    param_ = std::move(param);
+    PostIdleTask();
+}
+
+std::list<int32_t> ScrollablePredictBuilder::ComputePredictItems(float delta, const PredictRangeInfo& info)
+{
+    std::list<int32_t> items;
+    if (NearZero(delta) || info.totalCount <= 0 || info.endIndex < info.startIndex ||
+        LessOrEqual(info.averageLineSize, 0.0f)) {
+        return items;
+    }
+    auto maxCount = (info.endIndex - info.startIndex + 1) * PREDICT_VIEWPORT_COUNT;
+    auto lines = static_cast<int32_t>(std::ceil(std::abs(delta) / info.averageLineSize));
+    auto count = std::min(lines * std::max(info.lanes, 1), maxCount);
+    if (Negative(delta)) {
+        auto last = std::min(info.totalCount - 1, info.endIndex + count);
+        for (auto index = info.endIndex + 1; index <= last; ++index) {
+            items.emplace_back(index + info.indexOffset);
+        }
+    } else {
+        auto first = std::max(0, info.startIndex - count);
+        for (auto index = info.startIndex - 1; index >= first; --index) {
+            items.emplace_back(index + info.indexOffset);
+        }
+    }
+    return items;
+}
+
+void ScrollablePredictBuilder::PostIdleTask()
+{
+    if (taskPosted_) {
+        return;
+    }
+    auto host = host_.Upgrade();
+    CHECK_NULL_VOID(host);
+    auto context = host->GetContext();
+    CHECK_NULL_VOID(context);
+    taskPosted_ = true;
+    context->AddPredictTask([weak = WeakClaim(this)](int64_t deadline, bool canUseLongPredictTask) {
+        auto builder = weak.Upgrade();
+        CHECK_NULL_VOID(builder);
+        builder->taskPosted_ = false;
+        builder->OnIdle(deadline);
+    });
+}
+
+void ScrollablePredictBuilder::OnIdle(int64_t deadline)
+{
+    ACE_SCOPED_TRACE("Scrollable predict");
+    auto host = host_.Upgrade();
+    CHECK_NULL_VOID(host);
+    if (!HasPendingItems()) {
+        param_.reset();
+        return;
+    }
+    auto& items = param_->items;
+    bool needMarkDirty = false;
+    while (!items.empty()) {
+        if (GetSysTimestamp() > deadline) {
+            break;
+        }
+        auto wrapper = host->GetOrCreateChildByIndex(items.front(), false);
+        if (wrapper && wrapper->GetHostNode() && !wrapper->GetHostNode()->RenderCustomChild(deadline)) {
+            break;
+        }
+        needMarkDirty |= PredictBuildItem(wrapper, param_->layoutConstraint);
+        items.pop_front();
+    }
+    if (needMarkDirty) {
+        host->MarkDirtyNode(PROPERTY_UPDATE_LAYOUT);
+    }
+    if (items.empty()) {
+        param_.reset();
+        return;
+    }
+    PostIdleTask();
+}
+
+bool ScrollablePredictBuilder::PredictBuildItem(
+    const RefPtr<LayoutWrapper>& wrapper, const LayoutConstraintF& constraint)
+{
+    CHECK_NULL_RETURN(wrapper, false);
+    wrapper->SetActive(false);
+    auto frameNode = wrapper->GetHostNode();
+    CHECK_NULL_RETURN(frameNode, false);
+    auto geometryNode = frameNode->GetGeometryNode();
+    CHECK_NULL_RETURN(geometryNode, false);
+    // already measured with the same constraint, nothing left to prebuild
+    if (!frameNode->IsLayoutDirtyMarked() && geometryNode->GetParentLayoutConstraint() == constraint) {
+        return false;
+    }
+    geometryNode->SetParentLayoutConstraint(constraint);
+    FrameNode::ProcessOffscreenNode(frameNode);
+    return true;
+}
+} // namespace OHOS::Ace::NG
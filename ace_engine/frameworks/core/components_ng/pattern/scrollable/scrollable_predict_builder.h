@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_SCROLLABLE_SCROLLABLE_PREDICT_BUILDER_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_SCROLLABLE_SCROLLABLE_PREDICT_BUILDER_H
+
+#include <list>
+#include <optional>
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+#include "core/components_ng/layout/layout_property.h"
+
+namespace OHOS::Ace::NG {
+class FrameNode;
+class LayoutWrapper;
+
+constexpr int32_t PREDICT_VIEWPORT_COUNT = 2;
+
+struct PredictBuildParam {
+    // child indices to build, ordered by priority
+    std::list<int32_t> items;
+    LayoutConstraintF layoutConstraint;
+};
+
+struct PredictRangeInfo {
+    // first and last item index currently in the viewport
+    int32_t startIndex = 0;
+    int32_t endIndex = -1;
+    int32_t totalCount = 0;
+    // number of items placed side by side in the cross axis
+    int32_t lanes = 1;
+    // average main size of one line of items, gap included
+    float averageLineSize = 0.0f;
+    // offset of child index relative to item index, e.g. the header of WaterFlow
+    int32_t indexOffset = 0;
+};
+
+/**
+ * Builds and measures the children a fling is going to bring into the viewport. The work is
+ * done in the predict (idle) tasks of the pipeline, so frames during the fling only need to
+ * attach and place these children.
+ */
+class ScrollablePredictBuilder : public AceType {
+    DECLARE_ACE_TYPE(ScrollablePredictBuilder, AceType);
+
+public:
+    explicit ScrollablePredictBuilder(const WeakPtr<FrameNode>& host) : host_(host) {}
+    ~ScrollablePredictBuilder() override = default;
+
+    /**
+     * @brief Replaces the pending items with [param] and requests an idle task if none is pending.
+     */
+    void Request(PredictBuildParam&& param);
+
+    void Cancel()
+    {
+        param_.reset();
+    }
+
+    bool HasPendingItems() const
+    {
+        return param_.has_value() && !param_->items.empty();
+    }
+
+    /**
+     * @brief Computes the items a scroll of [delta] will bring into view, nearest to the viewport first.
+     *
+     * @param delta predicted scroll offset, negative when scrolling towards the end.
+     * @param info current viewport and size information of the scrollable.
+     * @return child indices to build, at most [PREDICT_VIEWPORT_COUNT] viewports of items.
+     */
+    static std::list<int32_t> ComputePredictItems(float delta, const PredictRangeInfo& info);
+
+private:
+    void PostIdleTask();
+    void OnIdle(int64_t deadline);
+    static bool PredictBuildItem(const RefPtr<LayoutWrapper>& wrapper, const LayoutConstraintF& constraint);
+
+    WeakPtr<FrameNode> host_;
+    std::optional<PredictBuildParam> param_;
+    bool taskPosted_ = false;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ScrollablePredictBuilder);
+};
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERNS_SCROLLABLE_SCROLLABLE_PREDICT_BUILDER_H
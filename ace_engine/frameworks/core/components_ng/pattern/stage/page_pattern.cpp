@@ -56,6 +56,44 @@ void PagePattern::OnAttachToFrameNode()
     host->GetLayoutProperty()->UpdateAlignment(Alignment::TOP_LEFT);
 }
 
+void PagePattern::OnDetachFromMainTree()
+{
+    // the page is removed from stage, drop the dirty nodes parked for it.
+    WakeUp(false);
+}
+
+void PagePattern::Hibernate()
+{
+    if (isHibernated_ || isOnShow_) {
+        return;
+    }
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    // nodes out of router pages share page id 0, they are never hibernated.
+    if (host->GetPageId() <= 0) {
+        return;
+    }
+    auto context = host->GetContext();
+    CHECK_NULL_VOID(context);
+    isHibernated_ = true;
+    context->HibernatePage(host->GetPageId());
+    // decoded images are loaded again when the page becomes visible.
+    context->GetMemoryManager()->ReleasePage(host->GetId());
+}
+
+void PagePattern::WakeUp(bool restoreDirtyNodes)
+{
+    if (!isHibernated_) {
+        return;
+    }
+    isHibernated_ = false;
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    auto context = host->GetContext();
+    CHECK_NULL_VOID(context);
+    context->WakeUpPage(host->GetPageId(), restoreDirtyNodes);
+}
+
 bool PagePattern::OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& /*wrapper*/, const DirtySwapConfig& /*config*/)
 {
     if (isFirstLoad_) {
@@ -140,6 +178,7 @@ void PagePattern::ProcessHideState()
     host->SetActive(false);
     host->OnVisibleChange(false);
     host->GetLayoutProperty()->UpdateVisibility(VisibleType::INVISIBLE);
+    Hibernate();
     auto parent = host->GetAncestorNodeOfFrame();
     CHECK_NULL_VOID(parent);
     parent->MarkNeedSyncRenderTree();
@@ -150,6 +189,7 @@ void PagePattern::ProcessShowState()
 {
     auto host = GetHost();
     CHECK_NULL_VOID(host);
+    WakeUp();
     host->SetActive(true);
     host->OnVisibleChange(true);
     host->GetLayoutProperty()->UpdateVisibility(VisibleType::VISIBLE);
@@ -64,6 +64,11 @@ public:
 
     void OnHide();
 
+    bool IsOnShow() const
+    {
+        return isOnShow_;
+    }
+
     bool OnBackPressed() const
     {
         if (isPageInTransition_) {
@@ -140,6 +145,11 @@ public:
     // Mark current page node visible in render tree.
     void ProcessShowState();
 
+    bool IsHibernated() const
+    {
+        return isHibernated_;
+    }
+
     void StopPageTransition();
 
     void MarkRenderDone()
@@ -169,10 +179,14 @@ public:
 
 private:
     void OnAttachToFrameNode() override;
+    void OnDetachFromMainTree() override;
     void BeforeCreateLayoutWrapper() override;
     bool OnDirtyLayoutWrapperSwap(const RefPtr<LayoutWrapper>& wrapper, const DirtySwapConfig& config) override;
     void FirePageTransitionFinish();
     void ProcessAutoSave();
+    // A hidden page stops laying out and rendering, and releases the data its nodes can regenerate.
+    void Hibernate();
+    void WakeUp(bool restoreDirtyNodes = true);
 
     bool AvoidKeyboard() const override;
     bool AvoidTop() const override
@@ -191,6 +205,7 @@ private:
     std::list<RefPtr<PageTransitionEffect>> pageTransitionEffects_;
 
     bool isOnShow_ = false;
+    bool isHibernated_ = false;
     bool isFirstLoad_ = true;
     bool isPageInTransition_ = false;
     bool isRenderDone_ = false;
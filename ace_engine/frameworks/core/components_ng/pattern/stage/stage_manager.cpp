@@ -429,6 +429,7 @@ void StageManager::FirePageShow(const RefPtr<UINode>& node, PageTransitionType t
     auto context = PipelineContext::GetCurrentContext();
     CHECK_NULL_VOID(context);
     context->MarkNeedFlushMouseEvent();
+    context->GetMemoryManager()->OnPageShow(pageNode->GetId());
 #ifdef UICAST_COMPONENT_SUPPORTED
     do {
         auto container = Container::Current();
@@ -1483,6 +1483,7 @@ void SwiperPattern::UpdateAnimationProperty(float velocity)
     if (isDragging_ || childScrolling_) {
         targetIndex_ = ComputeNextIndexByVelocity(velocity);
         velocity_ = velocity;
+        PredictBuildTargetItems(targetIndex_.value());
     } else {
         targetIndex_ = pauseTargetIndex_;
         velocity_ = velocity;
@@ -1492,6 +1493,48 @@ void SwiperPattern::UpdateAnimationProperty(float velocity)
     moveDirection_ = velocity <= 0;
 }
 
+void SwiperPattern::PredictBuildTargetItems(int32_t targetIndex)
+{
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    auto layoutProperty = GetLayoutProperty<SwiperLayoutProperty>();
+    CHECK_NULL_VOID(layoutProperty);
+    if (itemPosition_.empty() || TotalCount() <= 0) {
+        return;
+    }
+    auto cachedCount = layoutProperty->GetCachedCountValue(1);
+    auto first = targetIndex - cachedCount;
+    auto last = targetIndex + GetDisplayCount() - 1 + cachedCount;
+    bool forward = targetIndex >= currentIndex_;
+    std::set<int32_t> loopIndexSet;
+    std::list<int32_t> items;
+    for (auto i = 0; i <= last - first; ++i) {
+        auto index = forward ? first + i : last - i;
+        if (itemPosition_.find(index) != itemPosition_.end()) {
+            continue;
+        }
+        if (!IsLoop() && (index < 0 || index >= TotalCount())) {
+            continue;
+        }
+        auto loopIndex = GetLoopIndex(index);
+        if (loopIndexSet.emplace(loopIndex).second) {
+            items.emplace_back(loopIndex);
+        }
+    }
+    if (items.empty()) {
+        return;
+    }
+    // items of swiper are measured with the same constraint
+    auto child = host->GetChildByIndex(GetLoopIndex(itemPosition_.begin()->first));
+    CHECK_NULL_VOID(child);
+    auto constraint = child->GetGeometryNode()->GetParentLayoutConstraint();
+    CHECK_NULL_VOID(constraint);
+    if (!predictBuilder_) {
+        predictBuilder_ = MakeRefPtr<ScrollablePredictBuilder>(host);
+    }
+    predictBuilder_->Request({ std::move(items), constraint.value() });
+}
+
 void SwiperPattern::OnTouchTestHit(SourceType hitTestType)
 {
     // in mouse hover test case.
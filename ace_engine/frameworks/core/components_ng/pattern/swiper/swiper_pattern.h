@@ -31,6 +31,7 @@
 #include "core/components_ng/event/input_event.h"
 #include "core/components_ng/pattern/pattern.h"
 #include "core/components_ng/pattern/scrollable/nestable_scroll_container.h"
+#include "core/components_ng/pattern/scrollable/scrollable_predict_builder.h"
 #include "core/components_ng/pattern/swiper/swiper_accessibility_property.h"
 #include "core/components_ng/pattern/swiper/swiper_event_hub.h"
 #include "core/components_ng/pattern/swiper/swiper_layout_algorithm.h"
@@ -665,6 +666,7 @@ private:
     float GetCustomPropertyOffset() const;
     float GetCurrentFirstIndexStartPos() const;
     void UpdateAnimationProperty(float velocity);
+    void PredictBuildTargetItems(int32_t targetIndex);
     void TriggerAnimationEndOnForceStop();
     void TriggerAnimationEndOnSwipeToLeft();
     void TriggerAnimationEndOnSwipeToRight();
@@ -761,6 +763,9 @@ private:
     // Control translate animation when drag end.
     RefPtr<Animator> controller_;
 
+    // Prebuild items around the target index of a fling in idle time.
+    RefPtr<ScrollablePredictBuilder> predictBuilder_;
+
     // Control spring animation when drag beyond boundary and drag end.
     std::shared_ptr<AnimationUtils::Animation> springAnimation_;
 
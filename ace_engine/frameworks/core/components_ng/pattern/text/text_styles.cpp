@@ -25,8 +25,8 @@ namespace OHOS::Ace::NG {
         }                                                \
     } while (false)
 
-TextStyle CreateTextStyleUsingTheme(const std::unique_ptr<FontStyle>& fontStyle,
-    const std::unique_ptr<TextLineStyle>& textLineStyle, const RefPtr<TextTheme>& textTheme)
+TextStyle CreateTextStyleUsingTheme(const CowPtr<FontStyle>& fontStyle,
+    const CowPtr<TextLineStyle>& textLineStyle, const RefPtr<TextTheme>& textTheme)
 {
     TextStyle textStyle = textTheme ? textTheme->GetTextStyle() : TextStyle();
     if (fontStyle) {
@@ -63,7 +63,7 @@ TextStyle CreateTextStyleUsingTheme(const std::unique_ptr<FontStyle>& fontStyle,
 }
 
 TextStyle CreateTextStyleUsingThemeWithText(const RefPtr<FrameNode> frameNode,
-    const std::unique_ptr<FontStyle>& fontStyle, const std::unique_ptr<TextLineStyle>& textLineStyle,
+    const CowPtr<FontStyle>& fontStyle, const CowPtr<TextLineStyle>& textLineStyle,
     const RefPtr<TextTheme>& textTheme)
 {
     TextStyle textStyle = CreateTextStyleUsingTheme(fontStyle, textLineStyle, textTheme);
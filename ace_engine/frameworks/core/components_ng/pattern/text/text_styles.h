@@ -90,11 +90,11 @@ struct HandleInfoNG {
     RectF rect;
 };
 
-TextStyle CreateTextStyleUsingTheme(const std::unique_ptr<FontStyle>& fontStyle,
-    const std::unique_ptr<TextLineStyle>& textLineStyle, const RefPtr<TextTheme>& textTheme);
+TextStyle CreateTextStyleUsingTheme(const CowPtr<FontStyle>& fontStyle,
+    const CowPtr<TextLineStyle>& textLineStyle, const RefPtr<TextTheme>& textTheme);
 
 TextStyle CreateTextStyleUsingThemeWithText(const RefPtr<FrameNode> frameNode,
-    const std::unique_ptr<FontStyle>& fontStyle, const std::unique_ptr<TextLineStyle>& textLineStyle,
+    const CowPtr<FontStyle>& fontStyle, const CowPtr<TextLineStyle>& textLineStyle,
     const RefPtr<TextTheme>& textTheme);
 
 std::string GetFontFamilyInJson(const std::optional<std::vector<std::string>>& value);
@@ -220,6 +220,21 @@ int32_t WaterFlowLayoutInfo::GetMainCount() const
     return maxMainCount;
 }
 
+float WaterFlowLayoutInfo::GetAverageItemMainSize() const
+{
+    float totalHeight = 0.0f;
+    int32_t totalCount = 0;
+    for (const auto& crossItems : waterFlowItems_) {
+        if (crossItems.second.empty()) {
+            continue;
+        }
+        const auto& lastItem = crossItems.second.rbegin()->second;
+        totalHeight += lastItem.first + lastItem.second;
+        totalCount += static_cast<int32_t>(crossItems.second.size());
+    }
+    return totalCount > 0 ? totalHeight / totalCount : 0.0f;
+}
+
 void WaterFlowLayoutInfo::ClearCacheAfterIndex(int32_t currentIndex)
 {
     for (auto& crossItems : waterFlowItems_) {
@@ -51,6 +51,8 @@ public:
     void Reset(int32_t resetFrom);
     int32_t GetCrossCount() const;
     int32_t GetMainCount() const;
+    // average main size of the measured items, gap included
+    float GetAverageItemMainSize() const;
     void ClearCacheAfterIndex(int32_t currentIndex);
 
     bool ReachStart(float prevOffset, bool firstLayout) const;
@@ -98,7 +98,7 @@ public:
             itemLayoutConstraint_ = std::make_unique<MeasureProperty>();
         }
         if (itemLayoutConstraint_->UpdateMinSizeWithCheck(value)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+            UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
         }
     }
 
@@ -108,7 +108,7 @@ public:
             itemLayoutConstraint_ = std::make_unique<MeasureProperty>();
         }
         if (itemLayoutConstraint_->UpdateMaxSizeWithCheck(value)) {
-            propertyChangeFlag_ = propertyChangeFlag_ | PROPERTY_UPDATE_MEASURE;
+            UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
         }
     }
 
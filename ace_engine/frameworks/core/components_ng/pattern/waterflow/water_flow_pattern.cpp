@@ -462,6 +462,30 @@ void WaterFlowPattern::SetEdgeEffectCallback(const RefPtr<ScrollEdgeEffect>& scr
     scrollEffect->SetInitTrailingCallback([]() -> double { return 0.0; });
 }
 
+std::optional<PredictBuildParam> WaterFlowPattern::GetPredictBuildParam(float predictOffset)
+{
+    auto layoutProperty = GetLayoutProperty<WaterFlowLayoutProperty>();
+    CHECK_NULL_RETURN(layoutProperty, std::nullopt);
+    if (layoutProperty->IsReverse()) {
+        predictOffset = -predictOffset;
+    }
+    PredictRangeInfo rangeInfo;
+    rangeInfo.indexOffset = layoutInfo_.footerIndex_ + 1;
+    rangeInfo.startIndex = layoutInfo_.startIndex_;
+    rangeInfo.endIndex = layoutInfo_.endIndex_;
+    rangeInfo.totalCount = layoutInfo_.childrenCount_ - rangeInfo.indexOffset;
+    rangeInfo.lanes = layoutInfo_.GetCrossCount();
+    rangeInfo.averageLineSize = layoutInfo_.GetAverageItemMainSize();
+    auto items = ScrollablePredictBuilder::ComputePredictItems(predictOffset, rangeInfo);
+    if (items.empty()) {
+        return std::nullopt;
+    }
+    auto nearestIndex = Negative(predictOffset) ? rangeInfo.endIndex : rangeInfo.startIndex;
+    auto constraint = GetChildParentConstraint(nearestIndex + rangeInfo.indexOffset);
+    CHECK_NULL_RETURN(constraint, std::nullopt);
+    return PredictBuildParam { std::move(items), constraint.value() };
+}
+
 void WaterFlowPattern::MarkDirtyNodeSelf()
 {
     auto host = GetHost();
@@ -132,6 +132,7 @@ private:
     void CheckScrollable();
     bool IsOutOfBoundary(bool useCurrentDelta = true) override;
     void SetEdgeEffectCallback(const RefPtr<ScrollEdgeEffect>& scrollEffect) override;
+    std::optional<PredictBuildParam> GetPredictBuildParam(float predictOffset) override;
     SizeF GetContentSize() const;
     void MarkDirtyNodeSelf();
     void OnScrollEndCallback() override;
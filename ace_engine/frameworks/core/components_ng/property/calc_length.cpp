@@ -32,13 +32,24 @@ ScaleProperty ScaleProperty::CreateScaleProperty()
     return scaleProperty;
 }
 
+void CalcLength::CompileCalcValue()
+{
+    if (calcValue_.empty()) {
+        calcExp_.reset();
+        return;
+    }
+    calcExp_ = std::make_shared<const std::vector<StringExpression::CalcToken>>(
+        StringExpression::CompileExp(calcValue_));
+}
+
 bool CalcLength::NormalizeToPx(
     double vpScale, double fpScale, double lpxScale, double parentLength, double& result) const
 {
     // don't use this function for calc.
     if (!calcValue_.empty()) {
+        CHECK_NULL_RETURN(calcExp_, false);
         result = StringExpression::CalculateExp(
-            calcValue_, [vpScale, fpScale, lpxScale, parentLength](const Dimension& dim) -> double {
+            *calcExp_, [vpScale, fpScale, lpxScale, parentLength](const Dimension& dim) -> double {
                 double result = -1.0;
                 dim.NormalizeToPx(vpScale, fpScale, lpxScale, parentLength, result);
                 return result;
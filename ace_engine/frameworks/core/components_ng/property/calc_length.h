@@ -16,8 +16,12 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_COMPONENTS_NG_PROPERTIES_CALC_LENGTH_H
 #define FOUNDATION_ACE_FRAMEWORKS_COMPONENTS_NG_PROPERTIES_CALC_LENGTH_H
 
+#include <memory>
+#include <vector>
+
 #include "base/geometry/dimension.h"
 #include "base/geometry/ng/size_t.h"
+#include "base/utils/string_expression.h"
 #include "base/utils/utils.h"
 
 namespace OHOS::Ace::NG {
@@ -50,7 +54,10 @@ struct ACE_EXPORT ScaleProperty {
 class CalcLength {
 public:
     CalcLength() = default;
-    explicit CalcLength(const std::string& value) : calcValue_(value) {}
+    explicit CalcLength(const std::string& value) : calcValue_(value)
+    {
+        CompileCalcValue();
+    }
     ~CalcLength() = default;
 
     explicit CalcLength(double value, DimensionUnit unit = DimensionUnit::PX) : dimension_(value, unit) {};
@@ -59,6 +66,7 @@ public:
     void Reset()
     {
         calcValue_ = "";
+        calcExp_.reset();
         dimension_.Reset();
     }
 
@@ -70,6 +78,7 @@ public:
     void SetCalcValue(const std::string& value)
     {
         calcValue_ = value;
+        CompileCalcValue();
     }
 
     bool NormalizeToPx(double vpScale, double fpScale, double lpxScale, double parentLength, double& result) const;
@@ -117,7 +126,11 @@ public:
     }
 
 private:
+    void CompileCalcValue();
+
     std::string calcValue_;
+    // calcValue_ parsed once when it is set, copies of the length share it.
+    std::shared_ptr<const std::vector<StringExpression::CalcToken>> calcExp_;
     Dimension dimension_;
 };
 } // namespace OHOS::Ace::NG
@@ -123,6 +123,15 @@ PaddingPropertyF ConvertToPaddingPropertyF(
     return ConvertToPaddingPropertyF(*padding, scaleProperty, percentReference);
 }
 
+PaddingPropertyF ConvertToPaddingPropertyF(
+    const CowPtr<PaddingProperty>& padding, const ScaleProperty& scaleProperty, float percentReference)
+{
+    if (!padding) {
+        return {};
+    }
+    return ConvertToPaddingPropertyF(*padding, scaleProperty, percentReference);
+}
+
 PaddingPropertyF ConvertToPaddingPropertyF(
     const PaddingProperty& padding, const ScaleProperty& scaleProperty, float percentReference)
 {
@@ -139,6 +148,12 @@ MarginPropertyF ConvertToMarginPropertyF(
     return ConvertToPaddingPropertyF(margin, scaleProperty, percentReference);
 }
 
+MarginPropertyF ConvertToMarginPropertyF(
+    const CowPtr<MarginProperty>& margin, const ScaleProperty& scaleProperty, float percentReference)
+{
+    return ConvertToPaddingPropertyF(margin, scaleProperty, percentReference);
+}
+
 MarginPropertyF ConvertToMarginPropertyF(
     const MarginProperty& margin, const ScaleProperty& scaleProperty, float percentReference)
 {
@@ -154,6 +169,15 @@ BorderWidthPropertyF ConvertToBorderWidthPropertyF(
     return ConvertToBorderWidthPropertyF(*borderWidth, scaleProperty, percentReference);
 }
 
+BorderWidthPropertyF ConvertToBorderWidthPropertyF(
+    const CowPtr<BorderWidthProperty>& borderWidth, const ScaleProperty& scaleProperty, float percentReference)
+{
+    if (!borderWidth) {
+        return {};
+    }
+    return ConvertToBorderWidthPropertyF(*borderWidth, scaleProperty, percentReference);
+}
+
 BorderWidthPropertyF ConvertToBorderWidthPropertyF(
     const BorderWidthProperty& borderWidth, const ScaleProperty& scaleProperty, float percentReference)
 {
@@ -335,6 +359,18 @@ OptionalSizeF UpdateOptionSizeByCalcLayoutConstraint(const OptionalSize<float>&
     return finalSize;
 }
 
+OptionalSizeF UpdateOptionSizeByCalcLayoutConstraint(const OptionalSize<float>& frameSize,
+    const CowPtr<MeasureProperty>& calcLayoutConstraint, const SizeT<float> percentReference)
+{
+    OptionalSizeF finalSize(frameSize.Width(), frameSize.Height());
+    if (!calcLayoutConstraint) {
+        return finalSize;
+    }
+    UpdateOptionSizeByMaxOrMinCalcLayoutConstraint(finalSize, calcLayoutConstraint->maxSize, percentReference, true);
+    UpdateOptionSizeByMaxOrMinCalcLayoutConstraint(finalSize, calcLayoutConstraint->minSize, percentReference, false);
+    return finalSize;
+}
+
 void UpdateOptionSizeByMaxOrMinCalcLayoutConstraint(OptionalSizeF& frameSize,
     const std::optional<CalcSize>& calcLayoutConstraintMaxMinSize, const SizeT<float> percentReference, bool IsMaxSize)
 {
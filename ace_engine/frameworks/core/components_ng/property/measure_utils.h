@@ -21,6 +21,7 @@
 #include "base/geometry/calc_dimension.h"
 #include "base/geometry/ng/offset_t.h"
 #include "base/geometry/ng/size_t.h"
+#include "base/memory/cow_ptr.h"
 #include "base/utils/macros.h"
 #include "core/components_ng/property/border_property.h"
 #include "core/components_ng/property/calc_length.h"
@@ -48,18 +49,27 @@ SizeF ConstrainSize(const SizeF& size, const SizeF& minSize, const SizeF& maxSiz
 PaddingPropertyF ConvertToPaddingPropertyF(const std::unique_ptr<PaddingProperty>& padding,
     const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
+PaddingPropertyF ConvertToPaddingPropertyF(
+    const CowPtr<PaddingProperty>& padding, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
+
 PaddingPropertyF ConvertToPaddingPropertyF(
     const PaddingProperty& padding, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
 MarginPropertyF ConvertToMarginPropertyF(
     const std::unique_ptr<MarginProperty>& margin, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
+MarginPropertyF ConvertToMarginPropertyF(
+    const CowPtr<MarginProperty>& margin, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
+
 MarginPropertyF ConvertToMarginPropertyF(
     const MarginProperty& margin, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
 BorderWidthPropertyF ConvertToBorderWidthPropertyF(const std::unique_ptr<BorderWidthProperty>& borderWidth,
     const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
+BorderWidthPropertyF ConvertToBorderWidthPropertyF(const CowPtr<BorderWidthProperty>& borderWidth,
+    const ScaleProperty& scaleProperty, float percentReference = -1.0f);
+
 BorderWidthPropertyF ConvertToBorderWidthPropertyF(
     const BorderWidthProperty& borderWidth, const ScaleProperty& scaleProperty, float percentReference = -1.0f);
 
@@ -152,6 +162,9 @@ void CreateChildrenConstraint(SizeF& size, const PaddingPropertyF& padding);
  */
 OptionalSizeF UpdateOptionSizeByCalcLayoutConstraint(const OptionalSize<float>& frameSize,
     const std::unique_ptr<MeasureProperty>& calcLayoutConstraint, const SizeT<float> percentReference);
+
+OptionalSizeF UpdateOptionSizeByCalcLayoutConstraint(const OptionalSize<float>& frameSize,
+    const CowPtr<MeasureProperty>& calcLayoutConstraint, const SizeT<float> percentReference);
 } // namespace OHOS::Ace::NG
 
 #endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PROPERTIES_MEASURE_UTILS_H
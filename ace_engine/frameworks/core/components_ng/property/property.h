@@ -20,6 +20,7 @@
 #include <optional>
 
 #include "base/memory/ace_type.h"
+#include "base/memory/cow_ptr.h"
 #include "base/utils/macros.h"
 #include "base/utils/noncopyable.h"
 
@@ -75,33 +76,35 @@ bool CheckUpdateByChildRequest(PropertyChangeFlag propertyChangeFlag);
 bool CheckNoChanged(PropertyChangeFlag propertyChangeFlag);
 
 // For XXXProperty Class
-#define ACE_DEFINE_PROPERTY_GROUP(group, type)              \
-public:                                                     \
-    const std::unique_ptr<type>& GetOrCreate##group()       \
-    {                                                       \
-        if (!prop##group##_) {                              \
-            prop##group##_ = std::make_unique<type>();      \
-        }                                                   \
-        return prop##group##_;                              \
-    }                                                       \
-    const std::unique_ptr<type>& Get##group() const         \
-    {                                                       \
-        return prop##group##_;                              \
-    }                                                       \
-    std::unique_ptr<type> Clone##group() const              \
-    {                                                       \
-        if (prop##group##_) {                               \
-            return std::make_unique<type>(*prop##group##_); \
-        }                                                   \
-        return nullptr;                                     \
-    }                                                       \
-    void Reset##group()                                     \
-    {                                                       \
-        return prop##group##_.reset();                      \
-    }                                                       \
-                                                            \
-protected:                                                  \
-    std::unique_ptr<type> prop##group##_;
+// Property groups are shared with the clones of the property until they are modified, so a clone taken for the
+// layout or paint wrapper only copies pointers. A group must be modified through GetOrCreate##group, which copies it
+// first if it is shared, so setters compare with the current value before calling it.
+#define ACE_DEFINE_PROPERTY_GROUP(group, type)                  \
+public:                                                         \
+    const CowPtr<type>& GetOrCreate##group()                    \
+    {                                                           \
+        if (!prop##group##_) {                                  \
+            prop##group##_ = CowPtr<type>::Make();              \
+        } else {                                                \
+            prop##group##_.Detach();                            \
+        }                                                       \
+        return prop##group##_;                                  \
+    }                                                           \
+    const CowPtr<type>& Get##group() const                      \
+    {                                                           \
+        return prop##group##_;                                  \
+    }                                                           \
+    CowPtr<type> Clone##group() const                           \
+    {                                                           \
+        return prop##group##_;                                  \
+    }                                                           \
+    void Reset##group()                                         \
+    {                                                           \
+        return prop##group##_.reset();                          \
+    }                                                           \
+                                                                \
+protected:                                                      \
+    CowPtr<type> prop##group##_;
 
 #define ACE_DEFINE_PROPERTY_ITEM_WITH_GROUP_GET(group, name, type) \
 public:                                                            \
@@ -133,9 +136,8 @@ public:                                                            \
     }                                                              \
     void Reset##name()                                             \
     {                                                              \
-        auto& groupProperty = Get##group();                        \
-        if (groupProperty) {                                       \
-            groupProperty->Reset##name();                          \
+        if (prop##group##_ && prop##group##_->Has##name()) {       \
+            prop##group##_.Detach()->Reset##name();                \
         }                                                          \
     }
 
@@ -174,10 +176,10 @@ public:
     ACE_DEFINE_PROPERTY_ITEM_WITH_GROUP_GET(group, name, type)             \
     void Update##name(const type& value)                                   \
     {                                                                      \
-        auto& groupProperty = GetOrCreate##group();                        \
-        if (groupProperty->Check##name(value)) {                           \
+        if (prop##group##_ && prop##group##_->Check##name(value)) {        \
             return;                                                        \
         }                                                                  \
+        auto& groupProperty = GetOrCreate##group();                        \
         groupProperty->Update##name(value);                                \
         UpdatePropertyChangeFlag(changeFlag);                              \
     }
@@ -186,10 +188,10 @@ public:
     ACE_DEFINE_PROPERTY_ITEM_WITH_GROUP_ITEM_GET(group, groupItem, name, type)             \
     void Update##name(const type& value)                                                   \
     {                                                                                      \
-        auto& groupProperty = GetOrCreate##group();                                        \
-        if (groupProperty->Check##groupItem(value)) {                                      \
+        if (prop##group##_ && prop##group##_->Check##groupItem(value)) {                   \
             return;                                                                        \
         }                                                                                  \
+        auto& groupProperty = GetOrCreate##group();                                        \
         groupProperty->Update##groupItem(value);                                           \
         UpdatePropertyChangeFlag(changeFlag);                                              \
     }
@@ -198,25 +200,25 @@ public:
     ACE_DEFINE_PROPERTY_ITEM_WITH_GROUP_GET(group, name, type)                          \
     void Update##name(const type& value)                                                \
     {                                                                                   \
-        auto& groupProperty = GetOrCreate##group();                                     \
-        if (groupProperty->Check##name(value)) {                                        \
+        if (prop##group##_ && prop##group##_->Check##name(value)) {                     \
             return;                                                                     \
         }                                                                               \
+        auto& groupProperty = GetOrCreate##group();                                     \
         groupProperty->Update##name(value);                                             \
         UpdatePropertyChangeFlag(changeFlag);                                           \
         On##name##Update(value);                                                        \
     }
 
-#define ACE_DEFINE_PROPERTY_FUNC_WITH_GROUP(group, name, type)  \
-    ACE_DEFINE_PROPERTY_ITEM_WITH_GROUP_GET(group, name, type)  \
-    void Update##name(const type& value)                        \
-    {                                                           \
-        auto& groupProperty = GetOrCreate##group();             \
-        if (groupProperty->Check##name(value)) {                \
-            return;                                             \
-        }                                                       \
-        groupProperty->Update##name(value);                     \
-        On##name##Update(value);                                \
+#define ACE_DEFINE_PROPERTY_FUNC_WITH_GROUP(group, name, type)      \
+    ACE_DEFINE_PROPERTY_ITEM_WITH_GROUP_GET(group, name, type)      \
+    void Update##name(const type& value)                            \
+    {                                                               \
+        if (prop##group##_ && prop##group##_->Check##name(value)) { \
+            return;                                                 \
+        }                                                           \
+        auto& groupProperty = GetOrCreate##group();                 \
+        groupProperty->Update##name(value);                         \
+        On##name##Update(value);                                    \
     }
 
 #define ACE_DEFINE_PROPERTY_ITEM_WITHOUT_GROUP_GET(name, type)   \
@@ -364,10 +366,21 @@ public:
     void UpdatePropertyChangeFlag(PropertyChangeFlag propertyChangeFlag)
     {
         propertyChangeFlag_ = propertyChangeFlag_ | propertyChangeFlag;
+        if (CheckNeedMeasure(propertyChangeFlag)) {
+            ++measureVersion_;
+        }
+    }
+
+    // increased by every change flagged to remeasure, it is not reset by CleanDirty, so measure results kept with an
+    // older version are out of date.
+    uint32_t GetMeasureVersion() const
+    {
+        return measureVersion_;
     }
 
 protected:
     PropertyChangeFlag propertyChangeFlag_ = PROPERTY_UPDATE_NORMAL;
+    uint32_t measureVersion_ = 0;
 
     ACE_DISALLOW_COPY_AND_MOVE(Property);
 };
@@ -3157,7 +3157,7 @@ void RosenRenderContext::UpdateTransition(const TransitionOptions& options)
 }
 
 std::shared_ptr<Rosen::RSTransitionEffect> RosenRenderContext::GetRSTransitionWithoutType(
-    const std::unique_ptr<TransitionOptions>& options, const SizeF& frameSize)
+    const CowPtr<TransitionOptions>& options, const SizeF& frameSize)
 {
     if (options == nullptr) {
         return nullptr;
@@ -3237,7 +3237,7 @@ void RosenRenderContext::OnSweepGradientUpdate(const NG::Gradient& gradient)
     RequestNextFrame();
 }
 
-void RosenRenderContext::PaintClipShape(const std::unique_ptr<ClipProperty>& clip, const SizeF& frameSize)
+void RosenRenderContext::PaintClipShape(const CowPtr<ClipProperty>& clip, const SizeF& frameSize)
 {
     auto basicShape = clip->GetClipShapeValue();
 #ifndef USE_ROSEN_DRAWING
@@ -3267,7 +3267,7 @@ void RosenRenderContext::PaintClipShape(const std::unique_ptr<ClipProperty>& cli
 #endif
 }
 
-void RosenRenderContext::PaintClipMask(const std::unique_ptr<ClipProperty>& clip, const SizeF& frameSize)
+void RosenRenderContext::PaintClipMask(const CowPtr<ClipProperty>& clip, const SizeF& frameSize)
 {
     auto basicShape = clip->GetClipMaskValue();
 #ifndef USE_ROSEN_DRAWING
@@ -212,7 +212,7 @@ public:
 
     // if translate params use percent dimension, frameSize should be given correctly
     static std::shared_ptr<Rosen::RSTransitionEffect> GetRSTransitionWithoutType(
-        const std::unique_ptr<TransitionOptions>& options, const SizeF& frameSize = SizeF());
+        const CowPtr<TransitionOptions>& options, const SizeF& frameSize = SizeF());
 
     static float ConvertDimensionToScaleBySize(const Dimension& dimension, float size);
 
@@ -416,8 +416,8 @@ private:
     static inline void ConvertRadius(const BorderRadiusProperty& value, Rosen::Vector4f& cornerRadius);
 
     void PaintBackground();
-    void PaintClipShape(const std::unique_ptr<ClipProperty>& clip, const SizeF& frameSize);
-    void PaintClipMask(const std::unique_ptr<ClipProperty>& clip, const SizeF& frameSize);
+    void PaintClipShape(const CowPtr<ClipProperty>& clip, const SizeF& frameSize);
+    void PaintClipMask(const CowPtr<ClipProperty>& clip, const SizeF& frameSize);
     void PaintClip(const SizeF& frameSize);
     void PaintProgressMask();
     void PaintGradient(const SizeF& frameSize);
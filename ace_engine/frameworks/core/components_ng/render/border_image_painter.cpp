@@ -21,7 +21,7 @@ constexpr double EXTRA_OFFSET = 1.0;
 
 namespace OHOS::Ace::NG {
 BorderImagePainter::BorderImagePainter(BorderImageProperty bdImageProps,
-    const std::unique_ptr<BorderWidthProperty>& widthProp, const SizeF& paintSize, const RSImage& image,
+    const CowPtr<BorderWidthProperty>& widthProp, const SizeF& paintSize, const RSImage& image,
     double dipScale)
     : hasWidthProp_(widthProp != nullptr), borderImageProperty_(std::move(bdImageProps)), paintSize_(paintSize),
       image_(image), dipScale_(dipScale)
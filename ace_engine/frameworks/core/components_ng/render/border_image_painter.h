@@ -30,7 +30,7 @@ class BorderImagePainter : public virtual AceType {
     DECLARE_ACE_TYPE(BorderImagePainter, AceType);
 
 public:
-    BorderImagePainter(BorderImageProperty bdImageProps, const std::unique_ptr<BorderWidthProperty>& widthProp,
+    BorderImagePainter(BorderImageProperty bdImageProps, const CowPtr<BorderWidthProperty>& widthProp,
         const SizeF& paintSize, const RSImage& image, double dipScale);
     ~BorderImagePainter() override = default;
     void PaintBorderImage(const OffsetF& offset, RSCanvas& canvas) const;
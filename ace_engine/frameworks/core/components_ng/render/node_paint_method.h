@@ -56,6 +56,13 @@ public:
     virtual void UpdateContentModifier(PaintWrapper* paintWrapper) {}
 
     virtual void UpdateOverlayModifier(PaintWrapper* paintWrapper) {}
+
+    // return BACKGROUND_TASK if the draw functions are created by only reading the paint wrapper, they are then
+    // created in parallel with the others on the background threads.
+    virtual TaskThread CanRunOnWhichThread()
+    {
+        return MAIN_TASK;
+    }
 };
 } // namespace OHOS::Ace::NG
 
@@ -56,6 +56,15 @@ void PaintWrapper::FlushOverlayModifier()
     renderContext->FlushOverlayModifier(overlayModifier);
 }
 
+void PaintWrapper::CreateDrawFunctions()
+{
+    CHECK_NULL_VOID(nodePaintImpl_);
+    contentDraw_ = nodePaintImpl_->GetContentDrawFunction(this);
+    foregroundDraw_ = nodePaintImpl_->GetForegroundDrawFunction(this);
+    overlayDraw_ = nodePaintImpl_->GetOverlayDrawFunction(this);
+    isDrawFunctionsCreated_ = true;
+}
+
 void PaintWrapper::FlushRender()
 {
     CHECK_NULL_VOID(nodePaintImpl_);
@@ -75,22 +84,23 @@ void PaintWrapper::FlushRender()
 
     renderContext->StartRecording();
 
+    if (!isDrawFunctionsCreated_) {
+        CreateDrawFunctions();
+    }
+
     // first set content paint function.
-    auto contentDraw = nodePaintImpl_->GetContentDrawFunction(this);
-    if (contentDraw && !contentModifier) {
-        renderContext->FlushContentDrawFunction(std::move(contentDraw));
+    if (contentDraw_ && !contentModifier) {
+        renderContext->FlushContentDrawFunction(std::move(contentDraw_));
     }
 
     // then set foreground paint function.
-    auto foregroundDraw = nodePaintImpl_->GetForegroundDrawFunction(this);
-    if (foregroundDraw) {
-        renderContext->FlushForegroundDrawFunction(std::move(foregroundDraw));
+    if (foregroundDraw_) {
+        renderContext->FlushForegroundDrawFunction(std::move(foregroundDraw_));
     }
 
     // at last, set overlay paint function.
-    auto overlayDraw = nodePaintImpl_->GetOverlayDrawFunction(this);
-    if (overlayDraw && !overlayModifier) {
-        renderContext->FlushOverlayDrawFunction(std::move(overlayDraw));
+    if (overlayDraw_ && !overlayModifier) {
+        renderContext->FlushOverlayDrawFunction(std::move(overlayDraw_));
     }
 
     if (renderContext->GetAccessibilityFocus().value_or(false)) {
@@ -22,6 +22,7 @@
 #include "base/geometry/ng/offset_t.h"
 #include "base/geometry/ng/size_t.h"
 #include "base/memory/ace_type.h"
+#include "base/memory/frame_arena.h"
 #include "base/memory/referenced.h"
 #include "base/thread/cancelable_callback.h"
 #include "core/components_ng/base/geometry_node.h"
@@ -32,8 +33,8 @@
 namespace OHOS::Ace::NG {
 class NodePaintMethod;
 
-// PaintWrapper are used to flush dirty render task.
-class PaintWrapper : public virtual AceType {
+// PaintWrapper are used to flush dirty render task, they are released with the task in the frame.
+class PaintWrapper : public virtual AceType, public FrameArenaObject {
     DECLARE_ACE_TYPE(PaintWrapper, AceType)
 
 public:
@@ -48,6 +49,10 @@ public:
         taskThread_ = taskThread;
     }
 
+    // Creates the draw functions of the paint method ahead of FlushRender, it runs on a background thread if the
+    // paint method can run there.
+    void CreateDrawFunctions();
+
     void FlushRender();
 
     TaskThread CanRunOnWhichThread() const
@@ -111,6 +116,10 @@ private:
     RefPtr<PaintProperty> paintProperty_;
     RefPtr<NodePaintMethod> nodePaintImpl_;
     TaskThread taskThread_ = MAIN_TASK;
+    bool isDrawFunctionsCreated_ = false;
+    CanvasDrawFunction contentDraw_;
+    CanvasDrawFunction foregroundDraw_;
+    CanvasDrawFunction overlayDraw_;
 };
 } // namespace OHOS::Ace::NG
 
@@ -413,6 +413,21 @@ public:
         }
     }
 
+    // drops the items built ahead in idle time, they are built again when needed.
+    void ClearExpiringItems()
+    {
+        for (auto iter = cachedItems_.begin(); iter != cachedItems_.end();) {
+            if (!iter->second.second && expiringItem_.find(iter->second.first) != expiringItem_.end()) {
+                iter = cachedItems_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+        ClearAllOffscreenNode();
+        expiringItem_.clear();
+        preBuildingIndex_ = -1;
+    }
+
     void ClearAllOffscreenNode()
     {
         for (auto& [key, node] : expiringItem_) {
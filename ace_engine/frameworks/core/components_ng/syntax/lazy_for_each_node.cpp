@@ -71,6 +71,22 @@ void LazyForEachNode::BuildAllChildren()
     }
 }
 
+void LazyForEachNode::OnVisibleChange(bool isVisible)
+{
+    UINode::OnVisibleChange(isVisible);
+    if (isVisible_ == isVisible) {
+        return;
+    }
+    isVisible_ = isVisible;
+    CHECK_NULL_VOID(builder_);
+    if (!isVisible) {
+        // items built ahead are released while hidden, such as on a background page.
+        builder_->ClearExpiringItems();
+        return;
+    }
+    PostIdleTask();
+}
+
 void LazyForEachNode::PostIdleTask()
 {
     if (needPredict_) {
@@ -84,6 +100,9 @@ void LazyForEachNode::PostIdleTask()
         auto node = weak.Upgrade();
         CHECK_NULL_VOID(node);
         node->needPredict_ = false;
+        if (!node->isVisible_) {
+            return;
+        }
         auto canRunLongPredictTask = node->requestLongPredict_ && canUseLongPredictTask;
         if (node->builder_) {
             node->GetChildren();
@@ -98,6 +98,7 @@ public:
     }
     void PostIdleTask();
     void MarkNeedSyncRenderTree(bool needRebuild = false) override;
+    void OnVisibleChange(bool isVisible) override;
 
     void BuildAllChildren();
     RefPtr<UINode> GetFrameChildByIndex(uint32_t index, bool needBuild) override;
@@ -151,6 +152,7 @@ private:
     bool requestLongPredict_ = false;
     bool isRegisterListener_ = false;
     bool isLoop_ = false;
+    bool isVisible_ = true;
 
     mutable std::list<RefPtr<UINode>> children_;
     mutable bool needPredict_ = false;
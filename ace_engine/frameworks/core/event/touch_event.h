@@ -65,6 +65,19 @@ struct TouchPoint final {
     bool isPressed = false;
 };
 
+/**
+ * @brief TouchSample keeps only the coordinates and time stamp of a touch point, it is used to store and resample
+ * touch history without copying the pointers, history and pointer event of a TouchEvent.
+ */
+struct TouchSample final {
+    float x = 0.0f;
+    float y = 0.0f;
+    float screenX = 0.0f;
+    float screenY = 0.0f;
+    // nanosecond time stamp.
+    uint64_t time = 0;
+};
+
 /**
  * @brief TouchEvent contains the active change point and a list of all touch points.
  */
@@ -98,6 +111,9 @@ struct TouchEvent final {
     std::vector<uint8_t> enhanceData;
     // historical points
     std::vector<TouchEvent> history;
+    // offset from (x, y) to the position extrapolated to the present time of the current frame, only set for
+    // moves when the pipeline is able to predict the pointer.
+    std::optional<Offset> predictedOffset;
 
     void ToJsonValue(std::unique_ptr<JsonValue>& json) const
     {
@@ -173,6 +189,11 @@ struct TouchEvent final {
         currentSysTime = currentTime;
     }
 
+    TouchSample ToSample() const
+    {
+        return { x, y, screenX, screenY, static_cast<uint64_t>(time.time_since_epoch().count()) };
+    }
+
     TouchEvent CreateScalePoint(float scale) const
     {
         if (NearZero(scale)) {
@@ -204,7 +225,7 @@ struct TouchEvent final {
             });
             return { pointId, x - offsetX, y - offsetY, screenX - offsetX, screenY - offsetY, type, pullType, time,
                 size, force, tiltX, tiltY, deviceId, targetDisplayId, sourceType, sourceTool, isInterpolated,
-                currentSysTime, temp, pointerEvent, enhanceData };
+                currentSysTime, temp, pointerEvent, enhanceData, {}, predictedOffset };
         }
 
         std::for_each(temp.begin(), temp.end(), [scale, offsetX, offsetY](auto&& point) {
@@ -215,7 +236,8 @@ struct TouchEvent final {
         });
         return { pointId, (x - offsetX) / scale, (y - offsetY) / scale, (screenX - offsetX) / scale,
             (screenY - offsetY) / scale, type, pullType, time, size, force, tiltX, tiltY, deviceId, targetDisplayId,
-            sourceType, sourceTool, isInterpolated, currentSysTime, temp, pointerEvent, enhanceData };
+            sourceType, sourceTool, isInterpolated, currentSysTime, temp, pointerEvent, enhanceData, {},
+            predictedOffset ? std::make_optional(predictedOffset.value() / scale) : std::nullopt };
     }
 
     TouchEvent UpdatePointers() const
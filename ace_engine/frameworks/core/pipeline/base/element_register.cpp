@@ -45,8 +45,8 @@ RefPtr<Element> ElementRegister::GetElementById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto position = itemMap_.find(elementId);
-    return position == itemMap_.end() ? nullptr : AceType::DynamicCast<Element>(position->second).Upgrade();
+    auto item = itemMap_.Find(elementId);
+    return item == nullptr ? nullptr : AceType::DynamicCast<Element>(*item).Upgrade();
 }
 
 RefPtr<AceType> ElementRegister::GetNodeById(ElementIdType elementId)
@@ -54,19 +54,19 @@ RefPtr<AceType> ElementRegister::GetNodeById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto position = itemMap_.find(elementId);
-    return position == itemMap_.end() ? nullptr : position->second.Upgrade();
+    auto item = itemMap_.Find(elementId);
+    return item == nullptr ? nullptr : item->Upgrade();
 }
 
 RefPtr<V2::ElementProxy> ElementRegister::GetElementProxyById(ElementIdType elementId)
 {
-    auto position = itemMap_.find(elementId);
-    return (position == itemMap_.end()) ? nullptr : AceType::DynamicCast<V2::ElementProxy>(position->second).Upgrade();
+    auto item = itemMap_.Find(elementId);
+    return (item == nullptr) ? nullptr : AceType::DynamicCast<V2::ElementProxy>(*item).Upgrade();
 }
 
 bool ElementRegister::Exists(ElementIdType elementId)
 {
-    return (itemMap_.find(elementId) != itemMap_.end());
+    return itemMap_.Contains(elementId);
 }
 
 void ElementRegister::UpdateRecycleElmtId(int32_t oldElmtId, int32_t newElmtId)
@@ -76,18 +76,18 @@ void ElementRegister::UpdateRecycleElmtId(int32_t oldElmtId, int32_t newElmtId)
     }
     auto node = GetNodeById(oldElmtId);
     if (node) {
-        itemMap_.erase(oldElmtId);
+        itemMap_.Erase(oldElmtId);
         AddReferenced(newElmtId, node);
     }
 }
 
 bool ElementRegister::AddReferenced(ElementIdType elmtId, const WeakPtr<AceType>& referenced)
 {
-    auto result = itemMap_.emplace(elmtId, referenced);
-    if (!result.second) {
+    auto result = itemMap_.Emplace(elmtId, referenced);
+    if (!result) {
         LOGE("Duplicate elmtId %{public}d error.", elmtId);
     }
-    return result.second;
+    return result;
 }
 
 bool ElementRegister::AddElement(const RefPtr<Element>& element)
@@ -120,8 +120,8 @@ RefPtr<NG::UINode> ElementRegister::GetUINodeById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto iter = itemMap_.find(elementId);
-    return iter == itemMap_.end() ? nullptr : AceType::DynamicCast<NG::UINode>(iter->second).Upgrade();
+    auto item = itemMap_.Find(elementId);
+    return item == nullptr ? nullptr : AceType::DynamicCast<NG::UINode>(*item).Upgrade();
 }
 
 bool ElementRegister::AddUINode(const RefPtr<NG::UINode>& node)
@@ -134,13 +134,18 @@ bool ElementRegister::AddUINode(const RefPtr<NG::UINode>& node)
 }
 
 bool ElementRegister::RemoveItem(ElementIdType elementId, const std::string& tag)
+{
+    return RemoveItem(elementId, TagRegistry::GetInstance().Intern(tag));
+}
+
+bool ElementRegister::RemoveItem(ElementIdType elementId, uint32_t tagId)
 {
     if (elementId == ElementRegister::UndefinedElementId) {
         return false;
     }
-    auto removed = itemMap_.erase(elementId);
+    auto removed = itemMap_.Erase(elementId);
     if (removed) {
-        removedItems_.insert(std::pair(elementId, tag));
+        removedItems_.push_back({ elementId, tagId });
     }
     return removed;
 }
@@ -151,19 +156,18 @@ bool ElementRegister::RemoveItemSilently(ElementIdType elementId)
         return false;
     }
 
-    auto removed = itemMap_.erase(elementId);
-    return removed;
+    return itemMap_.Erase(elementId);
 }
 
 void ElementRegister::MoveRemovedItems(RemovedElementsType& removedItems)
 {
-    removedItems = removedItems_;
+    removedItems.swap(removedItems_);
     removedItems_.clear();
 }
 
 void ElementRegister::Clear()
 {
-    itemMap_.clear();
+    itemMap_.Clear();
     removedItems_.clear();
     geometryTransitionMap_.clear();
     pendingRemoveNodes_.clear();
@@ -21,9 +21,13 @@
 #include <unordered_set>
 #include <list>
 #include <functional>
+#include <string>
+#include <vector>
 #include "base/memory/referenced.h"
+#include "base/utils/tag_registry.h"
 #include "frameworks/base/memory/ace_type.h"
 #include "frameworks/core/components_ng/animation/geometry_transition.h"
+#include "frameworks/core/pipeline/base/element_slot_map.h"
 
 namespace OHOS::Ace::V2 {
 class ElementProxy;
@@ -35,21 +39,17 @@ class FrameNode;
 } // namespace OHOS::Ace::NG
 
 namespace OHOS::Ace {
-using ElementIdType = int32_t;
 class Element;
 
-
-// removed_items is a Set of elmtId and UINode TAG
-// The TAG aims easier analysis for DFX and debug
-// This std::pair needs a custom has function
-struct deleted_element_hash {
-    inline std::size_t operator()(const std::pair<ElementIdType, std::string>& v) const
-    {
-        return v.first;
-    }
+// removed_items is a list of elmtId and UINode TAG
+// The TAG aims easier analysis for DFX and debug, it is kept as the id interned in TagRegistry to avoid a string copy
+// per removal, use GetRemovedTag to get its name.
+struct RemovedElement {
+    ElementIdType elmtId = -1;
+    uint32_t tagId = 0;
 };
 
-using RemovedElementsType = std::unordered_set<std::pair<ElementIdType, std::string>, deleted_element_hash>;
+using RemovedElementsType = std::vector<RemovedElement>;
 
 class ACE_EXPORT ElementRegister {
 public:
@@ -90,6 +90,7 @@ public:
      * method adds the elmtId to the removed Element Set
      */
     bool RemoveItem(ElementIdType elementId, const std::string& tag = std::string("undefined TAG"));
+    bool RemoveItem(ElementIdType elementId, uint32_t tagId);
 
     /**
      * remove Element with given elmtId from the Map
@@ -102,6 +103,11 @@ public:
 
     void MoveRemovedItems(RemovedElementsType& removedItems);
 
+    const std::string& GetRemovedTag(uint32_t tagId) const
+    {
+        return TagRegistry::GetInstance().GetTag(tagId);
+    }
+
     /**
      * does a complete reset
      * clears the Map of Elements and Set of removed Elements
@@ -148,7 +154,7 @@ private:
     ElementIdType nextUniqueElementId_ = 0;
 
     // Map for created elements
-    std::unordered_map<ElementIdType, WeakPtr<AceType>> itemMap_;
+    ElementSlotMap itemMap_;
 
     RemovedElementsType removedItems_;
 
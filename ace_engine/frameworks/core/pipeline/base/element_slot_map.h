@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_ELEMENT_SLOT_MAP_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_ELEMENT_SLOT_MAP_H
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "base/memory/ace_type.h"
+#include "base/memory/referenced.h"
+
+namespace OHOS::Ace {
+using ElementIdType = int32_t;
+
+/**
+ * ElementSlotMap stores the registered items by elmtId. Element ids are handed out in increasing order by
+ * ElementRegister::MakeUniqueId, so they are kept in fixed size pages indexed directly by the id instead of being
+ * hashed. A page is released once all of its ids have been used and removed. Ids out of the dense range (negative or
+ * very large ids set explicitly) fall back to a hash map.
+ */
+class ElementSlotMap final {
+public:
+    ElementSlotMap() = default;
+    ~ElementSlotMap() = default;
+
+    /**
+     * return the item registered with elmtId, nullptr if there is none.
+     */
+    const WeakPtr<AceType>* Find(ElementIdType elmtId) const
+    {
+        if (!IsDense(elmtId)) {
+            auto iter = sparseItems_.find(elmtId);
+            return iter == sparseItems_.end() ? nullptr : &iter->second;
+        }
+        auto pageIndex = static_cast<size_t>(elmtId) / PAGE_SIZE;
+        if (pageIndex >= pages_.size() || !pages_[pageIndex]) {
+            return nullptr;
+        }
+        const auto& page = *pages_[pageIndex];
+        auto slot = static_cast<size_t>(elmtId) % PAGE_SIZE;
+        return page.used.test(slot) ? &page.items[slot] : nullptr;
+    }
+
+    bool Contains(ElementIdType elmtId) const
+    {
+        return Find(elmtId) != nullptr;
+    }
+
+    /**
+     * register item with elmtId, return false and keep the current item if elmtId is already registered.
+     */
+    bool Emplace(ElementIdType elmtId, const WeakPtr<AceType>& item)
+    {
+        if (!IsDense(elmtId)) {
+            auto result = sparseItems_.emplace(elmtId, item);
+            size_ += result.second ? 1 : 0;
+            return result.second;
+        }
+        auto& page = GetOrCreatePage(static_cast<size_t>(elmtId) / PAGE_SIZE);
+        auto slot = static_cast<size_t>(elmtId) % PAGE_SIZE;
+        if (page.used.test(slot)) {
+            return false;
+        }
+        page.used.set(slot);
+        page.items[slot] = item;
+        ++page.count;
+        ++size_;
+        maxDenseId_ = std::max(maxDenseId_, elmtId);
+        return true;
+    }
+
+    bool Erase(ElementIdType elmtId)
+    {
+        if (!IsDense(elmtId)) {
+            auto removed = sparseItems_.erase(elmtId);
+            size_ -= removed;
+            return removed > 0;
+        }
+        auto pageIndex = static_cast<size_t>(elmtId) / PAGE_SIZE;
+        if (pageIndex >= pages_.size() || !pages_[pageIndex]) {
+            return false;
+        }
+        auto& page = *pages_[pageIndex];
+        auto slot = static_cast<size_t>(elmtId) % PAGE_SIZE;
+        if (!page.used.test(slot)) {
+            return false;
+        }
+        page.used.reset(slot);
+        page.items[slot].Reset();
+        --page.count;
+        --size_;
+        // ids of the page below the highest registered one will not be handed out again.
+        if (page.count == 0 && pageIndex < static_cast<size_t>(maxDenseId_) / PAGE_SIZE) {
+            pages_[pageIndex].reset();
+        }
+        return true;
+    }
+
+    void Clear()
+    {
+        pages_.clear();
+        sparseItems_.clear();
+        size_ = 0;
+        maxDenseId_ = 0;
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+private:
+    static constexpr size_t PAGE_SIZE = 1024;
+    // ids up to 64M are kept in pages, the page table then takes at most 512KB.
+    static constexpr ElementIdType MAX_DENSE_ID = 1 << 26;
+
+    struct Page {
+        std::array<WeakPtr<AceType>, PAGE_SIZE> items;
+        std::bitset<PAGE_SIZE> used;
+        size_t count = 0;
+    };
+
+    static bool IsDense(ElementIdType elmtId)
+    {
+        return elmtId >= 0 && elmtId < MAX_DENSE_ID;
+    }
+
+    Page& GetOrCreatePage(size_t pageIndex)
+    {
+        if (pageIndex >= pages_.size()) {
+            pages_.resize(pageIndex + 1);
+        }
+        if (!pages_[pageIndex]) {
+            pages_[pageIndex] = std::make_unique<Page>();
+        }
+        return *pages_[pageIndex];
+    }
+
+    std::vector<std::unique_ptr<Page>> pages_;
+    std::unordered_map<ElementIdType, WeakPtr<AceType>> sparseItems_;
+    size_t size_ = 0;
+    ElementIdType maxDenseId_ = 0;
+};
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_BASE_ELEMENT_SLOT_MAP_H
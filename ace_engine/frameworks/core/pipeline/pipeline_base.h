@@ -32,6 +32,7 @@
 #include "base/resource/shared_image_manager.h"
 #include "base/thread/task_executor.h"
 #include "core/accessibility/accessibility_manager.h"
+#include "core/animation/batch_animation_engine.h"
 #include "core/animation/schedule_task.h"
 #include "core/common/clipboard/clipboard_proxy.h"
 #include "core/common/display_info.h"
@@ -731,6 +732,14 @@ public:
         return eventManager_;
     }
 
+    const RefPtr<BatchAnimationEngine>& GetBatchAnimationEngine()
+    {
+        if (!batchAnimationEngine_) {
+            batchAnimationEngine_ = AceType::MakeRefPtr<BatchAnimationEngine>(WeakClaim(this));
+        }
+        return batchAnimationEngine_;
+    }
+
     const RefPtr<WindowManager>& GetWindowManager() const
     {
         return windowManager_;
@@ -1155,6 +1164,7 @@ protected:
     WeakPtr<Frontend> weakFrontend_;
     int32_t instanceId_ = 0;
     RefPtr<EventManager> eventManager_;
+    RefPtr<BatchAnimationEngine> batchAnimationEngine_;
     RefPtr<ImageCache> imageCache_;
     RefPtr<SharedImageManager> sharedImageManager_;
     mutable std::shared_mutex imageMtx_;
@@ -16,7 +16,9 @@
 #include "core/pipeline_ng/pipeline_context.h"
 
 #include <algorithm>
+#include <array>
 #include <cinttypes>
+#include <cmath>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -86,6 +88,18 @@ constexpr int32_t INDEX_X = 0;
 constexpr int32_t INDEX_Y = 1;
 constexpr int32_t INDEX_TIME = 2;
 constexpr int32_t TIME_THRESHOLD = 2 * 1000000; // 3 millisecond
+constexpr size_t PREDICT_MIN_SAMPLES = 3;
+constexpr size_t PREDICT_QUADRATIC_MIN_SAMPLES = 4;
+constexpr size_t PREDICT_MAX_SAMPLES = 8;
+constexpr size_t PREDICT_ORDER = 3;
+constexpr size_t PREDICT_MOMENT_COUNT = 2 * PREDICT_ORDER - 1;
+constexpr uint64_t PREDICT_WINDOW = 50 * 1000 * 1000;  // 50ms
+constexpr double PREDICT_MAX_HORIZON = 20.0;           // ms
+constexpr double PREDICT_MAX_DISTANCE = 64.0;          // px
+constexpr double PREDICT_MIN_VELOCITY = 0.05;          // px per ms
+constexpr double PREDICT_RESIDUAL_TOLERANCE = 1.0;     // px
+constexpr double PREDICT_MIN_CONFIDENCE = 0.2;
+constexpr double PREDICT_DET_EPSILON = 1e-9;
 constexpr int32_t PLATFORM_VERSION_TEN = 10;
 constexpr int32_t USED_ID_FIND_FLAG = 3;                 // if args >3 , it means use id to find
 constexpr int32_t MILLISECONDS_TO_NANOSECONDS = 1000000; // Milliseconds to nanoseconds
@@ -278,16 +292,38 @@ std::pair<float, float> PipelineContext::LinearInterpolation(const std::tuple<fl
     return std::make_pair(0.0f, 0.0f);
 }
 
+PipelineContext::TouchSampleTrack PipelineContext::MakeTouchSampleTrack(
+    const std::vector<TouchEvent>& history, const std::vector<TouchEvent>& current)
+{
+    TouchSampleTrack track;
+    track.samples.reserve(history.size() + current.size());
+    for (const auto& event : history) {
+        track.samples.emplace_back(event.ToSample());
+    }
+    track.historySize = track.samples.size();
+    for (const auto& event : current) {
+        track.samples.emplace_back(event.ToSample());
+    }
+    return track;
+}
+
 std::tuple<float, float, uint64_t> PipelineContext::GetAvgPoint(
     const std::vector<TouchEvent>& events, const bool isScreen)
+{
+    auto track = MakeTouchSampleTrack({}, events);
+    return GetAvgPoint(track.samples.data(), track.samples.data() + track.samples.size(), isScreen);
+}
+
+std::tuple<float, float, uint64_t> PipelineContext::GetAvgPoint(
+    const TouchSample* begin, const TouchSample* end, const bool isScreen)
 {
     float avgX = 0.0f;
     float avgY = 0.0f;
     uint64_t avgTime = 0;
     int32_t i = 0;
     uint64_t lastTime = 0;
-    for (auto iter = events.begin(); iter != events.end(); iter++) {
-        if (lastTime == 0 || static_cast<uint64_t>(iter->time.time_since_epoch().count()) != lastTime) {
+    for (auto iter = begin; iter != end; iter++) {
+        if (lastTime == 0 || iter->time != lastTime) {
             if (!isScreen) {
                 avgX += iter->x;
                 avgY += iter->y;
@@ -295,9 +331,9 @@ std::tuple<float, float, uint64_t> PipelineContext::GetAvgPoint(
                 avgX += iter->screenX;
                 avgY += iter->screenY;
             }
-            avgTime += static_cast<uint64_t>(iter->time.time_since_epoch().count());
+            avgTime += iter->time;
             i++;
-            lastTime = static_cast<uint64_t>(iter->time.time_since_epoch().count());
+            lastTime = iter->time;
         }
     }
     avgX /= i;
@@ -309,23 +345,30 @@ std::tuple<float, float, uint64_t> PipelineContext::GetAvgPoint(
 std::pair<float, float> PipelineContext::GetResampleCoord(const std::vector<TouchEvent>& history,
     const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp, const bool isScreen)
 {
-    if (history.empty() || current.empty()) {
+    return GetResampleCoord(MakeTouchSampleTrack(history, current), nanoTimeStamp, isScreen);
+}
+
+std::pair<float, float> PipelineContext::GetResampleCoord(
+    const TouchSampleTrack& track, const uint64_t nanoTimeStamp, const bool isScreen)
+{
+    if (track.historySize == 0 || track.historySize >= track.samples.size()) {
         return std::make_pair(0.0f, 0.0f);
     }
-    auto historyPoint = GetAvgPoint(history, isScreen);
-    auto currentPoint = GetAvgPoint(current, isScreen);
+    const auto* historyBegin = track.samples.data();
+    const auto* currentBegin = historyBegin + track.historySize;
+    const auto* currentEnd = historyBegin + track.samples.size();
+    auto historyPoint = GetAvgPoint(historyBegin, currentBegin, isScreen);
+    auto currentPoint = GetAvgPoint(currentBegin, currentEnd, isScreen);
 
     if (SystemProperties::GetDebugEnabled()) {
         LOGI("input time is %{public}" PRIu64 "", nanoTimeStamp);
-        for (auto iter : history) {
-            LOGI("history point x %{public}f, y %{public}f, time %{public}" PRIu64 "", iter.x, iter.y,
-                static_cast<uint64_t>(iter.time.time_since_epoch().count()));
+        for (auto iter = historyBegin; iter != currentBegin; ++iter) {
+            LOGI("history point x %{public}f, y %{public}f, time %{public}" PRIu64 "", iter->x, iter->y, iter->time);
         }
         LOGI("historyAvgPoint is x %{public}f, y %{public}f, time %{public}" PRIu64 "", std::get<INDEX_X>(historyPoint),
             std::get<INDEX_Y>(historyPoint), std::get<INDEX_TIME>(historyPoint));
-        for (auto iter : current) {
-            LOGI("current point x %{public}f, y %{public}f, time %{public}" PRIu64 "", iter.x, iter.y,
-                static_cast<uint64_t>(iter.time.time_since_epoch().count()));
+        for (auto iter = currentBegin; iter != currentEnd; ++iter) {
+            LOGI("current point x %{public}f, y %{public}f, time %{public}" PRIu64 "", iter->x, iter->y, iter->time);
         }
         LOGI("currentAvgPoint is x %{public}f, y %{public}f, time %{public}" PRIu64 "", std::get<INDEX_X>(currentPoint),
             std::get<INDEX_Y>(currentPoint), std::get<INDEX_TIME>(currentPoint));
@@ -336,8 +379,14 @@ std::pair<float, float> PipelineContext::GetResampleCoord(const std::vector<Touc
 TouchEvent PipelineContext::GetResampleTouchEvent(
     const std::vector<TouchEvent>& history, const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp)
 {
-    auto newXy = GetResampleCoord(history, current, nanoTimeStamp, false);
-    auto newScreenXy = GetResampleCoord(history, current, nanoTimeStamp, true);
+    return GetResampleTouchEvent(MakeTouchSampleTrack(history, current), current, nanoTimeStamp);
+}
+
+TouchEvent PipelineContext::GetResampleTouchEvent(
+    const TouchSampleTrack& track, const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp)
+{
+    auto newXy = GetResampleCoord(track, nanoTimeStamp, false);
+    auto newScreenXy = GetResampleCoord(track, nanoTimeStamp, true);
     TouchEvent newTouchEvent = GetLatestPoint(current, nanoTimeStamp);
     if (newXy.first != 0 && newXy.second != 0) {
         newTouchEvent.x = newXy.first;
@@ -357,6 +406,118 @@ TouchEvent PipelineContext::GetResampleTouchEvent(
     return newTouchEvent;
 }
 
+std::optional<Offset> PipelineContext::GetPredictedOffset(const TouchSampleTrack& track, const uint64_t nanoTimeStamp)
+{
+    if (track.samples.size() < PREDICT_MIN_SAMPLES) {
+        return std::nullopt;
+    }
+    const auto& latest = track.samples.back();
+    if (nanoTimeStamp <= latest.time) {
+        return std::nullopt;
+    }
+    // the latest samples relative to the latest one, time in ms.
+    std::array<double, PREDICT_MAX_SAMPLES> times {};
+    std::array<double, PREDICT_MAX_SAMPLES> offsetsX {};
+    std::array<double, PREDICT_MAX_SAMPLES> offsetsY {};
+    size_t count = 0;
+    for (auto iter = track.samples.rbegin(); iter != track.samples.rend() && count < PREDICT_MAX_SAMPLES; ++iter) {
+        if (latest.time < iter->time || latest.time - iter->time > PREDICT_WINDOW) {
+            break;
+        }
+        double time = -static_cast<double>(latest.time - iter->time) / ONE_MS_IN_NS;
+        if (count > 0 && NearEqual(time, times[count - 1])) {
+            continue;
+        }
+        times[count] = time;
+        offsetsX[count] = iter->x - latest.x;
+        offsetsY[count] = iter->y - latest.y;
+        ++count;
+    }
+    if (count < PREDICT_MIN_SAMPLES) {
+        return std::nullopt;
+    }
+
+    // least squares fit of d(t) = c0 + c1 * t + c2 * t^2 on each axis, by the normal equations.
+    std::array<double, PREDICT_MOMENT_COUNT> sumT {};
+    std::array<double, PREDICT_ORDER> sumX {};
+    std::array<double, PREDICT_ORDER> sumY {};
+    for (size_t index = 0; index < count; ++index) {
+        double power = 1.0;
+        for (size_t i = 0; i < PREDICT_MOMENT_COUNT; ++i) {
+            sumT[i] += power;
+            if (i < PREDICT_ORDER) {
+                sumX[i] += offsetsX[index] * power;
+                sumY[i] += offsetsY[index] * power;
+            }
+            power *= times[index];
+        }
+    }
+    auto det3 = [](double a, double b, double c, double d, double e, double f, double g, double h, double i) {
+        return a * (e * i - f * h) - b * (d * i - f * g) + c * (d * h - e * g);
+    };
+    std::array<double, PREDICT_ORDER> coefX {};
+    std::array<double, PREDICT_ORDER> coefY {};
+    double det = det3(sumT[0], sumT[1], sumT[2], sumT[1], sumT[2], sumT[3], sumT[2], sumT[3], sumT[4]);
+    if (count >= PREDICT_QUADRATIC_MIN_SAMPLES && std::abs(det) > PREDICT_DET_EPSILON) {
+        auto solve = [&sumT, &det3, det](const std::array<double, PREDICT_ORDER>& sum,
+                         std::array<double, PREDICT_ORDER>& coef) {
+            coef[0] = det3(sum[0], sumT[1], sumT[2], sum[1], sumT[2], sumT[3], sum[2], sumT[3], sumT[4]) / det;
+            coef[1] = det3(sumT[0], sum[0], sumT[2], sumT[1], sum[1], sumT[3], sumT[2], sum[2], sumT[4]) / det;
+            coef[2] = det3(sumT[0], sumT[1], sum[0], sumT[1], sumT[2], sum[1], sumT[2], sumT[3], sum[2]) / det;
+        };
+        solve(sumX, coefX);
+        solve(sumY, coefY);
+    } else {
+        // too few samples to tell the acceleration, fit a line.
+        double linearDet = sumT[0] * sumT[2] - sumT[1] * sumT[1];
+        if (std::abs(linearDet) <= PREDICT_DET_EPSILON) {
+            return std::nullopt;
+        }
+        coefX[1] = (sumT[0] * sumX[1] - sumT[1] * sumX[0]) / linearDet;
+        coefY[1] = (sumT[0] * sumY[1] - sumT[1] * sumY[0]) / linearDet;
+        coefX[0] = (sumX[0] - coefX[1] * sumT[1]) / sumT[0];
+        coefY[0] = (sumY[0] - coefY[1] * sumT[1]) / sumT[0];
+    }
+
+    // the residual of the fit tells how well the model follows the pointer, a jittering pointer is predicted less.
+    double residual = 0.0;
+    for (size_t index = 0; index < count; ++index) {
+        double time = times[index];
+        double errX = offsetsX[index] - (coefX[0] + coefX[1] * time + coefX[2] * time * time);
+        double errY = offsetsY[index] - (coefY[0] + coefY[1] * time + coefY[2] * time * time);
+        residual += errX * errX + errY * errY;
+    }
+    double confidence = 1.0 / (1.0 + std::sqrt(residual / count) / PREDICT_RESIDUAL_TOLERANCE);
+    if (confidence < PREDICT_MIN_CONFIDENCE) {
+        return std::nullopt;
+    }
+
+    double horizon = std::min(static_cast<double>(nanoTimeStamp - latest.time) / ONE_MS_IN_NS, PREDICT_MAX_HORIZON);
+    // c1 is the velocity at the latest sample and 2 * c2 the acceleration, a decelerating pointer is extrapolated to
+    // where it stops at most and never turns back by prediction.
+    auto extrapolate = [horizon](double velocity, double halfAcceleration) {
+        if (std::abs(velocity) < PREDICT_MIN_VELOCITY) {
+            return 0.0;
+        }
+        double time = horizon;
+        if (velocity * halfAcceleration < 0.0) {
+            time = std::min(time, -velocity / (2.0 * halfAcceleration));
+        }
+        return velocity * time + halfAcceleration * time * time;
+    };
+    double dx = extrapolate(coefX[1], coefX[2]) * confidence;
+    double dy = extrapolate(coefY[1], coefY[2]) * confidence;
+    double distance = std::sqrt(dx * dx + dy * dy);
+    if (NearZero(distance)) {
+        return std::nullopt;
+    }
+    if (distance > PREDICT_MAX_DISTANCE) {
+        dx *= PREDICT_MAX_DISTANCE / distance;
+        dy *= PREDICT_MAX_DISTANCE / distance;
+    }
+    return Offset(dx, dy);
+}
+
 TouchEvent PipelineContext::GetLatestPoint(const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp)
 {
     TouchEvent result;
@@ -479,6 +640,7 @@ void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
     window_->RecordFrameTime(nanoTimestamp, abilityName);
     FlushFrameTrace();
     resampleTimeStamp_ = nanoTimestamp - window_->GetVSyncPeriod() + ONE_MS_IN_NS;
+    predictTimeStamp_ = nanoTimestamp + window_->GetVSyncPeriod();
 #ifdef UICAST_COMPONENT_SUPPORTED
     do {
         auto container = Container::Current();
@@ -522,6 +684,8 @@ void PipelineContext::FlushVsync(uint64_t nanoTimestamp, uint32_t frameCount)
 #endif
 
     if (hasRunningAnimation || window_->HasUIAnimation()) {
+        // animated transforms move nodes without marking them, keep checking while animations run.
+        visibleAreaDirty_ = true;
         RequestFrame();
     }
     window_->FlushModifier();
@@ -1533,8 +1697,8 @@ void PipelineContext::OnTouchEvent(const TouchEvent& point, const RefPtr<FrameNo
             scalePoint.id, scalePoint.x, scalePoint.y, (int)scalePoint.type);
     }
     eventManager_->SetInstanceId(GetInstanceId());
-    if (scalePoint.type != TouchType::MOVE && historyPointsById_.find(scalePoint.id) != historyPointsById_.end()) {
-        historyPointsById_.erase(scalePoint.id);
+    if (scalePoint.type != TouchType::MOVE) {
+        touchSampleTracks_.erase(scalePoint.id);
     }
     if (scalePoint.type == TouchType::DOWN) {
         // Set focus state inactive while touch down event received
@@ -1752,6 +1916,10 @@ bool PipelineContext::OnDumpInfo(const std::vector<std::string>& params) const
         if (imageCache_) {
             imageCache_->DumpCacheInfo();
         }
+    } else if (params[0] == "-memory") {
+        memoryManager_->DumpInfo();
+    } else if (params[0] == "-nodesize") {
+        FrameNode::DumpNodeSize(rootNode_);
     }
     return true;
 }
@@ -1799,7 +1967,6 @@ void PipelineContext::FlushTouchEvents()
     CHECK_RUN_ON(UI);
     CHECK_NULL_VOID(rootNode_);
     {
-        std::unordered_set<int32_t> moveEventIds;
         decltype(touchEvents_) touchEvents(std::move(touchEvents_));
         if (touchEvents.empty()) {
             canUseLongPredictTask_ = true;
@@ -1807,39 +1974,55 @@ void PipelineContext::FlushTouchEvents()
         }
         canUseLongPredictTask_ = false;
         eventManager_->FlushTouchEventsBegin(touchEvents_);
-        std::unordered_map<int, TouchEvent> idToTouchPoints;
-        bool needInterpolation = true;
-        std::unordered_map<int32_t, TouchEvent> newIdTouchPoints;
-        for (auto iter = touchEvents.rbegin(); iter != touchEvents.rend(); ++iter) {
-            auto scalePoint = (*iter).CreateScalePoint(GetViewScale());
-            idToTouchPoints.emplace(scalePoint.id, scalePoint);
-            idToTouchPoints[scalePoint.id].history.insert(idToTouchPoints[scalePoint.id].history.begin(), scalePoint);
-            needInterpolation = iter->type != TouchType::MOVE ? false : true;
+        // only a batch starting with a move event is resampled.
+        bool needInterpolation = touchEvents.front().type == TouchType::MOVE;
+        // the latest point of each pointer, with all points of this batch in order as its history.
+        std::vector<TouchEvent> touchPoints;
+        auto viewScale = GetViewScale();
+        for (const auto& event : touchEvents) {
+            auto scalePoint = event.CreateScalePoint(viewScale);
+            auto iter = std::find_if(touchPoints.begin(), touchPoints.end(),
+                [id = scalePoint.id](const TouchEvent& point) { return point.id == id; });
+            if (iter == touchPoints.end()) {
+                iter = touchPoints.emplace(touchPoints.end());
+            }
+            auto history = std::move(iter->history);
+            history.emplace_back(scalePoint);
+            *iter = std::move(scalePoint);
+            iter->history = std::move(history);
         }
         if (needInterpolation) {
             auto targetTimeStamp = resampleTimeStamp_;
-            for (const auto& idIter : idToTouchPoints) {
-                TouchEvent newTouchEvent =
-                    GetResampleTouchEvent(historyPointsById_[idIter.first], idIter.second.history, targetTimeStamp);
+            // the recognizers request it again while handling this batch.
+            bool needPrediction = isTouchPredictionRequested_;
+            isTouchPredictionRequested_ = false;
+            for (auto& point : touchPoints) {
+                auto& track = touchSampleTracks_[point.id];
+                for (const auto& historyPoint : point.history) {
+                    track.samples.emplace_back(historyPoint.ToSample());
+                }
+                TouchEvent newTouchEvent = GetResampleTouchEvent(track, point.history, targetTimeStamp);
                 if (newTouchEvent.x != 0 && newTouchEvent.y != 0) {
-                    newIdTouchPoints[idIter.first] = newTouchEvent;
+                    point = std::move(newTouchEvent);
                 }
-                historyPointsById_[idIter.first] = idIter.second.history;
-            }
-        }
-        std::list<TouchEvent> touchPoints;
-        for (const auto& iter : idToTouchPoints) {
-            if (newIdTouchPoints.find(iter.first) != newIdTouchPoints.end()) {
-                touchPoints.emplace_back(newIdTouchPoints[iter.first]);
-            } else {
-                touchPoints.emplace_back(iter.second);
+                auto predictedOffset =
+                    needPrediction ? GetPredictedOffset(track, predictTimeStamp_) : std::optional<Offset>();
+                if (predictedOffset) {
+                    const auto& latest = track.samples.back();
+                    point.predictedOffset = Offset(latest.x - point.x, latest.y - point.y) + predictedOffset.value();
+                }
+                // the samples of this batch become the history of the next one.
+                track.samples.erase(track.samples.begin(), track.samples.begin() + track.historySize);
+                track.historySize = track.samples.size();
             }
         }
-        auto maxSize = touchPoints.size();
-        for (auto iter = touchPoints.rbegin(); iter != touchPoints.rend(); ++iter) {
+        std::list<TouchEvent> touchPointList(
+            std::make_move_iterator(touchPoints.begin()), std::make_move_iterator(touchPoints.end()));
+        auto maxSize = touchPointList.size();
+        for (auto iter = touchPointList.rbegin(); iter != touchPointList.rend(); ++iter) {
             maxSize--;
             if (maxSize == 0) {
-                eventManager_->FlushTouchEventsEnd(touchPoints);
+                eventManager_->FlushTouchEventsEnd(touchPointList);
             }
             eventManager_->DispatchTouchEvent(*iter);
         }
@@ -2116,6 +2299,7 @@ void PipelineContext::AddVisibleAreaChangeNode(
     addInfo.callback = callback;
     addInfo.isCurrentVisible = false;
     onVisibleAreaChangeNodeIds_.emplace(node->GetId());
+    node->MarkVisibleAreaDirty();
     if (isUserCallback) {
         node->AddVisibleAreaUserCallback(ratio, addInfo);
     } else {
@@ -2128,15 +2312,37 @@ void PipelineContext::RemoveVisibleAreaChangeNode(int32_t nodeId)
     onVisibleAreaChangeNodeIds_.erase(nodeId);
 }
 
+void PipelineContext::AddDirtyVisibleAreaNode(const WeakPtr<FrameNode>& node)
+{
+    dirtyVisibleAreaNodes_.emplace_back(node);
+}
+
 void PipelineContext::HandleVisibleAreaChangeEvent()
 {
     ACE_FUNCTION_TRACE();
-    if (onVisibleAreaChangeNodeIds_.empty()) {
-        return;
+    std::vector<RefPtr<FrameNode>> checkNodes;
+    VisibleAreaCache cache;
+    if (!onVisibleAreaChangeNodeIds_.empty() && (visibleAreaDirty_ || !dirtyVisibleAreaNodes_.empty())) {
+        bool checkAll = visibleAreaDirty_;
+        visibleAreaDirty_ = false;
+        auto nodes = FrameNode::GetNodesById(onVisibleAreaChangeNodeIds_);
+        for (auto&& frameNode : nodes) {
+            if (checkAll || frameNode->IsVisibleAreaDirty(cache)) {
+                checkNodes.emplace_back(frameNode);
+            }
+        }
     }
-    auto nodes = FrameNode::GetNodesById(onVisibleAreaChangeNodeIds_);
-    for (auto&& frameNode : nodes) {
-        frameNode->TriggerVisibleAreaChangeCallback();
+    // reset before the callbacks run, nodes they change are marked for the next pass.
+    auto dirtyNodes = std::move(dirtyVisibleAreaNodes_);
+    dirtyVisibleAreaNodes_.clear();
+    for (const auto& weak : dirtyNodes) {
+        auto frameNode = weak.Upgrade();
+        if (frameNode) {
+            frameNode->ResetVisibleAreaDirty();
+        }
+    }
+    for (auto&& frameNode : checkNodes) {
+        frameNode->TriggerVisibleAreaChangeCallback(false, &cache);
     }
 }
 
@@ -2439,6 +2645,7 @@ void PipelineContext::FlushWindowStateChangedCallback(bool isShow)
             ++iter;
         }
     }
+    visibleAreaDirty_ = true;
     HandleVisibleAreaChangeEvent();
     HandleSubwindow(isShow);
 }
@@ -2573,6 +2780,7 @@ void PipelineContext::NotifyMemoryLevel(int32_t level)
             ++iter;
         }
     }
+    memoryManager_->TrimMemory(level);
 }
 void PipelineContext::AddPredictTask(PredictTask&& task)
 {
@@ -2580,6 +2788,21 @@ void PipelineContext::AddPredictTask(PredictTask&& task)
     RequestFrame();
 }
 
+void PipelineContext::HibernatePage(int32_t pageId)
+{
+    CHECK_RUN_ON(UI);
+    ACE_SCOPED_TRACE("HibernatePage %d", pageId);
+    taskScheduler_->HibernatePage(pageId);
+}
+
+void PipelineContext::WakeUpPage(int32_t pageId, bool restoreDirtyNodes)
+{
+    CHECK_RUN_ON(UI);
+    if (taskScheduler_->WakeUpPage(pageId, restoreDirtyNodes)) {
+        RequestFrame();
+    }
+}
+
 void PipelineContext::OnIdle(int64_t deadline)
 {
     if (deadline == 0) {
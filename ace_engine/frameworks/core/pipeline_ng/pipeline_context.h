@@ -34,6 +34,7 @@
 #include "core/components_ng/manager/drag_drop/drag_drop_manager.h"
 #include "core/components_ng/manager/frame_rate/frame_rate_manager.h"
 #include "core/components_ng/manager/full_screen/full_screen_manager.h"
+#include "core/components_ng/manager/memory/memory_manager.h"
 #include "core/components_ng/manager/post_event/post_event_manager.h"
 #include "core/components_ng/manager/safe_area/safe_area_manager.h"
 #include "core/components_ng/manager/select_overlay/select_overlay_manager.h"
@@ -131,6 +132,12 @@ public:
     // Called by view when touch event received.
     void OnTouchEvent(const TouchEvent& point, bool isSubPipe = false) override;
 
+    // Called by recognizers moved with touch prediction, the next batch of move events is predicted.
+    void RequestTouchPrediction()
+    {
+        isTouchPredictionRequested_ = true;
+    }
+
     // Called by container when key event received.
     // if return false, then this event needs platform to handle it.
     bool OnKeyEvent(const KeyEvent& event) override;
@@ -186,6 +193,13 @@ public:
     void RemoveFormVisibleChangeNode(int32_t nodeId);
 
     void HandleVisibleAreaChangeEvent();
+    // Visible area callbacks are only evaluated in frames after something that may move or hide a node. Marking the
+    // pipeline checks all registered nodes, marking a node only checks the registered nodes in its subtree.
+    void MarkVisibleAreaDirty()
+    {
+        visibleAreaDirty_ = true;
+    }
+    void AddDirtyVisibleAreaNode(const WeakPtr<FrameNode>& node);
     void HandleFormVisibleChangeEvent(bool isVisible);
 
     void HandleSubwindow(bool isShow);
@@ -242,6 +256,10 @@ public:
 
     void AddPredictTask(PredictTask&& task);
 
+    // Stops laying out and rendering the nodes of a background page until it is woken up.
+    void HibernatePage(int32_t pageId);
+    void WakeUpPage(int32_t pageId, bool restoreDirtyNodes = true);
+
     void AddAfterLayoutTask(std::function<void()>&& task);
 
     void AddPersistAfterLayoutTask(std::function<void()>&& task);
@@ -303,6 +321,11 @@ public:
         return frameRateManager_;
     }
 
+    const RefPtr<MemoryManager>& GetMemoryManager() const
+    {
+        return memoryManager_;
+    }
+
     void FlushBuild() override;
 
     void FlushPipelineImmediately() override;
@@ -632,16 +655,39 @@ private:
     std::pair<float, float> LinearInterpolation(const std::tuple<float, float, uint64_t>& history,
         const std::tuple<float, float, uint64_t>& current, const uint64_t nanoTimeStamp);
 
+    // Touch samples of one pointer, the samples of the previous batch are in [0, historySize) and are followed by
+    // the samples of the current batch. The storage is kept between batches, so resampling doesn't allocate.
+    struct TouchSampleTrack {
+        std::vector<TouchSample> samples;
+        size_t historySize = 0;
+    };
+
+    static TouchSampleTrack MakeTouchSampleTrack(
+        const std::vector<TouchEvent>& history, const std::vector<TouchEvent>& current);
+
     std::pair<float, float> GetResampleCoord(const std::vector<TouchEvent>& history,
         const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp, const bool isScreen);
 
+    std::pair<float, float> GetResampleCoord(
+        const TouchSampleTrack& track, const uint64_t nanoTimeStamp, const bool isScreen);
+
     std::tuple<float, float, uint64_t> GetAvgPoint(const std::vector<TouchEvent>& events, const bool isScreen);
 
+    std::tuple<float, float, uint64_t> GetAvgPoint(
+        const TouchSample* begin, const TouchSample* end, const bool isScreen);
+
     TouchEvent GetResampleTouchEvent(
         const std::vector<TouchEvent>& history, const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp);
 
+    TouchEvent GetResampleTouchEvent(
+        const TouchSampleTrack& track, const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp);
+
     TouchEvent GetLatestPoint(const std::vector<TouchEvent>& current, const uint64_t nanoTimeStamp);
 
+    // Extrapolates the latest sample of track to nanoTimeStamp with a fitted velocity and acceleration, return the
+    // offset from the latest sample, or nullopt if the samples are too few or too noisy to predict.
+    static std::optional<Offset> GetPredictedOffset(const TouchSampleTrack& track, const uint64_t nanoTimeStamp);
+
     std::unique_ptr<UITaskScheduler> taskScheduler_ = std::make_unique<UITaskScheduler>();
 
     std::unordered_map<uint32_t, WeakPtr<ScheduleTask>> scheduleTasks_;
@@ -672,6 +718,7 @@ private:
 
     std::unordered_set<int32_t> onAreaChangeNodeIds_;
     std::unordered_set<int32_t> onVisibleAreaChangeNodeIds_;
+    std::vector<WeakPtr<FrameNode>> dirtyVisibleAreaNodes_;
     std::unordered_set<int32_t> onFormVisibleChangeNodeIds_;
 
     RefPtr<StageManager> stageManager_;
@@ -682,6 +729,7 @@ private:
     RefPtr<SharedOverlayManager> sharedTransitionManager_;
     RefPtr<SafeAreaManager> safeAreaManager_ = MakeRefPtr<SafeAreaManager>();
     RefPtr<FrameRateManager> frameRateManager_ = MakeRefPtr<FrameRateManager>();
+    RefPtr<MemoryManager> memoryManager_ = MakeRefPtr<MemoryManager>();
     Rect displayAvailableRect_;
 #ifdef WINDOW_SCENE_SUPPORTED
     RefPtr<UIExtensionManager> uiExtensionManager_ = MakeRefPtr<UIExtensionManager>();
@@ -693,13 +741,17 @@ private:
     uint32_t nextScheduleTaskId_ = 0;
     int32_t mouseStyleNodeId_ = -1;
     uint64_t resampleTimeStamp_ = 0;
+    // expected present time of the frame being flushed, the target of touch prediction.
+    uint64_t predictTimeStamp_ = 0;
     bool hasIdleTasks_ = false;
     bool isFocusingByTab_ = false;
     bool isFocusActive_ = false;
     bool isTabJustTriggerOnKeyEvent_ = false;
     bool onShow_ = false;
+    bool visibleAreaDirty_ = true;
     bool isNeedFlushMouseEvent_ = false;
     bool canUseLongPredictTask_ = false;
+    bool isTouchPredictionRequested_ = false;
     bool isWindowSceneConsumed_ = false;
     bool isDensityChanged_ = false;
     bool isBeforeDragHandleAxis_ = false;
@@ -716,7 +768,7 @@ private:
     std::unordered_map<int32_t, WeakPtr<FrameNode>> storeNode_;
     std::unordered_map<int32_t, std::string> restoreNodeInfo_;
 
-    std::unordered_map<int32_t, std::vector<TouchEvent>> historyPointsById_;
+    std::unordered_map<int32_t, TouchSampleTrack> touchSampleTracks_;
 
     std::list<FrameInfo> dumpFrameInfos_;
     std::list<std::function<void()>> animationClosuresList_;
@@ -15,8 +15,14 @@
 
 #include "core/pipeline_ng/ui_task_scheduler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
 #include "base/log/frame_report.h"
 #include "base/memory/referenced.h"
+#include "base/thread/background_task_executor.h"
 #include "base/utils/time_util.h"
 #include "base/utils/utils.h"
 #include "core/common/thread_checker.h"
@@ -24,6 +30,12 @@
 #include "core/components_ng/pattern/custom/custom_node.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+// fewer background tasks are run on the UI thread, posting them costs more than running them.
+constexpr size_t MIN_PARALLEL_TASK_COUNT = 4;
+constexpr size_t MAX_PARALLEL_WORKER_COUNT = 3;
+} // namespace
+
 uint64_t UITaskScheduler::frameId_ = 0;
 
 UITaskScheduler::~UITaskScheduler()
@@ -35,6 +47,13 @@ void UITaskScheduler::AddDirtyLayoutNode(const RefPtr<FrameNode>& dirty)
 {
     CHECK_RUN_ON(UI);
     CHECK_NULL_VOID(dirty);
+    if (!hibernatedPages_.empty()) {
+        auto iter = hibernatedPages_.find(dirty->GetPageId());
+        if (iter != hibernatedPages_.end()) {
+            iter->second.layoutNodes.emplace_back(dirty);
+            return;
+        }
+    }
     dirtyLayoutNodes_.emplace_back(dirty);
 }
 
@@ -42,6 +61,13 @@ void UITaskScheduler::AddDirtyRenderNode(const RefPtr<FrameNode>& dirty)
 {
     CHECK_RUN_ON(UI);
     CHECK_NULL_VOID(dirty);
+    if (!hibernatedPages_.empty()) {
+        auto iter = hibernatedPages_.find(dirty->GetPageId());
+        if (iter != hibernatedPages_.end()) {
+            iter->second.renderNodes.emplace_back(dirty);
+            return;
+        }
+    }
     auto result = dirtyRenderNodes_[dirty->GetPageId()].emplace(dirty);
     if (!result.second) {
         LOGW("Fail to emplace %{public}s render node", dirty->GetTag().c_str());
@@ -83,6 +109,7 @@ void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
         FrameReport::GetInstance().BeginFlushRender();
     }
     auto dirtyRenderNodes = std::move(dirtyRenderNodes_);
+    std::vector<UITask> backgroundTasks;
     // Priority task creation
     int64_t time = 0;
     for (auto&& pageNodes : dirtyRenderNodes) {
@@ -103,10 +130,55 @@ void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
                     if (frameInfo_ != nullptr) {
                         frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::RENDER);
                     }
+                } else {
+                    backgroundTasks.emplace_back(std::move(*task));
                 }
             }
         }
     }
+    if (!backgroundTasks.empty()) {
+        ACE_SCOPED_TRACE("FlushRenderTask parallel %zu", backgroundTasks.size());
+        RunParallelTasks(backgroundTasks);
+        // all background tasks are done here, before the frame is sent.
+        for (const auto& task : backgroundTasks) {
+            task.Finish();
+        }
+    }
+}
+
+void UITaskScheduler::RunParallelTasks(const std::vector<UITask>& tasks)
+{
+    if (tasks.size() < MIN_PARALLEL_TASK_COUNT) {
+        for (const auto& task : tasks) {
+            task();
+        }
+        return;
+    }
+    struct SharedState {
+        std::atomic<size_t> nextIndex { 0 };
+        std::atomic<size_t> doneCount { 0 };
+        std::mutex mutex;
+        std::condition_variable condition;
+    };
+    auto state = std::make_shared<SharedState>();
+    // a worker only reads [tasks] after it takes an index which is not done, so [tasks] is alive until it returns.
+    auto runTasks = [state, data = tasks.data(), size = tasks.size()]() {
+        for (auto index = state->nextIndex++; index < size; index = state->nextIndex++) {
+            data[index]();
+            if (++state->doneCount == size) {
+                std::lock_guard<std::mutex> lock(state->mutex);
+                state->condition.notify_all();
+            }
+        }
+    };
+    auto workerCount = std::min(tasks.size() - 1, MAX_PARALLEL_WORKER_COUNT);
+    for (size_t i = 0; i < workerCount; ++i) {
+        BackgroundTaskExecutor::GetInstance().PostTask(runTasks);
+    }
+    // the UI thread takes tasks as well, all of them are run even if no worker is free.
+    runTasks();
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&state, size = tasks.size()]() { return state->doneCount == size; });
 }
 
 bool UITaskScheduler::NeedAdditionalLayout()
@@ -137,16 +209,20 @@ void UITaskScheduler::FlushTask()
 {
     CHECK_RUN_ON(UI);
     ACE_SCOPED_TRACE("UITaskScheduler::FlushTask");
-    FlushLayoutTask();
-    if (NeedAdditionalLayout()) {
+    {
+        FrameArena::Scope arenaScope(frameArena_);
         FlushLayoutTask();
+        if (NeedAdditionalLayout()) {
+            FlushLayoutTask();
+        }
+        if (!afterLayoutTasks_.empty()) {
+            FlushAfterLayoutTask();
+        }
+        FlushDelayJsActive();
+        ElementRegister::GetInstance()->ClearPendingRemoveNodes();
+        FlushRenderTask();
     }
-    if (!afterLayoutTasks_.empty()) {
-        FlushAfterLayoutTask();
-    }
-    FlushDelayJsActive();
-    ElementRegister::GetInstance()->ClearPendingRemoveNodes();
-    FlushRenderTask();
+    frameArena_.Reset();
 }
 
 void UITaskScheduler::SetJSViewActive(bool active, WeakPtr<CustomNode> custom)
@@ -173,6 +249,62 @@ void UITaskScheduler::FlushDelayJsActive()
     }
 }
 
+void UITaskScheduler::HibernatePage(int32_t pageId)
+{
+    CHECK_RUN_ON(UI);
+    auto result = hibernatedPages_.try_emplace(pageId);
+    if (!result.second) {
+        return;
+    }
+    // park the nodes of the page which are already dirty.
+    auto& parked = result.first->second;
+    for (auto iter = dirtyLayoutNodes_.begin(); iter != dirtyLayoutNodes_.end();) {
+        if (*iter && (*iter)->GetPageId() == pageId) {
+            parked.layoutNodes.emplace_back(*iter);
+            iter = dirtyLayoutNodes_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    auto renderIter = dirtyRenderNodes_.find(static_cast<uint32_t>(pageId));
+    if (renderIter != dirtyRenderNodes_.end()) {
+        for (const auto& node : renderIter->second) {
+            parked.renderNodes.emplace_back(node);
+        }
+        dirtyRenderNodes_.erase(renderIter);
+    }
+}
+
+bool UITaskScheduler::WakeUpPage(int32_t pageId, bool restoreDirtyNodes)
+{
+    CHECK_RUN_ON(UI);
+    auto iter = hibernatedPages_.find(pageId);
+    if (iter == hibernatedPages_.end()) {
+        return false;
+    }
+    auto parked = std::move(iter->second);
+    hibernatedPages_.erase(iter);
+    if (!restoreDirtyNodes) {
+        return false;
+    }
+    bool restored = false;
+    for (const auto& weak : parked.layoutNodes) {
+        auto node = weak.Upgrade();
+        if (node && !node->IsInDestroying()) {
+            dirtyLayoutNodes_.emplace_back(node);
+            restored = true;
+        }
+    }
+    for (const auto& weak : parked.renderNodes) {
+        auto node = weak.Upgrade();
+        if (node && !node->IsInDestroying()) {
+            dirtyRenderNodes_[node->GetPageId()].emplace(node);
+            restored = true;
+        }
+    }
+    return restored;
+}
+
 void UITaskScheduler::AddPredictTask(PredictTask&& task)
 {
     predictTask_.push_back(std::move(task));
@@ -192,6 +324,7 @@ void UITaskScheduler::CleanUp()
 {
     dirtyLayoutNodes_.clear();
     dirtyRenderNodes_.clear();
+    hibernatedPages_.clear();
 }
 
 bool UITaskScheduler::isEmpty()
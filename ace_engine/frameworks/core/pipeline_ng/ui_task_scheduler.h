@@ -21,8 +21,11 @@
 #include <list>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <vector>
 
 #include "base/log/frame_info.h"
+#include "base/memory/frame_arena.h"
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
 
@@ -62,8 +65,22 @@ public:
         }
     }
 
+    // [finishTask] is run on the UI thread after the task is run on a background thread.
+    void SetFinishTask(std::function<void()>&& finishTask)
+    {
+        finishTask_ = std::move(finishTask);
+    }
+
+    void Finish() const
+    {
+        if (finishTask_) {
+            finishTask_();
+        }
+    }
+
 private:
     std::function<void()> task_;
+    std::function<void()> finishTask_;
     TaskThread taskThread_ = MAIN_TASK;
 };
 
@@ -91,6 +108,15 @@ public:
 
     void FlushDelayJsActive();
 
+    // Dirty nodes of a hibernated page are parked instead of being laid out and rendered, they are added back
+    // when the page wakes up, or dropped if [restoreDirtyNodes] is false.
+    void HibernatePage(int32_t pageId);
+    bool WakeUpPage(int32_t pageId, bool restoreDirtyNodes = true);
+    bool IsPageHibernated(int32_t pageId) const
+    {
+        return hibernatedPages_.find(pageId) != hibernatedPages_.end();
+    }
+
     void UpdateCurrentPageId(uint32_t id)
     {
         currentPageId_ = id;
@@ -130,6 +156,9 @@ public:
 private:
     bool NeedAdditionalLayout();
 
+    // run [tasks] on the background threads and the current thread, return after all of them are done.
+    static void RunParallelTasks(const std::vector<UITask>& tasks);
+
     template<typename T>
     struct NodeCompare {
         bool operator()(const T& nodeLeft, const T& nodeRight) const
@@ -153,18 +182,28 @@ private:
     using PageDirtySet = std::set<RefPtr<FrameNode>, NodeCompare<RefPtr<FrameNode>>>;
     using RootDirtyMap = std::map<uint32_t, PageDirtySet>;
 
+    struct HibernatedDirtyNodes {
+        std::list<WeakPtr<FrameNode>> layoutNodes;
+        std::list<WeakPtr<FrameNode>> renderNodes;
+    };
+
     std::list<RefPtr<FrameNode>> dirtyLayoutNodes_;
     RootDirtyMap dirtyRenderNodes_;
     std::list<PredictTask> predictTask_;
     std::list<std::function<void()>> afterLayoutTasks_;
     std::list<std::function<void()>> afterRenderTasks_;
     std::list<std::function<void()>> persistAfterLayoutTasks_;
+    // page id -> dirty nodes parked while the page is hibernated
+    std::unordered_map<int32_t, HibernatedDirtyNodes> hibernatedPages_;
 
     uint32_t currentPageId_ = 0;
     bool isLayouting_ = false;
 
     FrameInfo* frameInfo_ = nullptr;
 
+    // the wrappers created to layout and paint the dirty nodes are allocated here in FlushTask.
+    FrameArena frameArena_;
+
     std::map<WeakPtr<CustomNode>, bool> delayJsActiveNodes_;
 
     static uint64_t frameId_;
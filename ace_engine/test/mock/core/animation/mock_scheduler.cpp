@@ -22,6 +22,13 @@ void Scheduler::Start() {}
 
 void Scheduler::Stop() {}
 
+void Scheduler::Tick(uint64_t elapsedTimeMs)
+{
+    if (isRunning_ && callback_) {
+        callback_(elapsedTimeMs);
+    }
+}
+
 bool Scheduler::Animate(const AnimationOption& option, const RefPtr<Curve>& curve,
     const std::function<void()> propertyCallback, const std::function<void()>& finishCallBack)
 {
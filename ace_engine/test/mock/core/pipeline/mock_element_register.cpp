@@ -44,8 +44,8 @@ RefPtr<AceType> ElementRegister::GetNodeById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto position = itemMap_.find(elementId);
-    return position == itemMap_.end() ? nullptr : position->second.Upgrade();
+    auto item = itemMap_.Find(elementId);
+    return item == nullptr ? nullptr : item->Upgrade();
 }
 
 RefPtr<V2::ElementProxy> ElementRegister::GetElementProxyById(ElementIdType /* elementId */)
@@ -55,7 +55,7 @@ RefPtr<V2::ElementProxy> ElementRegister::GetElementProxyById(ElementIdType /* e
 
 bool ElementRegister::Exists(ElementIdType elementId)
 {
-    return (itemMap_.find(elementId) != itemMap_.end());
+    return itemMap_.Contains(elementId);
 }
 
 void ElementRegister::UpdateRecycleElmtId(int32_t oldElmtId, int32_t newElmtId)
@@ -65,15 +65,14 @@ void ElementRegister::UpdateRecycleElmtId(int32_t oldElmtId, int32_t newElmtId)
     }
     auto node = GetNodeById(oldElmtId);
     if (node) {
-        itemMap_.erase(oldElmtId);
+        itemMap_.Erase(oldElmtId);
         AddReferenced(newElmtId, node);
     }
 }
 
 bool ElementRegister::AddReferenced(ElementIdType elmtId, const WeakPtr<AceType>& referenced)
 {
-    auto result = itemMap_.emplace(elmtId, referenced);
-    return result.second;
+    return itemMap_.Emplace(elmtId, referenced);
 }
 
 bool ElementRegister::AddElement(const RefPtr<Element>& element)
@@ -94,8 +93,8 @@ RefPtr<NG::UINode> ElementRegister::GetUINodeById(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return nullptr;
     }
-    auto iter = itemMap_.find(elementId);
-    return iter == itemMap_.end() ? nullptr : AceType::DynamicCast<NG::UINode>(iter->second).Upgrade();
+    auto item = itemMap_.Find(elementId);
+    return item == nullptr ? nullptr : AceType::DynamicCast<NG::UINode>(*item).Upgrade();
 }
 
 bool ElementRegister::AddUINode(const RefPtr<NG::UINode>& node)
@@ -107,13 +106,18 @@ bool ElementRegister::AddUINode(const RefPtr<NG::UINode>& node)
 }
 
 bool ElementRegister::RemoveItem(ElementIdType elementId, const std::string& tag)
+{
+    return RemoveItem(elementId, TagRegistry::GetInstance().Intern(tag));
+}
+
+bool ElementRegister::RemoveItem(ElementIdType elementId, uint32_t tagId)
 {
     if (elementId == ElementRegister::UndefinedElementId) {
         return false;
     }
-    auto removed = itemMap_.erase(elementId);
+    auto removed = itemMap_.Erase(elementId);
     if (removed) {
-        removedItems_.insert(std::pair(elementId, tag));
+        removedItems_.push_back({ elementId, tagId });
     }
     return removed;
 }
@@ -123,18 +127,18 @@ bool ElementRegister::RemoveItemSilently(ElementIdType elementId)
     if (elementId == ElementRegister::UndefinedElementId) {
         return false;
     }
-    return itemMap_.erase(elementId);
+    return itemMap_.Erase(elementId);
 }
 
 void ElementRegister::MoveRemovedItems(RemovedElementsType& removedItems)
 {
-    removedItems = removedItems_;
-    removedItems_ = std::unordered_set<std::pair<ElementIdType, std::string>, deleted_element_hash>();
+    removedItems.swap(removedItems_);
+    removedItems_.clear();
 }
 
 void ElementRegister::Clear()
 {
-    itemMap_.clear();
+    itemMap_.Clear();
     removedItems_.clear();
     geometryTransitionMap_.clear();
     pendingRemoveNodes_.clear();
@@ -315,6 +315,10 @@ void PipelineContext::AddBuildFinishCallBack(std::function<void()>&& callback)
 
 void PipelineContext::AddPredictTask(PredictTask&& task) {}
 
+void PipelineContext::HibernatePage(int32_t pageId) {}
+
+void PipelineContext::WakeUpPage(int32_t pageId, bool restoreDirtyNodes) {}
+
 void PipelineContext::AddAfterLayoutTask(std::function<void()>&& task)
 {
     if (task) {
@@ -347,6 +351,7 @@ void PipelineContext::AddFormVisibleChangeNode(const RefPtr<FrameNode>& node, co
 {}
 void PipelineContext::RemoveFormVisibleChangeNode(int32_t nodeId) {}
 void PipelineContext::HandleVisibleAreaChangeEvent() {}
+void PipelineContext::AddDirtyVisibleAreaNode(const WeakPtr<FrameNode>& node) {}
 void PipelineContext::HandleFormVisibleChangeEvent(bool isVisible) {}
 
 bool PipelineContext::ChangeMouseStyle(int32_t nodeId, MouseFormat format)
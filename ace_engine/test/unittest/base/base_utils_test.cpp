@@ -23,11 +23,13 @@
 #include "gtest/gtest.h"
 
 #include "base/log/log.h"
+#include "base/memory/frame_arena.h"
 #include "base/utils/base_id.h"
 #include "base/utils/date_util.h"
 #include "base/utils/resource_configuration.h"
 #include "base/utils/string_expression.h"
 #include "base/utils/string_utils.h"
+#include "base/utils/tag_registry.h"
 #include "base/utils/time_util.h"
 #include "base/utils/utils.h"
 
@@ -816,4 +818,88 @@ HWTEST_F(BaseUtilsTest, BaseUtilsTest042, TestSize.Level1)
     ASSERT_EQ(StringUtils::EndWith(startWithValue, prefixString), true);
     ASSERT_EQ(StringUtils::EndWith(startWithValue, prefixString), true);
 }
+
+/**
+ * @tc.name: BaseUtilsTest043
+ * @tc.desc: Calculate a compiled formula the same as the formula string
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest043, TestSize.Level1)
+{
+    const std::string formula = "calc(2px * 3 + (10px - 4px) / 2)";
+    auto calcFunc = [](const Dimension& dim) -> double { return dim.Value(); };
+    auto rpnExp = StringExpression::CompileExp(formula);
+    ASSERT_FALSE(rpnExp.empty());
+    ASSERT_EQ(StringExpression::CalculateExp(rpnExp, calcFunc), StringExpression::CalculateExp(formula, calcFunc));
+    ASSERT_TRUE(StringExpression::CompileExp(FORMULA_TWO).empty());
+}
+
+/**
+ * @tc.name: BaseUtilsTest044
+ * @tc.desc: Test FrameArena reuses its block after reset and keeps the block of an object escaped the frame
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest044, TestSize.Level1)
+{
+    struct ArenaObject : public FrameArenaObject {
+        int64_t value = 0;
+    };
+    FrameArena arena;
+    auto* heapObject = new ArenaObject();
+    EXPECT_EQ(arena.GetBlockCount(), 0);
+    delete heapObject;
+
+    ArenaObject* escapedObject = nullptr;
+    {
+        FrameArena::Scope scope(arena);
+        EXPECT_EQ(FrameArena::GetCurrent(), &arena);
+        escapedObject = new ArenaObject();
+        auto* object = new ArenaObject();
+        EXPECT_EQ(arena.GetBlockCount(), 1);
+        delete object;
+    }
+    EXPECT_EQ(FrameArena::GetCurrent(), nullptr);
+    arena.Reset();
+    EXPECT_EQ(arena.GetEscapedCount(), 1);
+    EXPECT_EQ(arena.GetBlockCount(), 0);
+    escapedObject->value = 1;
+    EXPECT_EQ(escapedObject->value, 1);
+    delete escapedObject;
+
+    {
+        FrameArena::Scope scope(arena);
+        delete new ArenaObject();
+    }
+    arena.Reset();
+    EXPECT_EQ(arena.GetBlockCount(), 1);
+    EXPECT_EQ(arena.GetEscapedCount(), 1);
+}
+
+/**
+ * @tc.name: BaseUtilsTest045
+ * @tc.desc: Test TagRegistry gives equal tags the same id and InternedTag compares by the id
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest045, TestSize.Level1)
+{
+    auto& registry = TagRegistry::GetInstance();
+    auto columnId = registry.Intern("Column");
+    auto rowId = registry.Intern("Row");
+    EXPECT_NE(columnId, TagRegistry::UNDEFINED_TAG_ID);
+    EXPECT_NE(columnId, rowId);
+    EXPECT_EQ(registry.Intern(std::string("Col") + "umn"), columnId);
+    EXPECT_EQ(registry.GetTag(columnId), "Column");
+    EXPECT_EQ(registry.GetTag(TagRegistry::UNDEFINED_TAG_ID), "undefined TAG");
+    EXPECT_EQ(registry.GetTag(static_cast<uint32_t>(registry.GetTagCount())), "undefined TAG");
+
+    InternedTag tag("Column");
+    EXPECT_EQ(tag.GetId(), columnId);
+    EXPECT_EQ(&tag.GetName(), &registry.GetTag(columnId));
+    EXPECT_TRUE(tag == InternedTag("Column"));
+    EXPECT_TRUE(tag == "Column");
+    tag = std::string("Row");
+    EXPECT_EQ(tag.GetId(), rowId);
+    EXPECT_TRUE(tag != "Column");
+    EXPECT_EQ(InternedTag().GetId(), TagRegistry::UNDEFINED_TAG_ID);
+}
 } // namespace OHOS::Ace
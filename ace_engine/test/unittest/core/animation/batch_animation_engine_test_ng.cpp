@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#define private public
+#define protected public
+#include "core/animation/batch_animation_engine.h"
+#include "core/animation/cubic_curve.h"
+#include "core/animation/curve_animation.h"
+#include "core/animation/scheduler.h"
+#undef private
+#undef protected
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr size_t ANIMATOR_COUNT = 8;
+constexpr uint64_t DURATION = 300;
+constexpr uint64_t DELAY_STEP = 40;
+constexpr uint64_t START_TIMESTAMP = 1000000000;
+constexpr uint64_t START_STEP = 1000003;
+constexpr uint64_t FRAME_TIME = 16666667;
+constexpr int32_t MAX_FRAME_COUNT = 100;
+constexpr float BEGIN_VALUE = 0.0f;
+constexpr float END_VALUE = 100.0f;
+
+// An animator played with a delay, driven by the frame callback of its scheduler.
+struct TestAnimator {
+    RefPtr<Scheduler> scheduler;
+    RefPtr<CurveAnimation<float>> animation;
+    uint64_t delay = 0;
+    uint64_t playedTime = 0;
+    float value = BEGIN_VALUE;
+};
+
+std::vector<std::unique_ptr<TestAnimator>> CreateAnimators(const RefPtr<BatchAnimationEngine>& engine)
+{
+    std::vector<std::unique_ptr<TestAnimator>> animators;
+    for (size_t i = 0; i < ANIMATOR_COUNT; ++i) {
+        auto animator = std::make_unique<TestAnimator>();
+        auto* rawAnimator = animator.get();
+        animator->delay = i * DELAY_STEP;
+        animator->animation = AceType::MakeRefPtr<CurveAnimation<float>>(
+            BEGIN_VALUE, END_VALUE, AceType::MakeRefPtr<CubicCurve>(0.25f, 0.1f, 0.25f, 1.0f));
+        animator->animation->AddListener([rawAnimator](float value) { rawAnimator->value = value; });
+        animator->scheduler = SchedulerBuilder::Build(
+            [rawAnimator, weak = WeakPtr<BatchAnimationEngine>(engine)](uint64_t duration) {
+                rawAnimator->playedTime += duration;
+                if (rawAnimator->playedTime < rawAnimator->delay) {
+                    return;
+                }
+                auto normalized =
+                    std::min(1.0f, static_cast<float>(rawAnimator->playedTime - rawAnimator->delay) / DURATION);
+                rawAnimator->animation->OnNormalizedTimestampChanged(normalized, false);
+                if (normalized < 1.0f) {
+                    return;
+                }
+                rawAnimator->scheduler->isRunning_ = false;
+                auto engine = weak.Upgrade();
+                if (engine) {
+                    engine->RemoveScheduler(AceType::RawPtr(rawAnimator->scheduler));
+                }
+            },
+            WeakPtr<PipelineBase>());
+        animator->scheduler->isRunning_ = true;
+        animator->scheduler->startupTimestamp_ = START_TIMESTAMP + i * START_STEP;
+        animators.emplace_back(std::move(animator));
+    }
+    return animators;
+}
+} // namespace
+
+class BatchAnimationEngineTestNg : public testing::Test {};
+
+/**
+ * @tc.name: BatchAnimationEngineTest001
+ * @tc.desc: Test animators ticked by the batch engine play the same values as ticked one by one.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BatchAnimationEngineTestNg, BatchAnimationEngineTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create two sets of animators with the same delays and startup timestamps, add the first set
+     *                   to the batch engine.
+     */
+    auto engine = AceType::MakeRefPtr<BatchAnimationEngine>(WeakPtr<PipelineBase>());
+    auto batched = CreateAnimators(engine);
+    auto reference = CreateAnimators(nullptr);
+    for (const auto& animator : batched) {
+        engine->AddScheduler(animator->scheduler, animator->scheduler->startupTimestamp_);
+    }
+    EXPECT_EQ(engine->GetActiveCount(), ANIMATOR_COUNT);
+
+    /**
+     * @tc.steps: step2. Tick the batched set by the engine and the reference set scheduler by scheduler.
+     * @tc.expected: every animator plays the same value as its reference on every frame.
+     */
+    auto timestamp = START_TIMESTAMP;
+    for (int32_t frame = 0; frame < MAX_FRAME_COUNT && engine->GetActiveCount() > 0; ++frame) {
+        timestamp += FRAME_TIME;
+        engine->OnFrame(timestamp);
+        for (const auto& animator : reference) {
+            auto scheduler = animator->scheduler;
+            if (scheduler->isRunning_) {
+                scheduler->Tick(Scheduler::ConsumeElapsedTime(scheduler->startupTimestamp_, timestamp));
+            }
+        }
+        size_t runningCount = 0;
+        for (size_t i = 0; i < ANIMATOR_COUNT; ++i) {
+            EXPECT_FLOAT_EQ(batched[i]->value, reference[i]->value);
+            EXPECT_EQ(batched[i]->playedTime, reference[i]->playedTime);
+            runningCount += batched[i]->scheduler->isRunning_ ? 1 : 0;
+        }
+        EXPECT_EQ(engine->GetActiveCount(), runningCount);
+    }
+
+    /**
+     * @tc.steps: step3. Check the animators after the frames.
+     * @tc.expected: all animators are finished and removed from the engine.
+     */
+    EXPECT_EQ(engine->GetActiveCount(), 0u);
+    for (const auto& animator : batched) {
+        EXPECT_FLOAT_EQ(animator->value, END_VALUE);
+    }
+}
+
+/**
+ * @tc.name: BatchAnimationEngineTest002
+ * @tc.desc: Test schedulers removed or released between frames are not ticked.
+ * @tc.type: FUNC
+ */
+HWTEST_F(BatchAnimationEngineTestNg, BatchAnimationEngineTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Add the animators to the batch engine, remove the first one and release the last one.
+     */
+    auto engine = AceType::MakeRefPtr<BatchAnimationEngine>(WeakPtr<PipelineBase>());
+    auto animators = CreateAnimators(engine);
+    for (const auto& animator : animators) {
+        engine->AddScheduler(animator->scheduler, animator->scheduler->startupTimestamp_);
+    }
+    engine->RemoveScheduler(AceType::RawPtr(animators.front()->scheduler));
+    EXPECT_EQ(engine->GetActiveCount(), ANIMATOR_COUNT - 1);
+    animators.back()->scheduler->isRunning_ = false;
+    animators.back()->scheduler.Reset();
+
+    /**
+     * @tc.steps: step2. Tick one frame.
+     * @tc.expected: the removed and the released schedulers are not ticked, the released one is dropped.
+     */
+    engine->OnFrame(START_TIMESTAMP + FRAME_TIME);
+    EXPECT_EQ(animators.front()->playedTime, 0u);
+    EXPECT_EQ(animators.back()->playedTime, 0u);
+    EXPECT_GT(animators[1]->playedTime, 0u);
+    EXPECT_EQ(engine->GetActiveCount(), ANIMATOR_COUNT - 2);
+}
+} // namespace OHOS::Ace
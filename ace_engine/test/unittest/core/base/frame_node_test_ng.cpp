@@ -1243,11 +1243,11 @@ HWTEST_F(FrameNodeTestNg, FrameNodeProcessAllVisibleCallback0033, TestSize.Level
      * @tc.steps: step1. create a node and init a map for preparing for args, then set a flag
      */
     auto one = FrameNode::GetOrCreateFrameNode("one", 11, []() { return AceType::MakeRefPtr<Pattern>(); });
-    std::unordered_map<double, VisibleCallbackInfo> visibleAreaCallbacks;
+    VisibleAreaCallbacks visibleAreaCallbacks;
     auto insert = [&visibleAreaCallbacks](double callbackRatio, std::function<void(bool, double)> callback,
                       bool isCurrentVisible = false, double visibleRatio = 1.0) {
         VisibleCallbackInfo callbackInfo { callback, visibleRatio, isCurrentVisible };
-        visibleAreaCallbacks.emplace(callbackRatio, callbackInfo);
+        visibleAreaCallbacks.emplace_back(callbackRatio, callbackInfo);
     };
     bool flag = false;
     auto defaultCallback = [&flag](bool input1, double input2) { flag = !flag; };
@@ -1353,10 +1353,11 @@ HWTEST_F(FrameNodeTestNg, FrameNodeCreateAnimatablePropertyFloat0035, TestSize.L
      * @tc.steps: step2. put value to map and call CreateAnimatablePropertyFloat.
      * @tc.expected: expect iter is not equal map.
      */
-    FRAME_NODE->nodeAnimatablePropertyMap_.emplace("test", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.emplace(
+        "test", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
     FRAME_NODE->CreateAnimatablePropertyFloat(NAME, value, onCallbackEvent);
-    auto iter = FRAME_NODE->nodeAnimatablePropertyMap_.find(NAME);
-    auto map = FRAME_NODE->nodeAnimatablePropertyMap_.end();
+    auto iter = FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.find(NAME);
+    auto map = FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.end();
     EXPECT_NE(iter, map);
 }
 
@@ -1372,18 +1373,19 @@ HWTEST_F(FrameNodeTestNg, FrameNodeUpdateAnimatablePropertyFloat0036, TestSize.L
      * @tc.expected: expect iter is not equal map.
      */
     FRAME_NODE->UpdateAnimatablePropertyFloat(NAME, value);
-    FRAME_NODE->nodeAnimatablePropertyMap_.clear();
-    FRAME_NODE->nodeAnimatablePropertyMap_.emplace("propertyName", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.clear();
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.emplace(
+        "propertyName", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
     FRAME_NODE->UpdateAnimatablePropertyFloat(NAME, value);
-    auto iter = FRAME_NODE->nodeAnimatablePropertyMap_.find(NAME);
-    auto map = FRAME_NODE->nodeAnimatablePropertyMap_.end();
+    auto iter = FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.find(NAME);
+    auto map = FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.end();
     EXPECT_NE(iter, map);
 
     /**
-     * @tc.steps: step2. call UpdateAnimatablePropertyFloat and clear nodeAnimatablePropertyMap_.
+     * @tc.steps: step2. call UpdateAnimatablePropertyFloat and clear nodeAnimatablePropertyMap.
      * @tc.expected: expect property is nullptr.
      */
-    FRAME_NODE->nodeAnimatablePropertyMap_.clear();
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.clear();
     FRAME_NODE->UpdateAnimatablePropertyFloat(NAME, value);
     auto property = AceType::DynamicCast<NodeAnimatablePropertyFloat>(iter->second);
     EXPECT_EQ(property, nullptr);
@@ -1403,10 +1405,11 @@ HWTEST_F(FrameNodeTestNg, FrameNodeCreateAnimatableArithmeticProperty0037, TestS
     RefPtr<CustomAnimatableArithmetic> value = AceType::MakeRefPtr<CustomAnimatableArithmetic>();
     std::function<void(const RefPtr<NG::CustomAnimatableArithmetic>&)> onCallbackEvent;
     FRAME_NODE->CreateAnimatableArithmeticProperty(NAME, value, onCallbackEvent);
-    FRAME_NODE->nodeAnimatablePropertyMap_.emplace("test", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.emplace(
+        "test", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
     FRAME_NODE->CreateAnimatableArithmeticProperty(NAME, value, onCallbackEvent);
-    auto iter = FRAME_NODE->nodeAnimatablePropertyMap_.find(NAME);
-    auto map = FRAME_NODE->nodeAnimatablePropertyMap_.end();
+    auto iter = FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.find(NAME);
+    auto map = FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.end();
     EXPECT_NE(iter, map);
 }
 
@@ -1423,19 +1426,20 @@ HWTEST_F(FrameNodeTestNg, FrameNodeUpdateAnimatableArithmeticProperty0038, TestS
      */
     RefPtr<CustomAnimatableArithmetic> value = AceType::MakeRefPtr<CustomAnimatableArithmetic>();
     FRAME_NODE->UpdateAnimatableArithmeticProperty(NAME, value);
-    FRAME_NODE->nodeAnimatablePropertyMap_.clear();
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.clear();
 
-    FRAME_NODE->nodeAnimatablePropertyMap_.emplace("propertyName", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.emplace(
+        "propertyName", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
     FRAME_NODE->UpdateAnimatableArithmeticProperty(NAME, value);
-    auto iter = FRAME_NODE->nodeAnimatablePropertyMap_.find(NAME);
-    auto map = FRAME_NODE->nodeAnimatablePropertyMap_.end();
+    auto iter = FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.find(NAME);
+    auto map = FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.end();
     EXPECT_NE(iter, map);
 
     /**
-     * @tc.steps: step2. call UpdateAnimatablePropertyFloat and clear nodeAnimatablePropertyMap_.
+     * @tc.steps: step2. call UpdateAnimatablePropertyFloat and clear nodeAnimatablePropertyMap.
      * @tc.expected: expect property is nullptr.
      */
-    FRAME_NODE->nodeAnimatablePropertyMap_.clear();
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.clear();
     FRAME_NODE->UpdateAnimatableArithmeticProperty("", value);
     auto property = AceType::DynamicCast<NodeAnimatableArithmeticProperty>(iter->second);
     EXPECT_EQ(property, nullptr);
@@ -2551,4 +2555,136 @@ HWTEST_F(FrameNodeTestNg, FindChildByNameTest002, TestSize.Level1)
     auto noHaveResult = FrameNode::FindChildByName(nodeParent, nodeTwoChildName);
     EXPECT_EQ(noHaveResult, nullptr);
 }
+
+/**
+ * @tc.name: MeasureCacheTest001
+ * @tc.desc: Test FrameNode takes the size measured with a previous constraint from the measure cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, MeasureCacheTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create frameNode and measure it with two constraints.
+     * @tc.expected: both results are kept in the measure cache.
+     */
+    auto frameNode = FrameNode::CreateFrameNode("measureCache", 60, AceType::MakeRefPtr<Pattern>());
+    frameNode->isActive_ = true;
+    LayoutConstraintF constraint;
+    constraint.maxSize = CONTAINER_SIZE;
+    constraint.percentReference = CONTAINER_SIZE;
+    constraint.selfIdealSize.SetSize(CONTAINER_SIZE);
+    LayoutConstraintF smallConstraint = constraint;
+    smallConstraint.selfIdealSize.SetSize(CONTAINER_SIZE_SMALL);
+    frameNode->Measure(constraint);
+    frameNode->Measure(smallConstraint);
+    EXPECT_EQ(frameNode->GetGeometryNode()->GetFrameSize(), CONTAINER_SIZE_SMALL);
+    EXPECT_EQ(frameNode->measureCache_.entries_.size(), 2);
+
+    /**
+     * @tc.steps: step2. Measure frameNode with the first constraint again.
+     * @tc.expected: the size is taken from the cache and the children are measured again before layout.
+     */
+    frameNode->Measure(constraint);
+    EXPECT_EQ(frameNode->GetGeometryNode()->GetFrameSize(), CONTAINER_SIZE);
+    EXPECT_TRUE(frameNode->layoutAlgorithm_->SkipMeasure());
+    EXPECT_TRUE(frameNode->measureCache_.IsPending());
+    frameNode->Layout();
+    EXPECT_FALSE(frameNode->measureCache_.IsPending());
+    EXPECT_EQ(frameNode->GetGeometryNode()->GetFrameSize(), CONTAINER_SIZE);
+
+    /**
+     * @tc.steps: step3. Flag the layout property to remeasure and measure with the small constraint.
+     * @tc.expected: the cached entries are out of date, frameNode is measured.
+     */
+    frameNode->GetLayoutProperty()->UpdatePropertyChangeFlag(PROPERTY_UPDATE_MEASURE);
+    frameNode->Measure(smallConstraint);
+    EXPECT_FALSE(frameNode->layoutAlgorithm_->SkipMeasure());
+    EXPECT_TRUE(frameNode->layoutAlgorithm_->HasMeasured());
+    EXPECT_EQ(frameNode->GetGeometryNode()->GetFrameSize(), CONTAINER_SIZE_SMALL);
+}
+
+/**
+ * @tc.name: ExtraDataTest001
+ * @tc.desc: Test FrameNode allocates the rarely used members only when they are set
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, ExtraDataTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create frameNode, read the rarely used members and set an id without exposure config.
+     * @tc.expected: the default values are returned and no extra data is allocated.
+     */
+    auto frameNode = FrameNode::CreateFrameNode("main", 1, AceType::MakeRefPtr<Pattern>(), true);
+    EXPECT_TRUE(frameNode->GetAllowDrop().empty());
+    EXPECT_EQ(frameNode->GetDragPreviewOption().mode, DragPreviewMode::AUTO);
+    EXPECT_EQ(frameNode->GetAnimatablePropertyFloat(NAME), nullptr);
+    EXPECT_EQ(frameNode->GetNodeExpectedRate(), 0);
+    frameNode->ClearVisibleAreaUserCallback();
+    frameNode->OnInspectorIdUpdate("extraData");
+    EXPECT_TRUE(frameNode->isExposureChecked_);
+    EXPECT_EQ(frameNode->extraData_, nullptr);
+
+    /**
+     * @tc.steps: step2. Add a visible area callback and a destroy callback.
+     * @tc.expected: the extra data is allocated and the destroy callback is called with the node destroyed.
+     */
+    VisibleCallbackInfo callbackInfo;
+    frameNode->AddVisibleAreaUserCallback(0.5, callbackInfo);
+    ASSERT_NE(frameNode->extraData_, nullptr);
+    EXPECT_EQ(frameNode->extraData_->visibleAreaUserCallbacks.size(), 1);
+    bool destroyed = false;
+    frameNode->PushDestroyCallback([&destroyed]() { destroyed = true; });
+    frameNode = nullptr;
+    EXPECT_TRUE(destroyed);
+}
+
+/**
+ * @tc.name: MeasureCacheTest002
+ * @tc.desc: Test a Row flagged to layout only is measured again instead of taking the measure cache
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, MeasureCacheTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create a Row aligning two children to the end and lay it out.
+     * @tc.expected: the children are placed at the end of the Row.
+     */
+    auto rowNode = FrameNode::CreateFrameNode("measureCacheRow", 61, AceType::MakeRefPtr<LinearLayoutPattern>(false));
+    rowNode->isActive_ = true;
+    auto rowLayoutProperty = rowNode->GetLayoutProperty<LinearLayoutProperty>();
+    ASSERT_NE(rowLayoutProperty, nullptr);
+    rowLayoutProperty->UpdateMainAxisAlign(FlexAlign::FLEX_END);
+    const float childWidth = 50.0f;
+    std::vector<RefPtr<FrameNode>> children;
+    for (int32_t id = 62; id < 64; ++id) {
+        auto child = FrameNode::CreateFrameNode("measureCacheChild", id, AceType::MakeRefPtr<Pattern>());
+        child->isActive_ = true;
+        child->GetLayoutProperty()->UpdateUserDefinedIdealSize(
+            CalcSize(CalcLength(childWidth), CalcLength(childWidth)));
+        child->MountToParent(rowNode);
+        children.emplace_back(child);
+    }
+    LayoutConstraintF constraint;
+    constraint.maxSize = CONTAINER_SIZE;
+    constraint.percentReference = CONTAINER_SIZE;
+    constraint.selfIdealSize.SetSize(CONTAINER_SIZE);
+    rowNode->Measure(constraint);
+    rowNode->Layout();
+    EXPECT_EQ(children[0]->GetGeometryNode()->GetFrameOffset().GetX(), CONTAINER_WIDTH - childWidth * 2);
+    EXPECT_EQ(children[1]->GetGeometryNode()->GetFrameOffset().GetX(), CONTAINER_WIDTH - childWidth);
+
+    /**
+     * @tc.steps: step2. Start the next frame with a change that only needs layout, measure and lay out the Row.
+     * @tc.expected: the Row is measured instead of taking the cached entry, the children keep their place.
+     */
+    rowNode->layoutAlgorithm_.Reset();
+    rowLayoutProperty->CleanDirty();
+    rowLayoutProperty->UpdatePropertyChangeFlag(PROPERTY_UPDATE_LAYOUT);
+    rowNode->Measure(constraint);
+    EXPECT_FALSE(rowNode->layoutAlgorithm_->SkipMeasure());
+    EXPECT_TRUE(rowNode->layoutAlgorithm_->HasMeasured());
+    rowNode->Layout();
+    EXPECT_EQ(children[0]->GetGeometryNode()->GetFrameOffset().GetX(), CONTAINER_WIDTH - childWidth * 2);
+    EXPECT_EQ(children[1]->GetGeometryNode()->GetFrameOffset().GetX(), CONTAINER_WIDTH - childWidth);
+}
 } // namespace OHOS::Ace::NG
@@ -503,4 +503,32 @@ HWTEST_F(EventRecorderTest, EventRecorderTest009, TestSize.Level1)
 
     Recorder::EventController::Get().Unregister(observer);
 }
+
+/**
+ * @tc.name: EventRecorderTest010
+ * @tc.desc: Test exposure records are delivered in batch.
+ * @tc.type: FUNC
+ */
+HWTEST_F(EventRecorderTest, EventRecorderTest010, TestSize.Level1)
+{
+    std::string config;
+    GetConfig(config);
+    auto observer = std::make_shared<DemoUIEventObserver>();
+    Recorder::EventController::Get().Register(config, observer);
+
+    auto id = Recorder::EventRecorder::Get().InternString("btn_Grid");
+    EXPECT_EQ(Recorder::EventRecorder::Get().InternString("btn_Grid"), id);
+    auto pageUrl = Recorder::EventRecorder::Get().InternString("pages/Index");
+    EXPECT_NE(pageUrl, id);
+
+    Recorder::ExposureRecord record;
+    record.id = id;
+    record.pageUrl = pageUrl;
+    record.duration = 5000;
+    Recorder::EventRecorder::Get().OnExposure(record);
+    Recorder::EventRecorder::Get().OnExposure(record);
+    sleep(1);
+    EXPECT_EQ(observer->GetEventType(), static_cast<int32_t>(Recorder::EventType::EXPOSURE));
+    Recorder::EventController::Get().Unregister(observer);
+}
 } // namespace OHOS::Ace
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#define protected public
+#define private public
+#include "core/components/theme/app_theme.h"
+#include "core/components/theme/theme_manager_impl.h"
+#undef private
+#undef protected
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+ResourceConfiguration MakeConfig(ColorMode colorMode)
+{
+    ResourceConfiguration config;
+    config.SetColorMode(colorMode);
+    return config;
+}
+} // namespace
+
+class ThemeManagerTest : public testing::Test {};
+
+/**
+ * @tc.name: ThemeManagerTest001
+ * @tc.desc: Test themes are restored when switching back to a previous configuration.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeManagerTest, ThemeManagerTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build a theme under the light configuration.
+     */
+    auto themeManager = AceType::MakeRefPtr<ThemeManagerImpl>();
+    themeManager->UpdateConfig(MakeConfig(ColorMode::LIGHT));
+    themeManager->LoadResourceThemes();
+    auto lightTheme = themeManager->GetTheme<AppTheme>();
+    ASSERT_NE(lightTheme, nullptr);
+
+    /**
+     * @tc.steps: step2. Switch to the dark configuration.
+     * @tc.expected: the light themes are kept as a snapshot and a new theme is built.
+     */
+    themeManager->UpdateConfig(MakeConfig(ColorMode::DARK));
+    themeManager->LoadResourceThemes();
+    EXPECT_EQ(themeManager->themeSnapshots_.size(), 1);
+    auto darkTheme = themeManager->GetTheme<AppTheme>();
+    ASSERT_NE(darkTheme, nullptr);
+    EXPECT_NE(darkTheme, lightTheme);
+
+    /**
+     * @tc.steps: step3. Switch back to the light configuration.
+     * @tc.expected: the light theme is restored instead of being built again.
+     */
+    themeManager->UpdateConfig(MakeConfig(ColorMode::LIGHT));
+    themeManager->LoadResourceThemes();
+    EXPECT_EQ(themeManager->GetTheme<AppTheme>(), lightTheme);
+    EXPECT_EQ(themeManager->themeSnapshots_.size(), 1);
+
+    /**
+     * @tc.steps: step4. Reload under the same configuration.
+     * @tc.expected: the snapshots and the built themes are dropped.
+     */
+    themeManager->LoadResourceThemes();
+    EXPECT_TRUE(themeManager->themeSnapshots_.empty());
+    EXPECT_NE(themeManager->GetTheme<AppTheme>(), lightTheme);
+}
+
+/**
+ * @tc.name: ThemeManagerTest002
+ * @tc.desc: Test theme snapshots are dropped by changes the configuration key does not cover.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeManagerTest, ThemeManagerTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Build themes under the light and the dark configuration.
+     */
+    auto themeManager = AceType::MakeRefPtr<ThemeManagerImpl>();
+    themeManager->UpdateConfig(MakeConfig(ColorMode::LIGHT));
+    themeManager->LoadResourceThemes();
+    auto lightTheme = themeManager->GetTheme<AppTheme>();
+    themeManager->UpdateConfig(MakeConfig(ColorMode::DARK));
+    themeManager->LoadResourceThemes();
+    auto darkTheme = themeManager->GetTheme<AppTheme>();
+    EXPECT_EQ(themeManager->themeSnapshots_.size(), 1);
+
+    /**
+     * @tc.steps: step2. Switch to the light configuration with a new theme tag.
+     * @tc.expected: the light snapshot is not restored and the dark themes are not kept.
+     */
+    themeManager->UpdateConfig(MakeConfig(ColorMode::LIGHT), true);
+    themeManager->LoadResourceThemes();
+    EXPECT_TRUE(themeManager->themeSnapshots_.empty());
+    auto newLightTheme = themeManager->GetTheme<AppTheme>();
+    EXPECT_NE(newLightTheme, lightTheme);
+
+    /**
+     * @tc.steps: step3. Switch back to the dark configuration.
+     * @tc.expected: the dark theme built before the theme tag changed is not restored.
+     */
+    themeManager->UpdateConfig(MakeConfig(ColorMode::DARK));
+    themeManager->LoadResourceThemes();
+    EXPECT_NE(themeManager->GetTheme<AppTheme>(), darkTheme);
+
+    /**
+     * @tc.steps: step4. Change the color scheme, then switch to the light configuration.
+     * @tc.expected: the themes built before the color scheme changed are not kept.
+     */
+    themeManager->SetColorScheme(ColorScheme::SCHEME_TRANSPARENT);
+    themeManager->UpdateConfig(MakeConfig(ColorMode::LIGHT));
+    themeManager->LoadResourceThemes();
+    EXPECT_TRUE(themeManager->themeSnapshots_.empty());
+    EXPECT_NE(themeManager->GetTheme<AppTheme>(), newLightTheme);
+}
+} // namespace OHOS::Ace
@@ -5485,6 +5485,41 @@ HWTEST_F(GesturesTestNg, RecognizerGroupTest008, TestSize.Level1)
     EXPECT_TRUE(result);
 }
 
+/**
+ * @tc.name: RecognizerGroupTest009
+ * @tc.desc: Test RecognizerGroup function: OnResetStatus AddChildren
+ * @tc.type: FUNC
+ */
+HWTEST_F(GesturesTestNg, RecognizerGroupTest009, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create RecognizerGroup with one child.
+     */
+    RefPtr<ClickRecognizer> clickRecognizerPtr = AceType::MakeRefPtr<ClickRecognizer>(FINGER_NUMBER, COUNT);
+    std::vector<RefPtr<NGGestureRecognizer>> recognizers = { clickRecognizerPtr };
+    auto exclusiveRecognizerPtr = AceType::MakeRefPtr<ExclusiveRecognizer>(recognizers);
+    EXPECT_EQ(exclusiveRecognizerPtr->recognizers_.size(), 1);
+
+    /**
+     * @tc.steps: step2. call OnResetStatus.
+     * @tc.expected: step2. child is released and its list node is kept.
+     */
+    exclusiveRecognizerPtr->OnResetStatus();
+    EXPECT_EQ(exclusiveRecognizerPtr->recognizers_.size(), 0);
+    EXPECT_EQ(exclusiveRecognizerPtr->recycledNodes_.size(), 1);
+    EXPECT_EQ(exclusiveRecognizerPtr->recycledNodes_.front(), nullptr);
+    EXPECT_EQ(clickRecognizerPtr->GetGestureGroup().Upgrade(), nullptr);
+
+    /**
+     * @tc.steps: step3. call AddChildren with the child again.
+     * @tc.expected: step3. the kept list node is reused.
+     */
+    exclusiveRecognizerPtr->AddChildren({ clickRecognizerPtr });
+    EXPECT_EQ(exclusiveRecognizerPtr->recognizers_.size(), 1);
+    EXPECT_EQ(exclusiveRecognizerPtr->recycledNodes_.size(), 0);
+    EXPECT_EQ(AceType::RawPtr(exclusiveRecognizerPtr->recognizers_.front()), AceType::RawPtr(clickRecognizerPtr));
+}
+
 /**
  * @tc.name: RotationRecognizerTest001
  * @tc.desc: Test RotationRecognizer function: OnAccepted OnRejected
@@ -9404,6 +9439,43 @@ HWTEST_F(GesturesTestNg, GestureRefereeTest018, TestSize.Level1)
     EXPECT_EQ(result, true);
 }
 
+/**
+ * @tc.name: GestureRefereeTest019
+ * @tc.desc: Test GestureReferee reuses closed GestureScope
+ */
+HWTEST_F(GesturesTestNg, GestureRefereeTest019, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create GestureReferee and add a scope for touch 0.
+     */
+    GestureReferee gestureReferee;
+    TouchTestResult touchTestResult;
+    gestureReferee.AddGestureToScope(0, touchTestResult);
+    EXPECT_EQ(gestureReferee.gestureScopes_.size(), 1);
+    auto scope = gestureReferee.gestureScopes_[0];
+
+    /**
+     * @tc.steps: step2. call CleanGestureScope while the scope is still referenced.
+     * @tc.expected: the scope is not pooled.
+     */
+    gestureReferee.CleanGestureScope(0);
+    EXPECT_EQ(gestureReferee.gestureScopes_.size(), 0);
+    EXPECT_EQ(gestureReferee.scopePool_.size(), 0);
+
+    /**
+     * @tc.steps: step3. add and clean a scope only held by the referee.
+     * @tc.expected: the scope is pooled and reused by the next touch.
+     */
+    scope = nullptr;
+    gestureReferee.AddGestureToScope(1, touchTestResult);
+    gestureReferee.CleanGestureScope(1);
+    EXPECT_EQ(gestureReferee.scopePool_.size(), 1);
+    gestureReferee.AddGestureToScope(2, touchTestResult);
+    EXPECT_EQ(gestureReferee.scopePool_.size(), 0);
+    EXPECT_EQ(gestureReferee.gestureScopes_[2]->touchId_, 2);
+    EXPECT_FALSE(gestureReferee.gestureScopes_[2]->IsDelayClosed());
+}
+
 /**
  * @tc.name: LongPressGestureTest001
  * @tc.desc: Test LongPressGesture CreateRecognizer function
@@ -12653,4 +12725,108 @@ HWTEST_F(GesturesTestNg, TransformTest003, TestSize.Level1)
     PointF f2(-531.471924, 1362.610352);
     EXPECT_EQ(f1, f2);
 }
+
+/**
+ * @tc.name: PanRecognizerTouchPredictionTest001
+ * @tc.desc: Test PanRecognizer takes the predicted offset back when the finger is lifted
+ * @tc.type: FUNC
+ */
+HWTEST_F(GesturesTestNg, PanRecognizerTouchPredictionTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create PanRecognizer with touch prediction enabled and accept it.
+     */
+    RefPtr<PanGestureOption> panGestureOption = AceType::MakeRefPtr<PanGestureOption>();
+    PanRecognizer panRecognizer = PanRecognizer(panGestureOption);
+    panRecognizer.SetTouchPredictionEnabled(true);
+    Offset totalDelta;
+    bool isEnded = false;
+    panRecognizer.SetOnActionUpdate([&totalDelta](GestureEvent& info) { totalDelta += info.GetDelta(); });
+    panRecognizer.SetOnActionEnd([&isEnded](GestureEvent& /* info */) { isEnded = true; });
+    TouchEvent downEvent;
+    panRecognizer.HandleTouchDownEvent(downEvent);
+    panRecognizer.refereeState_ = RefereeState::SUCCEED;
+    panRecognizer.currentFingers_ = 1;
+    panRecognizer.fingers_ = 1;
+    panRecognizer.isFlushTouchEventsEnd_ = true;
+
+    /**
+     * @tc.steps: step2. move twice with predicted offsets.
+     * @tc.expected: step2. the pan is moved to the predicted positions.
+     */
+    TouchEvent moveEvent;
+    moveEvent.x = 10.0f;
+    moveEvent.predictedOffset = Offset(5.0, 0.0);
+    panRecognizer.HandleTouchMoveEvent(moveEvent);
+    EXPECT_EQ(totalDelta, Offset(15.0, 0.0));
+    moveEvent.x = 20.0f;
+    moveEvent.predictedOffset = Offset(8.0, 0.0);
+    panRecognizer.HandleTouchMoveEvent(moveEvent);
+    EXPECT_EQ(totalDelta, Offset(28.0, 0.0));
+
+    /**
+     * @tc.steps: step3. lift the finger.
+     * @tc.expected: step3. the summed deltas equal the real displacement before the pan ends.
+     */
+    TouchEvent upEvent;
+    upEvent.x = 22.0f;
+    panRecognizer.HandleTouchUpEvent(upEvent);
+    EXPECT_TRUE(isEnded);
+    EXPECT_EQ(totalDelta, Offset(22.0, 0.0));
+    EXPECT_TRUE(panRecognizer.predictedOffsets_.empty());
+}
+
+/**
+ * @tc.name: PanRecognizerTouchPredictionTest002
+ * @tc.desc: Test PanRecognizer takes the predicted offset back when the touch is canceled
+ * @tc.type: FUNC
+ */
+HWTEST_F(GesturesTestNg, PanRecognizerTouchPredictionTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create PanRecognizer with touch prediction enabled and accept it.
+     */
+    RefPtr<PanGestureOption> panGestureOption = AceType::MakeRefPtr<PanGestureOption>();
+    PanRecognizer panRecognizer = PanRecognizer(panGestureOption);
+    panRecognizer.SetTouchPredictionEnabled(true);
+    Offset totalDelta;
+    bool isCanceled = false;
+    panRecognizer.SetOnActionUpdate([&totalDelta](GestureEvent& info) { totalDelta += info.GetDelta(); });
+    panRecognizer.SetOnActionCancel([&isCanceled]() { isCanceled = true; });
+    TouchEvent downEvent;
+    panRecognizer.HandleTouchDownEvent(downEvent);
+    panRecognizer.refereeState_ = RefereeState::SUCCEED;
+    panRecognizer.currentFingers_ = 1;
+    panRecognizer.fingers_ = 1;
+    panRecognizer.isFlushTouchEventsEnd_ = true;
+
+    /**
+     * @tc.steps: step2. move with a predicted offset, then cancel the touch.
+     * @tc.expected: step2. the summed deltas equal the real displacement before the pan is canceled.
+     */
+    TouchEvent moveEvent;
+    moveEvent.y = 10.0f;
+    moveEvent.predictedOffset = Offset(0.0, 6.0);
+    panRecognizer.HandleTouchMoveEvent(moveEvent);
+    EXPECT_EQ(totalDelta, Offset(0.0, 16.0));
+    TouchEvent cancelEvent;
+    cancelEvent.y = 12.0f;
+    panRecognizer.HandleTouchCancelEvent(cancelEvent);
+    EXPECT_TRUE(isCanceled);
+    EXPECT_EQ(totalDelta, Offset(0.0, 12.0));
+
+    /**
+     * @tc.steps: step3. move without prediction and lift the finger.
+     * @tc.expected: step3. no extra update is sent.
+     */
+    panRecognizer.SetTouchPredictionEnabled(false);
+    panRecognizer.refereeState_ = RefereeState::SUCCEED;
+    moveEvent.y = 20.0f;
+    panRecognizer.HandleTouchMoveEvent(moveEvent);
+    EXPECT_EQ(totalDelta, Offset(0.0, 20.0));
+    TouchEvent upEvent;
+    upEvent.y = 20.0f;
+    panRecognizer.HandleTouchUpEvent(upEvent);
+    EXPECT_EQ(totalDelta, Offset(0.0, 20.0));
+}
 } // namespace OHOS::Ace::NG
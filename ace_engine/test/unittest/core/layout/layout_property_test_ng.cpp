@@ -25,6 +25,7 @@
 #include "core/components/common/layout/constants.h"
 #include "core/components/common/layout/grid_system_manager.h"
 #include "core/components_ng/layout/layout_property.h"
+#include "core/components_ng/pattern/flex/flex_layout_property.h"
 #include "core/components_ng/property/calc_length.h"
 #include "core/components_ng/property/measure_property.h"
 #include "core/components_ng/property/safe_area_insets.h"
@@ -1981,4 +1982,90 @@ HWTEST_F(LayoutPropertyTestNg, ConstraintEqual002, TestSize.Level1)
     bResult = layoutProperty->ConstraintEqual(preLayoutTemp, preContentTemp); // 1080
     EXPECT_TRUE(bResult);
 }
+
+/**
+ * @tc.name: CloneShareGroup001
+ * @tc.desc: Test the property groups are shared by Clone until modified
+ * @tc.type: FUNC
+ */
+HWTEST_F(LayoutPropertyTestNg, CloneShareGroup001, TestSize.Level1)
+{
+    /**
+     * @tc.steps1 Create a layoutProperty with padding and size, then clone it.
+     * @tc.expected: the clone shares the groups of layoutProperty.
+     */
+    auto layoutProperty = AceType::MakeRefPtr<LayoutProperty>();
+    layoutProperty->UpdatePadding(MakePadding());
+    layoutProperty->UpdateUserDefinedIdealSize(CALC_SIZE);
+    auto result = layoutProperty->Clone();
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetPaddingProperty().get(), layoutProperty->GetPaddingProperty().get());
+    EXPECT_EQ(result->GetCalcLayoutConstraint().get(), layoutProperty->GetCalcLayoutConstraint().get());
+
+    /**
+     * @tc.steps2 Update the padding of layoutProperty.
+     * @tc.expected: layoutProperty owns a new padding, the clone keeps the old one and still shares the size.
+     */
+    PaddingProperty padding;
+    padding.left = CalcLength(HEIGHT);
+    layoutProperty->UpdatePadding(padding);
+    EXPECT_NE(result->GetPaddingProperty().get(), layoutProperty->GetPaddingProperty().get());
+    EXPECT_EQ(layoutProperty->GetPaddingProperty()->left, CalcLength(HEIGHT));
+    EXPECT_EQ(result->GetPaddingProperty()->left, CalcLength(WIDTH));
+    EXPECT_EQ(result->GetCalcLayoutConstraint().get(), layoutProperty->GetCalcLayoutConstraint().get());
+
+    /**
+     * @tc.steps3 Clear the size of the clone.
+     * @tc.expected: layoutProperty keeps its size.
+     */
+    result->ClearUserDefinedIdealSize(true, true);
+    ASSERT_NE(layoutProperty->GetCalcLayoutConstraint(), nullptr);
+    EXPECT_EQ(layoutProperty->GetCalcLayoutConstraint()->selfIdealSize, CALC_SIZE);
+}
+
+/**
+ * @tc.name: CloneShareGroup002
+ * @tc.desc: Test the property groups stay shared when they are set again with the same values
+ * @tc.type: FUNC
+ */
+HWTEST_F(LayoutPropertyTestNg, CloneShareGroup002, TestSize.Level1)
+{
+    /**
+     * @tc.steps1 Create a flexLayoutProperty with groups, then clone it.
+     * @tc.expected: the clone shares the groups of flexLayoutProperty.
+     */
+    auto layoutProperty = AceType::MakeRefPtr<FlexLayoutProperty>();
+    layoutProperty->UpdatePadding(MakePadding());
+    layoutProperty->UpdateUserDefinedIdealSize(CALC_SIZE);
+    layoutProperty->UpdateFlexGrow(1.0f);
+    layoutProperty->UpdateMainAxisAlign(FlexAlign::CENTER);
+    auto result = AceType::DynamicCast<FlexLayoutProperty>(layoutProperty->Clone());
+    ASSERT_NE(result, nullptr);
+    EXPECT_EQ(result->GetFlexLayoutAttribute().get(), layoutProperty->GetFlexLayoutAttribute().get());
+
+    /**
+     * @tc.steps2 Set the same values again and reset values that are not set.
+     * @tc.expected: nothing is flagged and the groups are still shared.
+     */
+    layoutProperty->CleanDirty();
+    layoutProperty->UpdatePadding(MakePadding());
+    layoutProperty->UpdateUserDefinedIdealSize(CALC_SIZE);
+    layoutProperty->UpdateFlexGrow(1.0f);
+    layoutProperty->ResetFlexShrink();
+    layoutProperty->UpdateMainAxisAlign(FlexAlign::CENTER);
+    EXPECT_EQ(layoutProperty->GetPropertyChangeFlag(), PROPERTY_UPDATE_NORMAL);
+    EXPECT_EQ(result->GetPaddingProperty().get(), layoutProperty->GetPaddingProperty().get());
+    EXPECT_EQ(result->GetCalcLayoutConstraint().get(), layoutProperty->GetCalcLayoutConstraint().get());
+    EXPECT_EQ(result->GetFlexItemProperty().get(), layoutProperty->GetFlexItemProperty().get());
+    EXPECT_EQ(result->GetFlexLayoutAttribute().get(), layoutProperty->GetFlexLayoutAttribute().get());
+
+    /**
+     * @tc.steps3 Set a new main axis alignment.
+     * @tc.expected: flexLayoutProperty owns a new group, the clone keeps the old value.
+     */
+    layoutProperty->UpdateMainAxisAlign(FlexAlign::FLEX_END);
+    EXPECT_NE(result->GetFlexLayoutAttribute().get(), layoutProperty->GetFlexLayoutAttribute().get());
+    EXPECT_EQ(result->GetMainAxisAlignValue(FlexAlign::FLEX_START), FlexAlign::CENTER);
+    EXPECT_EQ(layoutProperty->GetMainAxisAlignValue(FlexAlign::FLEX_START), FlexAlign::FLEX_END);
+}
 } // namespace OHOS::Ace::NG
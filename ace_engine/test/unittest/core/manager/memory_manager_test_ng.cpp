@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "gtest/gtest.h"
+
+#define private public
+#define protected public
+#include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/manager/memory/memory_manager.h"
+#include "core/components_ng/pattern/pattern.h"
+#include "test/mock/core/pipeline/mock_pipeline_context.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t FIRST_PAGE_ID = 1001;
+constexpr int32_t SECOND_PAGE_ID = 1002;
+constexpr int32_t FIRST_NODE_ID = 1003;
+constexpr int32_t SECOND_NODE_ID = 1004;
+constexpr size_t FIRST_BYTES = 100;
+constexpr size_t SECOND_BYTES = 200;
+constexpr size_t BUDGET = 250;
+const std::string PAGE_TAG = "page";
+const std::string NODE_TAG = "node";
+
+class TrimPattern : public Pattern {
+    DECLARE_ACE_TYPE(TrimPattern, Pattern);
+
+public:
+    void OnNotifyMemoryLevel(int32_t level) override
+    {
+        trimmed_ = true;
+        MockPipelineContext::GetCurrent()->GetMemoryManager()->UpdateUsage(GetHost(), MemoryCategory::IMAGE, 0);
+    }
+
+    bool trimmed_ = false;
+};
+} // namespace
+
+class MemoryManagerTestNg : public testing::Test {
+public:
+    static void SetUpTestSuite()
+    {
+        MockPipelineContext::SetUp();
+    }
+
+    static void TearDownTestSuite()
+    {
+        MockPipelineContext::TearDown();
+    }
+};
+
+/**
+ * @tc.name: MemoryManagerTest001
+ * @tc.desc: Test the ledger is grouped by page and the coldest page is trimmed first.
+ * @tc.type: FUNC
+ */
+HWTEST_F(MemoryManagerTestNg, MemoryManagerTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create two pages with one node each, show the first page then the second one.
+     */
+    auto manager = MockPipelineContext::GetCurrent()->GetMemoryManager();
+    ASSERT_NE(manager, nullptr);
+    auto firstPage = FrameNode::CreateFrameNode(PAGE_TAG, FIRST_PAGE_ID, AceType::MakeRefPtr<Pattern>());
+    auto secondPage = FrameNode::CreateFrameNode(PAGE_TAG, SECOND_PAGE_ID, AceType::MakeRefPtr<Pattern>());
+    auto firstNode = FrameNode::CreateFrameNode(NODE_TAG, FIRST_NODE_ID, AceType::MakeRefPtr<TrimPattern>());
+    auto secondNode = FrameNode::CreateFrameNode(NODE_TAG, SECOND_NODE_ID, AceType::MakeRefPtr<TrimPattern>());
+    firstPage->AddChild(firstNode);
+    secondPage->AddChild(secondNode);
+    manager->OnPageShow(FIRST_PAGE_ID);
+    manager->OnPageShow(SECOND_PAGE_ID);
+
+    /**
+     * @tc.steps: step2. report memory of the nodes.
+     * @tc.expected: bytes are accounted to the pages, reporting again replaces the old record.
+     */
+    manager->UpdateUsage(firstNode, MemoryCategory::IMAGE, FIRST_BYTES);
+    manager->UpdateUsage(secondNode, MemoryCategory::IMAGE, FIRST_BYTES);
+    manager->UpdateUsage(secondNode, MemoryCategory::IMAGE, SECOND_BYTES);
+    EXPECT_EQ(manager->GetPageBytes(FIRST_PAGE_ID), FIRST_BYTES);
+    EXPECT_EQ(manager->GetPageBytes(SECOND_PAGE_ID), SECOND_BYTES);
+    EXPECT_EQ(manager->GetTotalBytes(), FIRST_BYTES + SECOND_BYTES);
+
+    /**
+     * @tc.steps: step3. trim with moderate level.
+     * @tc.expected: only the background page is trimmed, which is enough to fit the budget.
+     */
+    manager->SetBudget(BUDGET);
+    manager->TrimMemory(MEMORY_LEVEL_MODERATE);
+    EXPECT_TRUE(firstNode->GetPattern<TrimPattern>()->trimmed_);
+    EXPECT_FALSE(secondNode->GetPattern<TrimPattern>()->trimmed_);
+    EXPECT_EQ(manager->GetTotalBytes(), SECOND_BYTES);
+
+    /**
+     * @tc.steps: step4. trim with critical level.
+     * @tc.expected: the top page is trimmed as well.
+     */
+    manager->TrimMemory(MEMORY_LEVEL_CRITICAL);
+    EXPECT_TRUE(secondNode->GetPattern<TrimPattern>()->trimmed_);
+    EXPECT_EQ(manager->GetTotalBytes(), 0u);
+    manager->SetBudget(DEFAULT_MEMORY_BUDGET);
+}
+} // namespace OHOS::Ace::NG
@@ -1019,7 +1019,8 @@ HWTEST_F(CustomTestNg, CustomTest022, TestSize.Level1)
     /**
      * @tc.steps: step4. Set up the created frameNode.
      */
-    ElementRegister::GetInstance()->itemMap_[nodeId] = frameNode;
+    ElementRegister::GetInstance()->itemMap_.Erase(nodeId);
+    ElementRegister::GetInstance()->itemMap_.Emplace(nodeId, frameNode);
 
     /**
      * @tc.steps: step5. Call Measure.
@@ -511,4 +511,76 @@ HWTEST_F(CanvasPaintMethodTestNg, CanvasPaintMethodTestNg013, TestSize.Level1)
     EXPECT_NE(paintMethod_->uploadSuccessCallback_, nullptr);
     EXPECT_NE(paintMethod_->onPostBackgroundTask_, nullptr);
 }
+
+/**
+ * @tc.name: CanvasPaintMethodTestNg014
+ * @tc.desc: Test the command list of CanvasPaintMethod.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CanvasPaintMethodTestNg, CanvasPaintMethodTestNg014, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: initialize parameters.
+     */
+    ASSERT_NE(paintMethod_, nullptr);
+    paintMethod_->tasks_.Clear();
+    EXPECT_FALSE(paintMethod_->HasTask());
+
+    /**
+     * @tc.steps2: push a run of the same command.
+     * @tc.expected: the run is stored as one record.
+     */
+    paintMethod_->PushCommand(CanvasCommand::MOVE_TO, { DEFAULT_DOUBLE0, DEFAULT_DOUBLE0 });
+    paintMethod_->PushCommand(CanvasCommand::LINE_TO, { DEFAULT_DOUBLE1, DEFAULT_DOUBLE1 });
+    paintMethod_->PushCommand(CanvasCommand::LINE_TO, { DEFAULT_DOUBLE10, DEFAULT_DOUBLE10 });
+    EXPECT_TRUE(paintMethod_->HasTask());
+    EXPECT_EQ(paintMethod_->tasks_.RecordCount(), 2u);
+
+    /**
+     * @tc.steps3: push a task and a command with a wrong number of arguments.
+     * @tc.expected: the task is recorded and the wrong command is dropped.
+     */
+    paintMethod_->PushTask([](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {});
+    paintMethod_->PushCommand(CanvasCommand::FILL_RECT, { DEFAULT_DOUBLE1 });
+    EXPECT_EQ(paintMethod_->tasks_.RecordCount(), 3u);
+    EXPECT_EQ(paintMethod_->tasks_.args_.size(), 6u);
+
+    paintMethod_->tasks_.Clear();
+    EXPECT_FALSE(paintMethod_->HasTask());
+}
+
+/**
+ * @tc.name: CanvasPaintMethodTestNg015
+ * @tc.desc: Test the replay of the command list when a task records more tasks.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CanvasPaintMethodTestNg, CanvasPaintMethodTestNg015, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: push a task which records another task when it is replayed.
+     */
+    ASSERT_NE(paintMethod_, nullptr);
+    paintMethod_->tasks_.Clear();
+    int32_t callCount = 0;
+    auto& commandList = paintMethod_->tasks_;
+    commandList.PushTask([&callCount, &commandList](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
+        ++callCount;
+        commandList.PushTask([&callCount](CanvasPaintMethod& paintMethod, PaintWrapper* paintWrapper) {
+            ++callCount;
+        });
+    });
+    EXPECT_EQ(commandList.RecordCount(), 1u);
+
+    /**
+     * @tc.steps2: replay the command list.
+     * @tc.expected: the task recorded during the replay is counted into the same record and is run as well.
+     */
+    commandList.Replay(*paintMethod_, nullptr);
+    EXPECT_EQ(callCount, 2);
+    EXPECT_EQ(commandList.RecordCount(), 1u);
+    EXPECT_EQ(commandList.records_.back().count, 2u);
+
+    commandList.Clear();
+    EXPECT_FALSE(paintMethod_->HasTask());
+}
 } // namespace OHOS::Ace::NG
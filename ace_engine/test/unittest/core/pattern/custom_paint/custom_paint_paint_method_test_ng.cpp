@@ -898,4 +898,41 @@ HWTEST_F(CustomPaintPaintMethodTestNg, CustomPaintPaintMethodTestNg022, TestSize
     EXPECT_EQ(matrix.getTranslateX(), pattern.GetTranslateX());
     EXPECT_EQ(matrix.getTranslateY(), pattern.GetTranslateY());
 }
+
+/**
+ * @tc.name: CustomPaintPaintMethodTestNg023
+ * @tc.desc: Test the pixel conversion of ImageData.
+ * @tc.type: FUNC
+ */
+HWTEST_F(CustomPaintPaintMethodTestNg, CustomPaintPaintMethodTestNg023, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: convert RGBA bytes to BGRA pixels.
+     * @tc.expected: the pixels are equal to the values of the colors.
+     */
+    const uint8_t rgba[] = { 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88 };
+    uint32_t bgra[2] = { 0 };
+    ConvertRgbaToBgra(rgba, bgra, 2);
+    EXPECT_EQ(bgra[0], Color::FromARGB(0x44, 0x11, 0x22, 0x33).GetValue());
+    EXPECT_EQ(bgra[1], Color::FromARGB(0x88, 0x55, 0x66, 0x77).GetValue());
+
+    /**
+     * @tc.steps2: convert the pixels back.
+     * @tc.expected: the bytes are equal to the source.
+     */
+    uint8_t result[8] = { 0 };
+    ConvertBgraToRgba(bgra, result, 2);
+    for (size_t i = 0; i < sizeof(rgba); ++i) {
+        EXPECT_EQ(result[i], rgba[i]);
+    }
+
+    /**
+     * @tc.steps3: pack the BGRA bytes of a bitmap.
+     * @tc.expected: the pixels are equal to the values of the colors.
+     */
+    const uint8_t bitmapBytes[] = { 0x33, 0x22, 0x11, 0x44 };
+    uint32_t pixel = 0;
+    PackBgraBytes(bitmapBytes, &pixel, 1);
+    EXPECT_EQ(pixel, Color::FromARGB(0x44, 0x11, 0x22, 0x33).GetValue());
+}
 } // namespace OHOS::Ace::NG
@@ -299,7 +299,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg006, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -309,36 +309,36 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg006, TestSize.Level1)
     customPattern->FillText(DEFAULT_STR, DEFAULT_DOUBLE0, DEFAULT_DOUBLE0, std::optional<double>(0));
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->StrokeText(DEFAULT_STR, DEFAULT_DOUBLE0, DEFAULT_DOUBLE0, std::optional<double>(0));
     EXPECT_TRUE(paintMethod->HasTask());
 
     TextAlign textAlign = TextAlign::CENTER;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateTextAlign(textAlign);
     EXPECT_TRUE(paintMethod->HasTask());
 
     TextBaseline textBaseline = TextBaseline::ALPHABETIC;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateTextBaseline(textBaseline);
     EXPECT_TRUE(paintMethod->HasTask());
 
     FontWeight weight = FontWeight::BOLD;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateFontWeight(weight);
     EXPECT_TRUE(paintMethod->HasTask());
 
     FontStyle style = FontStyle::ITALIC;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateFontStyle(style);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateFontFamilies(FONT_FAMILY);
     EXPECT_TRUE(paintMethod->HasTask());
 
     Dimension size;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateFontSize(size);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -358,7 +358,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg007, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -369,22 +369,22 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg007, TestSize.Level1)
     customPattern->SetTransform(param);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->ResetTransform();
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Transform(param);
     EXPECT_TRUE(paintMethod->HasTask());
 
     customPattern->Scale(DEFAULT_DOUBLE0, DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Translate(DEFAULT_DOUBLE0, DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Rotate(DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -404,7 +404,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg008, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -415,15 +415,15 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg008, TestSize.Level1)
     customPattern->FillRect(rect);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->StrokeRect(rect);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->ClearRect(rect);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->AddRect(rect);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -443,7 +443,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg09, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -454,15 +454,15 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg09, TestSize.Level1)
     customPattern->UpdateShadowColor(color);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateShadowBlur(DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateShadowOffsetX(DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateShadowOffsetY(DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -482,7 +482,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg010, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -493,22 +493,22 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg010, TestSize.Level1)
     customPattern->Stroke(path);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Stroke();
     EXPECT_TRUE(paintMethod->HasTask());
 
     std::shared_ptr<Ace::Pattern> pattern = std::make_shared<Ace::Pattern>();
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateStrokePattern(pattern);
     EXPECT_TRUE(paintMethod->HasTask());
 
     Color color = Color::BLACK;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateStrokeColor(color);
     EXPECT_TRUE(paintMethod->HasTask());
 
     Ace::Gradient gradient;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateStrokeGradient(gradient);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -528,7 +528,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg011, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -539,31 +539,31 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg011, TestSize.Level1)
     customPattern->Stroke(path);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Stroke();
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Fill();
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Fill(path);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Clip();
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Clip(path);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->BeginPath();
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->ClosePath();
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -583,7 +583,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg012, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -594,24 +594,24 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg012, TestSize.Level1)
     EXPECT_TRUE(paintMethod->HasTask());
 
     LineCapStyle lineCapStyle = LineCapStyle::BUTT;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateLineCap(lineCapStyle);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateLineDashOffset(DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateLineDash(CANDIDATE_DOUBLES);
     EXPECT_TRUE(paintMethod->HasTask());
 
     LineJoinStyle LineJoinStyle = LineJoinStyle::BEVEL;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateLineJoin(LineJoinStyle);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateLineWidth(DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -631,7 +631,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg013, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -642,26 +642,26 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg013, TestSize.Level1)
     customPattern->UpdateCompositeOperation(compositeOperation);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateGlobalAlpha(DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateMiterLimit(DEFAULT_DOUBLE0);
     EXPECT_TRUE(paintMethod->HasTask());
 
     Color color;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateFillColor(color);
     EXPECT_TRUE(paintMethod->HasTask());
 
     Ace::Gradient gradient;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateFillGradient(gradient);
     EXPECT_TRUE(paintMethod->HasTask());
 
     std::shared_ptr<Ace::Pattern> pattern = std::make_shared<Ace::Pattern>();
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateFillPattern(pattern);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -681,7 +681,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg014, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -693,17 +693,17 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg014, TestSize.Level1)
     EXPECT_TRUE(paintMethod->HasTask());
 
     RefPtr<PixelMap> pixelMap(nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->DrawPixelMap(pixelMap, canvasImage);
     EXPECT_TRUE(paintMethod->HasTask());
 
     Ace::ImageData imageData;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->PutImageData(imageData);
     EXPECT_TRUE(paintMethod->HasTask());
 
     RefPtr<OffscreenCanvasPattern> offscreenCanvasPattern;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->TransferFromImageBitmap(offscreenCanvasPattern);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -723,7 +723,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg015, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -735,26 +735,26 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg015, TestSize.Level1)
     EXPECT_TRUE(paintMethod->HasTask());
 
     ArcToParam arcToParam;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->ArcTo(arcToParam);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->MoveTo(DEFAULT_DOUBLE1, DEFAULT_DOUBLE1);
     EXPECT_TRUE(paintMethod->HasTask());
 
     EllipseParam ellipseParam;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->Ellipse(ellipseParam);
     EXPECT_TRUE(paintMethod->HasTask());
 
     BezierCurveParam bezierCurveParam;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->BezierCurveTo(bezierCurveParam);
     EXPECT_TRUE(paintMethod->HasTask());
 
     QuadraticCurveParam quadraticCurveParam;
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->QuadraticCurveTo(quadraticCurveParam);
     EXPECT_TRUE(paintMethod->HasTask());
 }
@@ -774,7 +774,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg016, TestSize.Level1)
     ASSERT_NE(customPattern, nullptr);
     auto paintMethod = AceType::DynamicCast<CanvasPaintMethod>(customPattern->CreateNodePaintMethod());
     ASSERT_NE(paintMethod, nullptr);
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     EXPECT_FALSE(paintMethod->HasTask());
 
     /**
@@ -785,7 +785,7 @@ HWTEST_F(CustomPaintPatternTestNg, CustomPaintPatternTestNg016, TestSize.Level1)
     customPattern->UpdateFillRuleForPath(rule);
     EXPECT_TRUE(paintMethod->HasTask());
 
-    paintMethod->tasks_.clear();
+    paintMethod->tasks_.Clear();
     customPattern->UpdateFillRuleForPath2D(rule);
     EXPECT_TRUE(paintMethod->HasTask());
 }
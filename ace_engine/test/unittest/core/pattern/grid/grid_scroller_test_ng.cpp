@@ -789,6 +789,42 @@ HWTEST_F(GridScrollerTestNg, UpdateCurrentOffset001, TestSize.Level1)
     EXPECT_TRUE(IsEqualCurrentOffset(-200.f));
 }
 
+/**
+ * @tc.name: GetPredictBuildParam001
+ * @tc.desc: Test grid pattern GetPredictBuildParam function
+ * @tc.type: FUNC
+ */
+HWTEST_F(GridScrollerTestNg, GetPredictBuildParam001, TestSize.Level1)
+{
+    Create([](GridModelNG model) {
+        model.SetColumnsTemplate("1fr 1fr 1fr 1fr");
+        CreateColItem(20);
+    });
+
+    /**
+     * @tc.steps: step1. Fling towards start at top.
+     * @tc.expected: Nothing to prebuild.
+     */
+    EXPECT_FALSE(pattern_->GetPredictBuildParam(ITEM_HEIGHT).has_value());
+
+    /**
+     * @tc.steps: step2. Fling one line towards end.
+     * @tc.expected: The next line after the viewport is prebuilt first.
+     */
+    auto param = pattern_->GetPredictBuildParam(-ITEM_HEIGHT);
+    ASSERT_TRUE(param.has_value());
+    EXPECT_EQ(param->items.front(), pattern_->GetGridLayoutInfo().endIndex_ + 1);
+    EXPECT_LE(static_cast<int32_t>(param->items.size()), 4);
+
+    /**
+     * @tc.steps: step3. Fling far beyond the last item.
+     * @tc.expected: Items are clamped to the children count.
+     */
+    param = pattern_->GetPredictBuildParam(-ITEM_HEIGHT * 100);
+    ASSERT_TRUE(param.has_value());
+    EXPECT_EQ(param->items.back(), 19);
+}
+
 /**
  * @tc.name: GridEventTestNg001
  * @tc.desc: Test scroll callback
@@ -1114,7 +1114,8 @@ HWTEST_F(ImageAnimatorTestNg, ImageAnimatorTest017, TestSize.Level1)
     CHECK_NULL_VOID(imageNode);
     frameNode->AddChild(imageNode);
     frameNode->tag_ = V2::IMAGE_ANIMATOR_ETS_TAG;
-    ElementRegister::GetInstance()->itemMap_[nodeId] = frameNode;
+    ElementRegister::GetInstance()->itemMap_.Erase(nodeId);
+    ElementRegister::GetInstance()->itemMap_.Emplace(nodeId, frameNode);
     imageAnimatorModelNG.Create();
     EXPECT_FALSE(frameNode->GetChildren().empty());
 }
@@ -1282,4 +1283,37 @@ HWTEST_F(ImageAnimatorTestNg, ImageAnimatorTest021, TestSize.Level1)
     EXPECT_FALSE(maxWidth.IsValid());
     EXPECT_TRUE(maxHeight.IsValid());
 }
+
+/**
+ * @tc.name: ImageAnimatorTest022
+ * @tc.desc: Test the number of cache images follows preDecode and the memory of the decoded images.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageAnimatorTestNg, ImageAnimatorTest022, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create imageAnimator with 5 images and set preDecode 3.
+     * @tc.expected: 3 cache images decode the next frames.
+     */
+    CreateImageAnimator(5);
+    pattern_->SetPreDecode(3);
+    pattern_->OnModifyDone();
+    EXPECT_EQ(pattern_->cacheImages_.size(), 3);
+
+    /**
+     * @tc.steps: step2. set preDecode more than the number of images.
+     * @tc.expected: all images except the showing one are cached.
+     */
+    pattern_->SetPreDecode(10);
+    pattern_->OnModifyDone();
+    EXPECT_EQ(pattern_->cacheImages_.size(), 4);
+
+    /**
+     * @tc.steps: step3. enlarge imageAnimator so that only one decoded image fits the memory limit.
+     * @tc.expected: only one cache image is kept.
+     */
+    frameNode_->GetGeometryNode()->SetFrameSize(SizeF(4096.0f, 4096.0f));
+    pattern_->OnModifyDone();
+    EXPECT_EQ(pattern_->cacheImages_.size(), 1);
+}
 } // namespace OHOS::Ace::NG
\ No newline at end of file
@@ -3392,4 +3392,38 @@ HWTEST_F(NavigationTestNg, NavDestinationDialogTest003, TestSize.Level1)
     EXPECT_NE(layoutPropertyC, nullptr);
     EXPECT_EQ(layoutPropertyC->GetVisibilityValue(VisibleType::VISIBLE), VisibleType::VISIBLE);
 }
+
+/**
+ * @tc.name: NavigationStackPrebuildTest001
+ * @tc.desc: Test the NavDestinations prebuilt for a route are taken once and bounded.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NavigationTestNg, NavigationStackPrebuildTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. prebuild NavDestinations for three routes.
+     * @tc.expected: only the last two are kept.
+     */
+    auto navigationStack = AceType::MakeRefPtr<NavigationStack>();
+    std::vector<RefPtr<RouteInfo>> routeInfos;
+    std::vector<RefPtr<NavDestinationGroupNode>> navDestinations;
+    for (int32_t i = 0; i < 3; ++i) {
+        routeInfos.emplace_back(AceType::MakeRefPtr<RouteInfo>());
+        navDestinations.emplace_back(NavDestinationGroupNode::GetOrCreateGroupNode(V2::NAVDESTINATION_VIEW_ETS_TAG,
+            ElementRegister::GetInstance()->MakeUniqueId(),
+            []() { return AceType::MakeRefPtr<NavDestinationPattern>(); }));
+        navigationStack->AddPrebuiltNode(routeInfos[i], navDestinations[i]);
+    }
+    EXPECT_FALSE(navigationStack->HasPrebuiltNode(routeInfos[0]));
+    EXPECT_TRUE(navigationStack->HasPrebuiltNode(routeInfos[1]));
+    EXPECT_TRUE(navigationStack->HasPrebuiltNode(routeInfos[2]));
+
+    /**
+     * @tc.steps: step2. take the NavDestination of a route twice.
+     * @tc.expected: it is returned only once.
+     */
+    EXPECT_EQ(navigationStack->TakePrebuiltNode(routeInfos[2]), navDestinations[2]);
+    EXPECT_EQ(navigationStack->TakePrebuiltNode(routeInfos[2]), nullptr);
+    EXPECT_EQ(navigationStack->TakePrebuiltNode(routeInfos[0]), nullptr);
+}
 } // namespace OHOS::Ace::NG
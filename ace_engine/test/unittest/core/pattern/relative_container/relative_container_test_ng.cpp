@@ -19,6 +19,7 @@
 #include "relative_container_common_ng.h"
 #include "test/mock/core/pipeline/mock_pipeline_context.h"
 
+#define private public
 #include "base/memory/ace_type.h"
 #include "base/memory/referenced.h"
 #include "core/components/common/layout/constants.h"
@@ -1557,4 +1558,84 @@ HWTEST_F(RelativeContainerTestNg, BiasRulesTest005, TestSize.Level1)
     EXPECT_EQ(secondLayoutWrapper->GetGeometryNode()->GetFrameSize(), CONTAINER_SIZE);
     EXPECT_EQ(secondLayoutWrapper->GetGeometryNode()->GetFrameOffset(), OffsetF(300.0f, 300.0f));
 }
+
+/**
+ * @tc.name: RelativeContainerLayoutPlanTest001
+ * @tc.desc: Check the layout plan is compiled in dependency order and kept until the align rules change.
+ * @tc.type: FUNC
+ */
+HWTEST_F(RelativeContainerTestNg, RelativeContainerLayoutPlanTest001, TestSize.Level1)
+{
+    auto relativeContainerFrameNode = FrameNode::GetOrCreateFrameNode(V2::RELATIVE_CONTAINER_ETS_TAG, 0,
+        []() { return AceType::MakeRefPtr<OHOS::Ace::NG::RelativeContainerPattern>(); });
+    ASSERT_NE(relativeContainerFrameNode, nullptr);
+    MeasureProperty layoutConstraint;
+    layoutConstraint.selfIdealSize = CalcSize(CalcLength(CONTAINER_WIDTH), CalcLength(CONTAINER_HEIGHT));
+    relativeContainerFrameNode->UpdateLayoutConstraint(layoutConstraint);
+    LayoutWrapperNode layoutWrapper = LayoutWrapperNode(relativeContainerFrameNode,
+        AceType::MakeRefPtr<GeometryNode>(), relativeContainerFrameNode->GetLayoutProperty());
+    auto relativeContainerPattern = relativeContainerFrameNode->GetPattern<RelativeContainerPattern>();
+    ASSERT_NE(relativeContainerPattern, nullptr);
+    LayoutConstraintF parentLayoutConstraint;
+    parentLayoutConstraint.selfIdealSize.SetSize(CONTAINER_SIZE);
+    layoutWrapper.GetLayoutProperty()->UpdateLayoutConstraint(parentLayoutConstraint);
+    layoutWrapper.GetLayoutProperty()->UpdateContentConstraint();
+    auto childLayoutConstraint = layoutWrapper.GetLayoutProperty()->CreateChildConstraint();
+    childLayoutConstraint.maxSize = CONTAINER_SIZE;
+
+    /**
+     * @tc.steps: step1. add bt1 anchored to bt2 and bt2 anchored to the container.
+     */
+    std::vector<RefPtr<FrameNode>> children;
+    const std::string ids[] = { FIRST_ITEM_ID, SECOND_ITEM_ID };
+    for (int32_t index = 0; index < 2; ++index) {
+        auto frameNode = FrameNode::CreateFrameNode(V2::BLANK_ETS_TAG, index + 1, AceType::MakeRefPtr<Pattern>());
+        auto childWrapper = AceType::MakeRefPtr<LayoutWrapperNode>(
+            frameNode, AceType::MakeRefPtr<GeometryNode>(), frameNode->GetLayoutProperty());
+        childWrapper->GetLayoutProperty()->UpdateLayoutConstraint(childLayoutConstraint);
+        childWrapper->SetLayoutAlgorithm(AceType::MakeRefPtr<LayoutAlgorithmWrapper>(
+            frameNode->GetPattern<Pattern>()->CreateLayoutAlgorithm()));
+        frameNode->UpdateInspectorId(ids[index]);
+        relativeContainerFrameNode->AddChild(frameNode);
+        layoutWrapper.AppendChild(childWrapper);
+        children.emplace_back(frameNode);
+    }
+    std::map<AlignDirection, AlignRule> firstAlignRules;
+    RelativeContainerTestUtilsNG::AddAlignRule(
+        SECOND_ITEM_ID, AlignDirection::LEFT, HorizontalAlign::END, firstAlignRules);
+    children[0]->GetLayoutProperty()->UpdateAlignRules(firstAlignRules);
+    std::map<AlignDirection, AlignRule> secondAlignRules;
+    RelativeContainerTestUtilsNG::AddAlignRule(
+        CONTAINER_ID, AlignDirection::LEFT, HorizontalAlign::START, secondAlignRules);
+    children[1]->GetLayoutProperty()->UpdateAlignRules(secondAlignRules);
+
+    /**
+     * @tc.steps: step2. measure twice.
+     * @tc.expected: bt2 is measured before bt1, and the plan is compiled once.
+     */
+    auto plan = relativeContainerPattern->layoutPlan_;
+    ASSERT_NE(plan, nullptr);
+    relativeContainerPattern->CreateLayoutAlgorithm()->Measure(&layoutWrapper);
+    ASSERT_EQ(plan->steps.size(), 2);
+    EXPECT_EQ(plan->steps[0].index, 1);
+    EXPECT_EQ(plan->steps[1].index, 0);
+    EXPECT_EQ(plan->steps[1].anchors, std::vector<int32_t>({ 1 }));
+    auto compiledFlexItem = plan->childFlexItems[0];
+    relativeContainerPattern->CreateLayoutAlgorithm()->Measure(&layoutWrapper);
+    EXPECT_EQ(plan->childFlexItems[0], compiledFlexItem);
+
+    /**
+     * @tc.steps: step3. set the same align rules again, then anchor bt1 to the container.
+     * @tc.expected: the plan is only compiled again after the align rules change.
+     */
+    children[0]->GetLayoutProperty()->UpdateAlignRules(firstAlignRules);
+    relativeContainerPattern->CreateLayoutAlgorithm()->Measure(&layoutWrapper);
+    EXPECT_EQ(plan->childFlexItems[0], compiledFlexItem);
+    children[0]->GetLayoutProperty()->UpdateAlignRules(secondAlignRules);
+    relativeContainerPattern->CreateLayoutAlgorithm()->Measure(&layoutWrapper);
+    EXPECT_NE(plan->childFlexItems[0], compiledFlexItem);
+    ASSERT_EQ(plan->steps.size(), 2);
+    EXPECT_EQ(plan->steps[0].index, 0);
+    EXPECT_TRUE(plan->steps[0].anchors.empty());
+}
 } // namespace OHOS::Ace::NG
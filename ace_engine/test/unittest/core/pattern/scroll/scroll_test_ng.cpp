@@ -2706,6 +2706,35 @@ HWTEST_F(ScrollTestNg, ScrollSetFrictionTest001, TestSize.Level1)
     EXPECT_DOUBLE_EQ(pattern_->GetFriction(), friction);
 }
 
+/**
+ * @tc.name: ScrollSetTouchPredictionTest001
+ * @tc.desc: Test SetTouchPredictionEnabled
+ * @tc.type: FUNC
+ */
+HWTEST_F(ScrollTestNg, ScrollSetTouchPredictionTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. enable touch prediction before the scrollable is created
+     * @tc.expected: the scrollable and its pan recognizer are created with touch prediction enabled.
+     */
+    Create([](ScrollModelNG model) { model.SetTouchPredictionEnabled(true); });
+    auto scrollable = pattern_->scrollableEvent_->GetScrollable();
+    EXPECT_TRUE(scrollable->isTouchPredictionEnabled_);
+    if (scrollable->panRecognizerNG_) {
+        EXPECT_TRUE(scrollable->panRecognizerNG_->IsTouchPredictionEnabled());
+    }
+
+    /**
+     * @tc.steps: step2. disable touch prediction after the scrollable is created
+     * @tc.expected: the scrollable and its pan recognizer are updated.
+     */
+    pattern_->SetTouchPredictionEnabled(false);
+    EXPECT_FALSE(scrollable->isTouchPredictionEnabled_);
+    if (scrollable->panRecognizerNG_) {
+        EXPECT_FALSE(scrollable->panRecognizerNG_->IsTouchPredictionEnabled());
+    }
+}
+
 /**
  * @tc.name: Snap001
  * @tc.desc: Test snap
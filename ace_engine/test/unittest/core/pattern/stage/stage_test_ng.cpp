@@ -1124,11 +1124,11 @@ HWTEST_F(StageTestNg, PagePatternTest007, TestSize.Level1)
     pattern->ReloadPage();
 
     /**
-     * @tc.steps: step2. add Element to nodeAnimatablePropertyMap_.
+     * @tc.steps: step2. add Element to nodeAnimatablePropertyMap.
      * @tc.expected: GetAnimatablePropertyFloat seccuess.
      */
     auto FRAME_NODE = FrameNode::CreateFrameNode(FRAME_NODE_TAG, 0, AceType::MakeRefPtr<Pattern>());
-    FRAME_NODE->nodeAnimatablePropertyMap_.emplace(
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.emplace(
         "pageTransitionProperty", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
     pattern->frameNode_ = FRAME_NODE;
     pattern->StopPageTransition();
@@ -1184,11 +1184,11 @@ HWTEST_F(StageTestNg, PagePatternTest008, TestSize.Level1)
     pattern->ReloadPage();
 
     /**
-     * @tc.steps: step2. add Element to nodeAnimatablePropertyMap_.
+     * @tc.steps: step2. add Element to nodeAnimatablePropertyMap.
      * @tc.expected: GetAnimatablePropertyFloat seccuess.
      */
     auto FRAME_NODE = FrameNode::CreateFrameNode(FRAME_NODE_TAG, 0, AceType::MakeRefPtr<Pattern>());
-    FRAME_NODE->nodeAnimatablePropertyMap_.emplace(
+    FRAME_NODE->GetOrCreateExtraData().nodeAnimatablePropertyMap.emplace(
         "pageTransitionProperty", AceType::MakeRefPtr<NodeAnimatablePropertyBase>());
     pattern->frameNode_ = FRAME_NODE;
     pattern->StopPageTransition();
@@ -421,9 +421,9 @@ HWTEST_F(TextTestNg, TextFrameNodeCreator001, TestSize.Level1)
     RefPtr<TextLayoutProperty> textLayoutProperty = AceType::DynamicCast<TextLayoutProperty>(layoutProperty);
     ASSERT_NE(textLayoutProperty, nullptr);
     EXPECT_EQ(textLayoutProperty->GetContentValue(), CREATE_VALUE);
-    const std::unique_ptr<FontStyle>& fontStyle = textLayoutProperty->GetFontStyle();
+    const CowPtr<FontStyle>& fontStyle = textLayoutProperty->GetFontStyle();
     ASSERT_NE(fontStyle, nullptr);
-    const std::unique_ptr<TextLineStyle>& textLineStyle = textLayoutProperty->GetTextLineStyle();
+    const CowPtr<TextLineStyle>& textLineStyle = textLayoutProperty->GetTextLineStyle();
     ASSERT_NE(textLineStyle, nullptr);
     TextStyle textStyle = CreateTextStyleUsingTheme(fontStyle, textLineStyle, nullptr);
     EXPECT_EQ(textStyle.GetFontSize(), FONT_SIZE_VALUE);
@@ -470,9 +470,9 @@ HWTEST_F(TextTestNg, TextFrameNodeCreator002, TestSize.Level1)
     auto textLayoutProperty = AceType::DynamicCast<TextLayoutProperty>(layoutProperty);
     ASSERT_NE(textLayoutProperty, nullptr);
     EXPECT_EQ(textLayoutProperty->GetContentValue(), CREATE_VALUE);
-    const std::unique_ptr<FontStyle>& fontStyle = textLayoutProperty->GetFontStyle();
+    const CowPtr<FontStyle>& fontStyle = textLayoutProperty->GetFontStyle();
     ASSERT_NE(fontStyle, nullptr);
-    const std::unique_ptr<TextLineStyle>& textLineStyle = textLayoutProperty->GetTextLineStyle();
+    const CowPtr<TextLineStyle>& textLineStyle = textLayoutProperty->GetTextLineStyle();
     ASSERT_NE(textLineStyle, nullptr);
     auto textStyle = CreateTextStyleUsingTheme(fontStyle, textLineStyle, nullptr);
     EXPECT_EQ(textStyle.GetLetterSpacing(), LETTER_SPACING);
@@ -496,9 +496,9 @@ HWTEST_F(TextTestNg, TextFrameNodeCreator003, TestSize.Level1)
     EXPECT_EQ(textLayoutProperty->GetContentValue(), CREATE_VALUE);
     textModelNG.SetFontWeight(FontWeight::LIGHTER);
     textModelNG.SetLineHeight(LINE_HEIGHT_VALUE);
-    const std::unique_ptr<FontStyle>& fontStyle = textLayoutProperty->GetFontStyle();
+    const CowPtr<FontStyle>& fontStyle = textLayoutProperty->GetFontStyle();
     ASSERT_NE(textLayoutProperty, nullptr);
-    const std::unique_ptr<TextLineStyle>& textLineStyle = textLayoutProperty->GetTextLineStyle();
+    const CowPtr<TextLineStyle>& textLineStyle = textLayoutProperty->GetTextLineStyle();
     ASSERT_NE(textLayoutProperty, nullptr);
     TextStyle textStyle = CreateTextStyleUsingTheme(fontStyle, textLineStyle, nullptr);
 
@@ -4547,7 +4547,7 @@ HWTEST_F(TextTestNg, SetFontSize001, TestSize.Level1)
     ASSERT_NE(layoutProperty, nullptr);
     RefPtr<TextLayoutProperty> textLayoutProperty = AceType::DynamicCast<TextLayoutProperty>(layoutProperty);
     ASSERT_NE(textLayoutProperty, nullptr);
-    const std::unique_ptr<FontStyle>& fontStyle = textLayoutProperty->GetFontStyle();
+    const CowPtr<FontStyle>& fontStyle = textLayoutProperty->GetFontStyle();
     ASSERT_NE(fontStyle, nullptr);
     EXPECT_EQ(fontStyle->GetFontSize().value(), Dimension(0));
 }
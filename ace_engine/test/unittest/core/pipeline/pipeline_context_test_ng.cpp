@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
 #include <iostream>
 #include <memory>
@@ -52,6 +53,7 @@
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/event/event_hub.h"
 #include "core/components_ng/event/focus_hub.h"
+#include "core/components_ng/pattern/blank/blank_pattern.h"
 #include "core/components_ng/pattern/bubble/bubble_pattern.h"
 #include "core/components_ng/pattern/button/button_event_hub.h"
 #include "core/components_ng/pattern/container_modal/container_modal_pattern.h"
@@ -2281,6 +2283,56 @@ HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg006, TestSize.Level1)
     EXPECT_EQ(taskScheduler.afterLayoutTasks_.size(), 0);
 }
 
+/**
+ * @tc.name: UITaskSchedulerTestNg007
+ * @tc.desc: Test HibernatePage and WakeUpPage.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg007, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Create taskScheduler and two nodes on different pages.
+     */
+    UITaskScheduler taskScheduler;
+    auto frameNode = FrameNode::GetOrCreateFrameNode(TEST_TAG, 1, nullptr);
+    frameNode->SetHostPageId(1);
+    auto frameNode2 = FrameNode::GetOrCreateFrameNode(TEST_TAG, 2, nullptr);
+    frameNode2->SetHostPageId(2);
+
+    /**
+     * @tc.steps2: Add dirty nodes and hibernate page 1.
+     * @tc.expected: dirty nodes of page 1 are parked, the others are kept.
+     */
+    taskScheduler.AddDirtyLayoutNode(frameNode);
+    taskScheduler.AddDirtyLayoutNode(frameNode2);
+    taskScheduler.HibernatePage(1);
+    EXPECT_TRUE(taskScheduler.IsPageHibernated(1));
+    EXPECT_EQ(taskScheduler.dirtyLayoutNodes_.size(), 1);
+    taskScheduler.AddDirtyRenderNode(frameNode);
+    EXPECT_EQ(taskScheduler.dirtyRenderNodes_.count(1), 0);
+    EXPECT_EQ(taskScheduler.hibernatedPages_[1].layoutNodes.size(), 1);
+    EXPECT_EQ(taskScheduler.hibernatedPages_[1].renderNodes.size(), 1);
+
+    /**
+     * @tc.steps3: Wake up page 1.
+     * @tc.expected: parked nodes are dirty again.
+     */
+    EXPECT_TRUE(taskScheduler.WakeUpPage(1));
+    EXPECT_FALSE(taskScheduler.IsPageHibernated(1));
+    EXPECT_EQ(taskScheduler.dirtyLayoutNodes_.size(), 2);
+    EXPECT_EQ(taskScheduler.dirtyRenderNodes_[1].size(), 1);
+
+    /**
+     * @tc.steps4: Hibernate page 1 again and wake it up without restoring.
+     * @tc.expected: parked nodes are dropped.
+     */
+    taskScheduler.HibernatePage(1);
+    EXPECT_EQ(taskScheduler.dirtyLayoutNodes_.size(), 1);
+    EXPECT_FALSE(taskScheduler.WakeUpPage(1, false));
+    EXPECT_EQ(taskScheduler.dirtyLayoutNodes_.size(), 1);
+    EXPECT_TRUE(taskScheduler.hibernatedPages_.empty());
+}
+
 /**
  * @tc.name: PipelineContextTestNg043
  * @tc.desc: Test SetCloseButtonStatus function.
@@ -3133,5 +3185,269 @@ HWTEST_F(PipelineContextTestNg, PipelineContextTestNg072, TestSize.Level1)
     TouchEvent result = context_->GetLatestPoint(events, nanoTimeStamp);
     ASSERT_LT(static_cast<uint64_t>(result.time.time_since_epoch().count()), nanoTimeStamp);
 }
+
+/**
+ * @tc.name: PipelineContextTestNg073
+ * @tc.desc: Test HandleVisibleAreaChangeEvent only runs after the visible area is marked dirty.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, PipelineContextTestNg073, TestSize.Level1)
+{
+    ASSERT_NE(context_, nullptr);
+    context_->onVisibleAreaChangeNodeIds_.clear();
+    context_->HandleVisibleAreaChangeEvent();
+    context_->visibleAreaDirty_ = false;
+
+    /**
+     * @tc.steps1: register a visible area callback.
+     * @tc.expected: registration marks the node dirty, the next event handling cleans it.
+     */
+    context_->AddVisibleAreaChangeNode(frameNode_, DEFAULT_DOUBLE1, nullptr);
+    EXPECT_TRUE(frameNode_->isVisibleAreaDirty_);
+    EXPECT_EQ(context_->dirtyVisibleAreaNodes_.size(), 1);
+    context_->HandleVisibleAreaChangeEvent();
+    EXPECT_FALSE(frameNode_->isVisibleAreaDirty_);
+    EXPECT_TRUE(context_->dirtyVisibleAreaNodes_.empty());
+
+    /**
+     * @tc.steps2: change the geometry of a node.
+     * @tc.expected: the node is dirty again, marking it twice adds it once.
+     */
+    frameNode_->SetActive(!frameNode_->IsActive());
+    frameNode_->MarkVisibleAreaDirty();
+    EXPECT_TRUE(frameNode_->isVisibleAreaDirty_);
+    EXPECT_EQ(context_->dirtyVisibleAreaNodes_.size(), 1);
+    context_->HandleVisibleAreaChangeEvent();
+    EXPECT_FALSE(frameNode_->isVisibleAreaDirty_);
+
+    /**
+     * @tc.steps3: mark a parent of the node.
+     * @tc.expected: the node is checked with its dirty parent.
+     */
+    auto parent = FrameNode::GetOrCreateFrameNode(TEST_TAG, ElementRegister::GetInstance()->MakeUniqueId(), nullptr);
+    auto child = FrameNode::GetOrCreateFrameNode(TEST_TAG, ElementRegister::GetInstance()->MakeUniqueId(), nullptr);
+    child->MountToParent(parent);
+    parent->MarkVisibleAreaDirty();
+    VisibleAreaCache cache;
+    EXPECT_FALSE(child->isVisibleAreaDirty_);
+    EXPECT_TRUE(child->IsVisibleAreaDirty(cache));
+    context_->HandleVisibleAreaChangeEvent();
+    VisibleAreaCache cleanCache;
+    EXPECT_FALSE(child->IsVisibleAreaDirty(cleanCache));
+
+    /**
+     * @tc.steps4: mark the pipeline.
+     * @tc.expected: all registered nodes are checked and the mark is cleaned.
+     */
+    context_->MarkVisibleAreaDirty();
+    context_->HandleVisibleAreaChangeEvent();
+    EXPECT_FALSE(context_->visibleAreaDirty_);
+    context_->onVisibleAreaChangeNodeIds_.clear();
+}
+
+/**
+ * @tc.name: PipelineContextTestNg074
+ * @tc.desc: Test the touch sample track kept by FlushTouchEvents.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, PipelineContextTestNg074, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: flush a batch of move events of one pointer.
+     * @tc.expected: the samples of the batch are kept as history of the pointer.
+     */
+    ASSERT_NE(context_, nullptr);
+    context_->SetupRootElement();
+    context_->touchEvents_.clear();
+    context_->touchSampleTracks_.clear();
+    context_->touchEvents_.push_back(TouchEvent { .x = 100.0f, .y = 200.0f, .type = TouchType::MOVE,
+        .time = TimeStamp(std::chrono::nanoseconds(1000)) });
+    context_->touchEvents_.push_back(TouchEvent { .x = 150.0f, .y = 250.0f, .type = TouchType::MOVE,
+        .time = TimeStamp(std::chrono::nanoseconds(2000)) });
+    context_->FlushTouchEvents();
+    ASSERT_EQ(context_->touchSampleTracks_.count(0), 1u);
+    EXPECT_EQ(context_->touchSampleTracks_[0].samples.size(), 2u);
+    EXPECT_EQ(context_->touchSampleTracks_[0].historySize, 2u);
+
+    /**
+     * @tc.steps2: flush the next batch.
+     * @tc.expected: the previous samples are dropped and the new ones become the history.
+     */
+    context_->touchEvents_.push_back(TouchEvent { .x = 200.0f, .y = 300.0f, .type = TouchType::MOVE,
+        .time = TimeStamp(std::chrono::nanoseconds(3000)) });
+    context_->FlushTouchEvents();
+    EXPECT_EQ(context_->touchSampleTracks_[0].samples.size(), 1u);
+    EXPECT_EQ(context_->touchSampleTracks_[0].historySize, 1u);
+    EXPECT_EQ(context_->touchSampleTracks_[0].samples[0].time, 3000u);
+    context_->touchSampleTracks_.clear();
+}
+
+/**
+ * @tc.name: PipelineContextTestNg075
+ * @tc.desc: Test ElementRegister keeps items in the element slot map.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, PipelineContextTestNg075, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: register nodes with a dense id and an out of range id.
+     * @tc.expected: both can be found, a duplicate id is rejected.
+     */
+    auto elementRegister = ElementRegister::GetInstance();
+    auto denseId = elementRegister->MakeUniqueId();
+    constexpr ElementIdType sparseId = 1 << 30;
+    auto denseNode = FrameNode::CreateFrameNode("test", denseId, AceType::MakeRefPtr<Pattern>());
+    auto sparseNode = FrameNode::CreateFrameNode("test", sparseId, AceType::MakeRefPtr<Pattern>());
+    elementRegister->RemoveItemSilently(denseId);
+    elementRegister->RemoveItemSilently(sparseId);
+    EXPECT_TRUE(elementRegister->AddUINode(denseNode));
+    EXPECT_TRUE(elementRegister->AddUINode(sparseNode));
+    EXPECT_FALSE(elementRegister->AddUINode(denseNode));
+    EXPECT_EQ(elementRegister->GetUINodeById(denseId), denseNode);
+    EXPECT_EQ(elementRegister->GetUINodeById(sparseId), sparseNode);
+
+    /**
+     * @tc.steps2: remove the nodes and move the removed items.
+     * @tc.expected: the nodes are gone and the removed items keep their tags.
+     */
+    RemovedElementsType removedItems;
+    elementRegister->MoveRemovedItems(removedItems);
+    EXPECT_TRUE(elementRegister->RemoveItem(denseId, "dense"));
+    EXPECT_TRUE(elementRegister->RemoveItem(sparseId));
+    EXPECT_FALSE(elementRegister->Exists(denseId));
+    EXPECT_FALSE(elementRegister->Exists(sparseId));
+    elementRegister->MoveRemovedItems(removedItems);
+    ASSERT_EQ(removedItems.size(), 2u);
+    EXPECT_EQ(removedItems[0].elmtId, denseId);
+    EXPECT_EQ(elementRegister->GetRemovedTag(removedItems[0].tagId), "dense");
+    EXPECT_EQ(elementRegister->GetRemovedTag(removedItems[1].tagId), "undefined TAG");
+}
+
+/**
+ * @tc.name: PipelineContextTestNg076
+ * @tc.desc: Test GetPredictedOffset extrapolates the pointer with confidence clamping.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, PipelineContextTestNg076, TestSize.Level1)
+{
+    constexpr uint64_t sampleInterval = 4 * 1000 * 1000;
+    auto makeTrack = [](float speed, size_t count) {
+        PipelineContext::TouchSampleTrack track;
+        for (size_t i = 0; i < count; ++i) {
+            float x = 100.0f + speed * 4.0f * i;
+            track.samples.push_back(TouchSample { x, 200.0f, x, 200.0f, sampleInterval * (i + 1) });
+        }
+        return track;
+    };
+
+    /**
+     * @tc.steps1: predict a pointer moving at 1px per ms 8ms ahead.
+     * @tc.expected: it is moved 8px along its direction.
+     */
+    auto track = makeTrack(1.0f, 4);
+    auto latestTime = track.samples.back().time;
+    auto offset = PipelineContext::GetPredictedOffset(track, latestTime + 2 * sampleInterval);
+    ASSERT_TRUE(offset.has_value());
+    EXPECT_NEAR(offset->GetX(), 8.0, 0.01);
+    EXPECT_NEAR(offset->GetY(), 0.0, 0.01);
+
+    /**
+     * @tc.steps2: predict far ahead and predict a fast pointer.
+     * @tc.expected: the horizon and the distance of the prediction are clamped.
+     */
+    offset = PipelineContext::GetPredictedOffset(track, latestTime + 25 * sampleInterval);
+    ASSERT_TRUE(offset.has_value());
+    EXPECT_NEAR(offset->GetX(), 20.0, 0.01);
+    auto fastTrack = makeTrack(10.0f, 4);
+    offset = PipelineContext::GetPredictedOffset(fastTrack, latestTime + 2 * sampleInterval);
+    ASSERT_TRUE(offset.has_value());
+    EXPECT_NEAR(offset->GetX(), 64.0, 0.01);
+
+    /**
+     * @tc.steps3: predict with too few samples, a past time and a still pointer.
+     * @tc.expected: there is no prediction.
+     */
+    EXPECT_FALSE(PipelineContext::GetPredictedOffset(makeTrack(1.0f, 2), latestTime).has_value());
+    EXPECT_FALSE(PipelineContext::GetPredictedOffset(track, latestTime).has_value());
+    EXPECT_FALSE(PipelineContext::GetPredictedOffset(makeTrack(0.0f, 4), latestTime + sampleInterval).has_value());
+}
+
+/**
+ * @tc.name: UITaskSchedulerTestNg008
+ * @tc.desc: Test RunParallelTasks runs every background render task before it returns
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg008, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Run fewer tasks than the parallel threshold.
+     * @tc.expected: all tasks are run on the current thread.
+     */
+    int32_t count = 0;
+    std::vector<UITask> tasks;
+    for (int32_t i = 0; i < 2; ++i) {
+        tasks.emplace_back([&count]() { ++count; }, BACKGROUND_TASK);
+    }
+    UITaskScheduler::RunParallelTasks(tasks);
+    EXPECT_EQ(count, 2);
+
+    /**
+     * @tc.steps2: Run more tasks than the parallel threshold.
+     * @tc.expected: all tasks are run once when it returns.
+     */
+    std::atomic<int32_t> parallelCount = 0;
+    tasks.clear();
+    for (int32_t i = 0; i < 10; ++i) {
+        tasks.emplace_back([&parallelCount]() { ++parallelCount; }, BACKGROUND_TASK);
+    }
+    UITaskScheduler::RunParallelTasks(tasks);
+    EXPECT_EQ(parallelCount, 10);
+}
+
+/**
+ * @tc.name: UITaskSchedulerTestNg009
+ * @tc.desc: Test the background render tasks are finished before the frame is sent
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg009, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Create blank nodes whose draw functions are created on the background threads.
+     * @tc.expected: their render tasks are background tasks.
+     */
+    ASSERT_NE(context_, nullptr);
+    context_->SetupRootElement();
+    auto blankNodes = std::make_shared<std::vector<RefPtr<FrameNode>>>();
+    for (int32_t i = 0; i < 6; ++i) {
+        auto blankNode = FrameNode::CreateFrameNode(
+            V2::BLANK_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<BlankPattern>());
+        blankNode->isRenderDirtyMarked_ = true;
+        auto task = blankNode->CreateRenderTask(false);
+        ASSERT_TRUE(task.has_value());
+        EXPECT_EQ(task->GetTaskThreadType(), BACKGROUND_TASK);
+        blankNodes->emplace_back(blankNode);
+    }
+
+    /**
+     * @tc.steps2: Mark the blank nodes dirty and flush a frame.
+     * @tc.expected: every render task is finished when the frame is sent.
+     */
+    auto isRenderFinished = std::make_shared<bool>(false);
+    auto window = static_cast<MockWindow*>(context_->window_.get());
+    EXPECT_CALL(*window, FlushTasks()).WillRepeatedly(testing::Invoke([blankNodes, isRenderFinished]() {
+        *isRenderFinished = std::all_of(blankNodes->begin(), blankNodes->end(), [](const RefPtr<FrameNode>& node) {
+            return !node->isRenderDirtyMarked_ &&
+                   node->GetPaintProperty<PaintProperty>()->GetPropertyChangeFlag() == PROPERTY_UPDATE_NORMAL;
+        });
+    }));
+    for (const auto& blankNode : *blankNodes) {
+        blankNode->GetPaintProperty<PaintProperty>()->UpdatePropertyChangeFlag(PROPERTY_UPDATE_RENDER);
+        blankNode->isRenderDirtyMarked_ = true;
+        context_->taskScheduler_->AddDirtyRenderNode(blankNode);
+    }
+    context_->FlushVsync(NANO_TIME_STAMP, FRAME_COUNT);
+    EXPECT_TRUE(*isRenderFinished);
+    blankNodes->clear();
+}
 } // namespace NG
 } // namespace OHOS::Ace